@@ -0,0 +1,158 @@
+#!/usr/bin/python3
+# -*- coding: utf-8 -*-
+
+# Compile the XML description of an alphabet (res/<alphabet>/language_*.xml) into
+# the static tables compiled into the library: a `def.cpp` file for each font
+# (into src/res/font) and a `def.cpp` file for the symbols and the mappings of
+# the alphabet (into src/res/sym).
+#
+# Usage: alphabet_def.py <alphabet-name> <language-xml> <src-res-dir>
+#
+#   alphabet_def.py greek res/greek/language_greek.xml src/res
+
+import os
+import sys
+import xml.etree.ElementTree as ET
+
+
+def c_str(s):
+    out = ''
+    for ch in s:
+        if ch == '\\' or ch == '"':
+            out += '\\' + ch
+        else:
+            out += ch
+    return '"' + out + '"'
+
+
+def rows(items):
+    return ',\n'.join(', '.join(str(x) for x in item) for item in items)
+
+
+def sorted_by(items, n):
+    # the tables are searched by their first n column(s), only the first item
+    # of a duplicated key is kept as TeX stops at the first match of a lig/kern
+    # program
+    seen, unique = set(), []
+    for item in items:
+        key = tuple(int(x) for x in item[:n])
+        if key not in seen:
+            seen.add(key)
+            unique.append(item)
+    return sorted(unique, key=lambda item: tuple(int(x) for x in item[:n]))
+
+
+def compile_font(xml_path, alphabet, out_dir):
+    font = ET.parse(xml_path).getroot()
+    name = font.get('id')
+    path = '%s/%s' % (alphabet, font.get('name'))
+    metrics, kerns, ligs, largers, exts = [], [], [], [], []
+    for c in font.findall('Char'):
+        code = c.get('code')
+        metrics.append([
+            code,
+            c.get('width', '0'),
+            c.get('height', '0'),
+            c.get('depth', '0'),
+            c.get('italic', '0'),
+        ])
+        for x in c:
+            if x.tag == 'Kern':
+                kerns.append([code, x.get('code'), x.get('val')])
+            elif x.tag == 'Lig':
+                ligs.append([code, x.get('code'), x.get('ligCode')])
+            elif x.tag == 'NextLarger':
+                largers.append([code, x.get('code'), x.get('fontId')])
+            elif x.tag == 'Extension':
+                exts.append([
+                    code,
+                    x.get('top', '-1'),
+                    x.get('mid', '-1'),
+                    x.get('rep'),
+                    x.get('bot', '-1'),
+                ])
+            else:
+                raise Exception('%s: unknown child element <%s>' % (xml_path, x.tag))
+    if largers:
+        raise Exception('%s: the larger versions are not supported' % xml_path)
+
+    lines = ['#include "res/font_def.res.h"', '']
+    lines.append('DEF_FONT(%s, %s, %s)' % (name, path, font.get('unicode', '0')))
+    lines.append('')
+    params = 'xHeight(%s) quad(%s) space(%s)' % (font.get('xHeight'), font.get('quad'), font.get('space'))
+    if font.get('skewChar') is not None:
+        params += ' skew(%s)' % font.get('skewChar')
+    lines.append(params)
+    versions = []
+    for attr, macro in (('romanVersion', 'roman'),
+                        ('boldVersion', 'bold'),
+                        ('ssVersion', 'ss'),
+                        ('ttVersion', 'tt'),
+                        ('itVersion', 'it')):
+        if font.get(attr) is not None:
+            versions.append('%s(%s)' % (macro, font.get(attr)))
+    if versions:
+        lines.append('')
+        lines.append(' '.join(versions))
+    for table, start, end, n in ((metrics, 'METRICS_START', 'METRICS_END', 1),
+                                 (exts, 'EXTENSIONS_START', 'EXTENSIONS_END', 1),
+                                 (ligs, 'LIGTURES_START', 'LIGTURES_END', 2),
+                                 (kerns, 'KERNS_START', 'KERNS_END', 2)):
+        if not table:
+            continue
+        lines += ['', start, rows(sorted_by(table, n)), end]
+    lines += ['', 'END', '']
+
+    with open(os.path.join(out_dir, name + '.def.cpp'), 'w', encoding='utf-8') as f:
+        f.write('\n'.join(lines))
+    return name
+
+
+def compile_alphabet(alphabet, lang_path, res_dir):
+    base = os.path.dirname(lang_path)
+    root = ET.parse(lang_path).getroot()
+    fonts = []
+    for m in root.find('FontDescriptions').findall('Metrics'):
+        fonts.append(compile_font(os.path.join(base, m.get('include')), alphabet, os.path.join(res_dir, 'font')))
+
+    lines = ['#include "res/alphabet_def.res.h"', '']
+    lines.append('DEF_ALPHABET(%s)' % alphabet)
+
+    mappings = []
+    for m in root.find('SymbolMappings').findall('Mapping'):
+        for s in ET.parse(os.path.join(base, m.get('include'))).getroot().findall('SymbolMapping'):
+            if s.get('boldId') is not None:
+                raise Exception('the bold version of the symbol %s is not supported' % s.get('name'))
+            mappings.append('E(%s, %s, %s)' % (s.get('fontId'), s.get('ch'), c_str(s.get('name'))))
+    lines += ['', 'SYMBOLS_START'] + mappings + ['SYMBOLS_END']
+
+    syms = root.find('TeXSymbols')
+    if syms is not None:
+        lines.append('')
+        for s in ET.parse(os.path.join(base, syms.get('include'))).getroot().findall('Symbol'):
+            kind = 'del' if s.get('del') == 'true' else 'sym'
+            lines.append('%s(%s, %s)' % (kind, s.get('type'), c_str(s.get('name'))))
+
+    settings = root.find('FormulaSettings')
+    if settings is not None:
+        doc = ET.parse(os.path.join(base, settings.get('include'))).getroot()
+        for tag, macro, attr in (('CharacterToSymbolMappings', 'C', 'symbol'),
+                                 ('CharacterToFormulaMappings', 'F', 'formula')):
+            e = doc.find(tag)
+            if e is None:
+                continue
+            lines.append('')
+            for m in e.findall('Map'):
+                code = ord(m.get('char'))
+                lines.append('%s(%d, %s)' % (macro, code, c_str(m.get(attr))))
+                if m.get('text') is not None:
+                    lines.append('T(%d, %s)' % (code, c_str(m.get('text'))))
+
+    lines += ['', 'END_DEF_ALPHABET', '']
+    with open(os.path.join(res_dir, 'sym', alphabet + '.def.cpp'), 'w', encoding='utf-8') as f:
+        f.write('\n'.join(lines))
+    print('%s: %s' % (alphabet, ', '.join(fonts)))
+
+
+if __name__ == '__main__':
+    compile_alphabet(sys.argv[1], sys.argv[2], sys.argv[3])
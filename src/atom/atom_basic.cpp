@@ -6,6 +6,7 @@
 #include "box/box_factory.h"
 #include "core/core.h"
 #include "core/formula.h"
+#include "core/macro.h"
 #include "fonts/fonts.h"
 #include "graphic/graphic.h"
 #include "res/parser/formula_parser.h"
@@ -122,6 +123,13 @@ sptr<Box> UnderScoreAtom::createBox(Environment& env) {
   return sptr<Box>(hb);
 }
 
+sptr<Box> MiddleAtom::createBox(Environment& env) {
+  // the box is sized by the fenced atom around, see FencedAtom
+  auto box = env.getMiddleBox(this);
+  if (box != nullptr) return box;
+  return sptrOf<StrutBox>(0.f, 0.f, 0.f, 0.f);
+}
+
 /************************************ VRowAtom implementation *************************************/
 
 VRowAtom::VRowAtom() {
@@ -222,11 +230,18 @@ ColorAtom::ColorAtom(const sptr<Atom>& atom, color bg, color c)
 }
 
 void ColorAtom::defineColor(const string& name, color c) {
-  _colors[name] = c;
+  MacroScope* scope = MacroScope::current();
+  auto& colors = scope == nullptr ? _colors : scope->_colors;
+  colors[name] = c;
+  MacroScope::record(name, c);
 }
 
 sptr<Box> ColorAtom::createBox(Environment& env) {
-  const auto box = _elements->createBox(env);
+  return createBox(env, AtomType::none);
+}
+
+sptr<Box> ColorAtom::createBox(Environment& env, AtomType previous) {
+  const auto box = _elements->createBox(env, previous);
   return sptrOf<ColorBox>(box, _color, _background);
 }
 
@@ -250,7 +265,11 @@ PhantomAtom::PhantomAtom(const sptr<Atom>& el, bool w, bool h, bool d) {
 }
 
 sptr<Box> PhantomAtom::createBox(Environment& env) {
-  auto res = _elements->createBox(env);
+  return createBox(env, AtomType::none);
+}
+
+sptr<Box> PhantomAtom::createBox(Environment& env, AtomType previous) {
+  auto res = _elements->createBox(env, previous);
   float w = (_w ? res->_width : 0);
   float h = (_h ? res->_height : 0);
   float d = (_d ? res->_depth : 0);
@@ -326,11 +345,11 @@ sptr<Box> AccentedAtom::createBox(Environment& env) {
   float u = b->_width;
   float s = 0;
   auto* sym = dynamic_cast<CharSymbol*>(_underbase.get());
-  if (sym != nullptr) s = tf->getSkew(*(sym->getCharFont(*tf)), style);
+  if (sym != nullptr) s = tf->getSkew(sym->getCharFont(*tf), style);
 
   // retrieve best char from the accent symbol
   auto* acc = (SymbolAtom*) _accent.get();
-  Char ch = tf->getChar(acc->getName(), style);
+  Char ch = acc->getChar(*tf, style);
   while (tf->hasNextLarger(ch)) {
     Char larger = tf->getNextLarger(ch, style);
     if (larger.getWidth() <= u) ch = larger;
@@ -444,21 +463,24 @@ sptr<Box> UnderOverAtom::createBox(Environment& env) {
 SpaceAtom ScriptsAtom::SCRIPT_SPACE(UnitType::point, 0.5f, 0.f, 0.f);
 
 sptr<Box> ScriptsAtom::createBox(Environment& env) {
-  if (_base == nullptr) {
+  // a phantom holds the place of the missing base, the atom is not modified
+  // since it may be laid out again
+  sptr<Atom> base = _base;
+  if (base == nullptr) {
     auto in = sptrOf<CharAtom>(L'M', "mathnormal");
-    _base = sptrOf<PhantomAtom>(in, false, true, true);
+    base = sptrOf<PhantomAtom>(in, false, true, true);
   }
 
-  auto b = _base->createBox(env);
+  auto b = base->createBox(env);
   sptr<Box> deltaSymbol = sptrOf<StrutBox>(0.f, 0.f, 0.f, 0.f);
   if (_sub == nullptr && _sup == nullptr) return b;
 
   TeXFont* tf = env.getTeXFont().get();
   const TexStyle style = env.getStyle();
 
-  if (_base->_limitsType == LimitsType::limits ||
-      (_base->_limitsType == LimitsType::normal && style == TexStyle::display)) {
-    auto in = sptrOf<UnderOverAtom>(_base, _sub, UnitType::point, 0.3f, true, false);
+  if (base->_limitsType == LimitsType::limits ||
+      (base->_limitsType == LimitsType::normal && style == TexStyle::display)) {
+    auto in = sptrOf<UnderOverAtom>(base, _sub, UnitType::point, 0.3f, true, false);
     return UnderOverAtom(in, _sup, UnitType::point, 3.f, true, true).createBox(env);
   }
 
@@ -468,22 +490,24 @@ sptr<Box> ScriptsAtom::createBox(Environment& env) {
   // if no last font found (whitespace box), use default "mu font"
   if (lastFontId == TeXFont::NO_FONT) lastFontId = tf->getMuFontId();
 
-  Environment subStyle = *(env.subStyle()), supStyle = *(env.supStyle());
+  // the derived environments are reused, lay out in them rather than in copies
+  Environment& subStyle = *(env.subStyle());
+  Environment& supStyle = *(env.supStyle());
 
   // set delta and preliminary shift-up and shift-down values
   float delta = 0, shiftUp = 0, shiftDown = 0;
 
-  auto* acc = dynamic_cast<AccentedAtom*>(_base.get());
-  auto* sym = dynamic_cast<SymbolAtom*>(_base.get());
-  auto* cs = dynamic_cast<CharSymbol*>(_base.get());
+  auto* acc = dynamic_cast<AccentedAtom*>(base.get());
+  auto* sym = dynamic_cast<SymbolAtom*>(base.get());
+  auto* cs = dynamic_cast<CharSymbol*>(base.get());
   if (acc != nullptr) {
     // special case: accent
     auto box = acc->_base->createBox(*(env.crampStyle()));
     shiftUp = box->_height - tf->getSupDrop(supStyle.getStyle());
     shiftDown = box->_depth + tf->getSubDrop(subStyle.getStyle());
-  } else if (sym != nullptr && _base->_type == AtomType::bigOperator) {
+  } else if (sym != nullptr && base->_type == AtomType::bigOperator) {
     // single big operator symbol
-    Char c = tf->getChar(sym->getName(), style);
+    Char c = sym->getChar(*tf, style);
     // display style
     if (style < TexStyle::text && tf->hasNextLarger(c)) c = tf->getNextLarger(c, style);
     auto x = sptrOf<CharBox>(c);
@@ -501,8 +525,7 @@ sptr<Box> ScriptsAtom::createBox(Environment& env) {
     shiftDown = hor->_depth + tf->getSubDrop(subStyle.getStyle());
   } else if (cs != nullptr) {
     shiftUp = shiftDown = 0;
-    sptr<CharFont> pcf = cs->getCharFont(*tf);
-    CharFont& cf = *pcf;
+    const CharFont cf = cs->getCharFont(*tf);
     if (!cs->isMarkedAsTextSymbol() || !tf->hasSpace(cf.fontId)) {
       delta = tf->getChar(cf, style).getItalic();
     }
@@ -619,24 +642,15 @@ sptr<Box> BigOperatorAtom::createSideSets(Environment& env) {
   pa->_limitsType = LimitsType::noLimits;
   pa->_type = AtomType::bigOperator;
 
-  auto* l = dynamic_cast<ScriptsAtom*>(sl.get());
-  auto* r = dynamic_cast<ScriptsAtom*>(sr.get());
-
-  if (l != nullptr && l->_base == nullptr) {
-    l->_base = pa;
-    l->_align = Alignment::right;
-  }
-  if (r != nullptr && r->_base == nullptr) r->_base = pa;
-
   auto y = sptrOf<HBox>();
   float limitsShift = 0;
   if (sl != nullptr) {
-    auto lb = sl->createBox(env);
+    auto lb = SideSetsAtom::createScriptsBox(sl, pa, true, env);
     y->add(lb);
     limitsShift = lb->_width + opbox->_width / 2;
   }
   y->add(opbox);
-  if (sr != nullptr) y->add(sr->createBox(env));
+  if (sr != nullptr) y->add(SideSetsAtom::createScriptsBox(sr, pa, false, env));
 
   TeXFont* tf = env.getTeXFont().get();
   const TexStyle style = env.getStyle();
@@ -645,7 +659,7 @@ sptr<Box> BigOperatorAtom::createSideSets(Environment& env) {
   if (sb->_type == AtomType::bigOperator) {
     auto* sym = dynamic_cast<SymbolAtom*>(sb.get());
     if (sym != nullptr) {
-      Char c = tf->getChar(sym->getName(), style);
+      Char c = sym->getChar(*tf, style);
       delta = c.getItalic();
     }
   }
@@ -691,56 +705,54 @@ sptr<Box> BigOperatorAtom::createBox(Environment& env) {
   TeXFont* tf = env.getTeXFont().get();
   const TexStyle style = env.getStyle();
 
-  RowAtom* row = nullptr;
-  auto Base = _base;
+  // the operator is the last atom of a row, the row is laid out before it,
+  // work on a copy of the row since the atoms may be laid out again
+  sptr<RowAtom> row = nullptr;
+  sptr<Atom> base = _base;
 
   auto* ta = dynamic_cast<TypedAtom*>(_base.get());
   if (ta != nullptr) {
     auto atom = ta->getBase();
     auto* ra = dynamic_cast<RowAtom*>(atom.get());
     if (ra != nullptr && ra->_lookAtLastAtom && _base->_limitsType != LimitsType::limits) {
-      _base = ra->popLastAtom();
-      row = ra;
+      row = static_pointer_cast<RowAtom>(ra->clone());
+      base = row->popLastAtom();
     } else {
-      _base = atom;
+      base = atom;
     }
   }
 
   if ((_limitsSet && !_limits)
       || (!_limitsSet && style >= TexStyle::text)
-      || (_base->_limitsType == LimitsType::noLimits)
-      || (_base->_limitsType == LimitsType::normal && style >= TexStyle::text)
+      || (base->_limitsType == LimitsType::noLimits)
+      || (base->_limitsType == LimitsType::normal && style >= TexStyle::text)
     ) {
     // if explicitly set to not display as limits or if not set and
     // style is not display, then attach over and under as regular sub or
     // super script
     if (row != nullptr) {
-      row->add(sptrOf<ScriptsAtom>(_base, _under, _over));
-      auto b = row->createBox(env);
-      row->popLastAtom();
-      row->add(_base);
-      _base = Base;
-      return b;
+      row->add(sptrOf<ScriptsAtom>(base, _under, _over));
+      return row->createBox(env);
     }
-    return ScriptsAtom(_base, _under, _over).createBox(env);
+    return ScriptsAtom(base, _under, _over).createBox(env);
   }
 
   sptr<Box> y(nullptr);
   float delta;
 
-  auto* sym = dynamic_cast<SymbolAtom*>(_base.get());
-  if (sym != nullptr && _base->_type == AtomType::bigOperator) {
+  auto* sym = dynamic_cast<SymbolAtom*>(base.get());
+  if (sym != nullptr && base->_type == AtomType::bigOperator) {
     // single big operator symbol
-    Char c = tf->getChar(sym->getName(), style);
-    y = _base->createBox(env);
+    Char c = sym->getChar(*tf, style);
+    y = base->createBox(env);
     // include delta in width
     delta = c.getItalic();
   } else {
     delta = 0;
     auto in = (
-      _base == nullptr
+      base == nullptr
       ? sptrOf<StrutBox>(0.f, 0.f, 0.f, 0.f)
-      : _base->createBox(env)
+      : base->createBox(env)
     );
     y = sptrOf<HBox>(in);
   }
@@ -793,9 +805,7 @@ sptr<Box> BigOperatorAtom::createBox(Environment& env) {
 
   if (row != nullptr) {
     auto* hb = new HBox(row->createBox(env));
-    row->add(_base);
     hb->add(sptr<Box>(vBox));
-    _base = Base;
     return sptr<Box>(hb);
   }
   return sptr<Box>(vBox);
@@ -803,29 +813,33 @@ sptr<Box> BigOperatorAtom::createBox(Environment& env) {
 
 /*********************************** SideSetsAtom implementation **********************************/
 
+sptr<Box> SideSetsAtom::createScriptsBox(
+  const sptr<Atom>& scripts, const sptr<Atom>& base, bool left, Environment& env
+) {
+  if (scripts == nullptr) return nullptr;
+  auto* sa = dynamic_cast<ScriptsAtom*>(scripts.get());
+  if (sa == nullptr || sa->_base != nullptr) return scripts->createBox(env);
+  ScriptsAtom placed(*sa);
+  placed._base = base;
+  if (left) placed._align = Alignment::right;
+  return placed.createBox(env);
+}
+
 sptr<Box> SideSetsAtom::createBox(Environment& env) {
-  if (_base == nullptr) {
+  sptr<Atom> base = _base;
+  if (base == nullptr) {
     // create a phantom to place side-sets
     auto in = sptrOf<CharAtom>(L'M', "mathnormal");
-    _base = sptrOf<PhantomAtom>(in, false, true, true);
+    base = sptrOf<PhantomAtom>(in, false, true, true);
   }
 
-  auto bb = _base->createBox(env);
+  auto bb = base->createBox(env);
   auto pa = sptrOf<PlaceholderAtom>(0.f, bb->_height, bb->_depth, bb->_shift);
 
-  auto* l = dynamic_cast<ScriptsAtom*>(_left.get());
-  auto* r = dynamic_cast<ScriptsAtom*>(_right.get());
-
-  if (l != nullptr && l->_base == nullptr) {
-    l->_base = pa;
-    l->_align = Alignment::right;
-  }
-  if (r != nullptr && r->_base == nullptr) r->_base = pa;
-
   auto hb = new HBox();
-  if (_left != nullptr) hb->add(_left->createBox(env));
+  if (_left != nullptr) hb->add(createScriptsBox(_left, pa, true, env));
   hb->add(bb);
-  if (_right != nullptr) hb->add(_right->createBox(env));
+  if (_right != nullptr) hb->add(createScriptsBox(_right, pa, false, env));
 
   return sptr<Box>(hb);
 }
@@ -842,7 +856,8 @@ float OverUnderDelimiter::getMaxWidth(const Box* b, const Box* del, const Box* s
 
 sptr<Box> OverUnderDelimiter::createBox(Environment& env) {
   auto base = (_base == nullptr ? sptrOf<StrutBox>(0.f, 0.f, 0.f, 0.f) : _base->createBox(env));
-  sptr<Box> del = DelimiterFactory::create(_symbol->getName(), env, base->_width);
+  sptr<Box> del = DelimiterFactory::create(
+    _symbol->getChar(*env.getTeXFont(), env.getStyle()), env, base->_width);
   // TODO
   // no rotation needed
   del = sptrOf<RotateBox>(del, -90.f, Rotation::cc);
@@ -209,16 +209,12 @@ public:
 class MiddleAtom : public Atom {
 public:
   sptr<Atom> _base;
-  sptr<Box> _box;
 
   MiddleAtom() = delete;
 
-  explicit MiddleAtom(const sptr<Atom>& a)
-    : _base(a), _box(new StrutBox(0, 0, 0, 0)) {}
+  explicit MiddleAtom(const sptr<Atom>& a) : _base(a) {}
 
-  sptr<Box> createBox(Environment& env) override {
-    return _box;
-  }
+  sptr<Box> createBox(Environment& env) override;
 
   __decl_clone(MiddleAtom)
 };
@@ -272,6 +268,8 @@ public:
 /** An atom representing the foreground and background color of an other atom */
 class ColorAtom : public Atom, public Row {
 private:
+  // the colors defined while no MacroScope is active, the predefined ones live
+  // in a table sorted at compile time and are shadowed by these
   static std::map<std::string, color> _colors;
   static const color _default;
 
@@ -286,6 +284,8 @@ public:
 
   sptr<Box> createBox(Environment& env) override;
 
+  sptr<Box> createBox(Environment& env, AtomType previous) override;
+
   AtomType leftType() const override {
     return _elements->leftType();
   }
@@ -294,10 +294,6 @@ public:
     return _elements->rightType();
   }
 
-  void setPreviousAtom(const sptr<Dummy>& prev) override {
-    _elements->setPreviousAtom(prev);
-  }
-
   /**
    * Parse color from given name. The name can be one of the following format:
    * [#AARRGGBB] or [AARRGGBB], [gray color], [c,m,y,k], [c;m;y;k], [r,g,b], [r;g;b]
@@ -347,12 +343,10 @@ public:
     return _elements->rightType();
   }
 
-  void setPreviousAtom(const sptr<Dummy>& prev) override {
-    _elements->setPreviousAtom(prev);
-  }
-
   sptr<Box> createBox(Environment& env) override;
 
+  sptr<Box> createBox(Environment& env, AtomType previous) override;
+
   __decl_clone(PhantomAtom)
 };
 
@@ -376,8 +370,11 @@ public:
   }
 
   sptr<Atom> getBase() {
-    _atom->_limitsType = _limitsType;
-    return _atom;
+    if (_atom->_limitsType == _limitsType) return _atom;
+    // the atom may be shared (e.g. a symbol), never change it in place
+    auto base = _atom->clone();
+    base->_limitsType = _limitsType;
+    return base;
   }
 
   sptr<Box> createBox(Environment& env) override {
@@ -651,6 +648,21 @@ public:
 
   sptr<Box> createBox(Environment& env) override;
 
+  /**
+   * Create the box of the given side scripts, placed on the given base if they
+   * have none. The scripts are not modified, since the base depends on the
+   * layout.
+   *
+   * @param scripts the side scripts, nullptr if none
+   * @param base the placeholder of the base
+   * @param left if the scripts are on the left side
+   * @param env the environment to lay out in
+   * @return the box of the scripts, nullptr if none
+   */
+  static sptr<Box> createScriptsBox(
+    const sptr<Atom>& scripts, const sptr<Atom>& base, bool left, Environment& env
+  );
+
   __decl_clone(SideSetsAtom)
 };
 
@@ -12,12 +12,13 @@ using namespace std;
 sptr<Box> FixedCharAtom::createBox(Environment& env) {
   const auto& i = env.getTeXFont();
   TeXFont& tf = *i;
-  Char c = tf.getChar(*_cf, env.getStyle());
+  Char c = tf.getChar(_cf, env.getStyle());
   return sptrOf<CharBox>(c);
 }
 
 SymbolAtom::SymbolAtom(const string& name, AtomType type, bool del) noexcept: _unicode(0) {
   _name = name;
+  _id = DefaultTeXFont::symbolId(name);
   _type = type;
   if (type == AtomType::bigOperator) _limitsType = LimitsType::normal;
 }
@@ -26,7 +27,7 @@ sptr<Box> SymbolAtom::createBox(Environment& env) {
   const auto& i = env.getTeXFont();
   TeXFont& tf = *i;
   TexStyle style = env.getStyle();
-  Char c = tf.getChar(_name, style);
+  Char c = getChar(tf, style);
   sptr<Box> cb = sptrOf<CharBox>(c);
   if (env.getSmallCap() && _unicode != 0 && islower(_unicode)) {
     // find if exists in mapping
@@ -70,13 +71,23 @@ sptr<SymbolAtom> SymbolAtom::get(const string& name) {
   return it->second;
 }
 
-Char CharAtom::getChar(TeXFont& tf, TexStyle style, bool smallCap) {
+sptr<SymbolAtom> SymbolAtom::find(const string& name) {
+  auto it = _symbols.find(name);
+  if (it == _symbols.end()) return nullptr;
+  return it->second;
+}
+
+void SymbolAtom::resolveIds() {
+  for (auto& i : _symbols) i.second->_id = DefaultTeXFont::symbolId(i.first);
+}
+
+Char CharAtom::getChar(TeXFont& tf, TexStyle style, bool smallCap, const string& textStyle) {
   wchar_t chr = _c;
   if (smallCap) {
     if (islower(_c)) chr = toupper(_c);
   }
-  if (_textStyle.empty()) return tf.getDefaultChar(chr, style);
-  return tf.getChar(chr, _textStyle, style);
+  if (textStyle.empty()) return tf.getDefaultChar(chr, style);
+  return tf.getChar(chr, textStyle, style);
 }
 
 //sptr<CharFont> CharAtom::getCharFont(TeXFont& tf) {
@@ -85,12 +96,11 @@ Char CharAtom::getChar(TeXFont& tf, TexStyle style, bool smallCap) {
 //}
 
 sptr<Box> CharAtom::createBox(Environment& env) {
-  if (_textStyle.empty()) {
-    const string& ts = env.getTextStyle();
-    if (!ts.empty()) _textStyle = ts;
-  }
+  // the atom may be shared (e.g. by the cached formulas), take the text style
+  // of the environment without storing it
+  const string& textStyle = _textStyle.empty() ? env.getTextStyle() : _textStyle;
   bool smallCap = env.getSmallCap();
-  Char ch = getChar(*env.getTeXFont(), env.getStyle(), smallCap);
+  Char ch = getChar(*env.getTeXFont(), env.getStyle(), smallCap, textStyle);
   sptr<Box> box = sptrOf<CharBox>(ch);
   if (smallCap && islower(_c)) {
     // we have a small capital
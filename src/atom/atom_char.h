@@ -56,23 +56,23 @@ public:
    * @param tf the TeXFont containing all font related information
    * @return a CharFont
    */
-  virtual sptr<CharFont> getCharFont(TeXFont& tf) = 0;
+  virtual CharFont getCharFont(TeXFont& tf) = 0;
 };
 
 /** An atom representing a fixed character (not depending on a text style). */
 class FixedCharAtom : public CharSymbol {
 private:
-  const sptr<CharFont> _cf;
+  const CharFont _cf;
 
 public:
   FixedCharAtom() = delete;
 
-  explicit FixedCharAtom(const sptr<CharFont>& c) : _cf(c) {}
+  explicit FixedCharAtom(const CharFont& c) : _cf(c) {}
 
   // FIXME
   // workaround for the MSVS's LNK2019 error
   // it should be implemented in the atom_char.cpp file
-  sptr<CharFont> getCharFont(TeXFont& tf) override {
+  CharFont getCharFont(TeXFont& tf) override {
     return _cf;
   }
 
@@ -86,6 +86,8 @@ private:
 
   // symbol name
   std::string _name;
+  // interned id of the symbol, -1 if not resolved
+  int _id;
   wchar_t _unicode;
 
 public:
@@ -117,13 +119,22 @@ public:
     return _name;
   }
 
+  inline int getId() const {
+    return _id;
+  }
+
+  /** Get the Char-object of this symbol in the given style */
+  inline Char getChar(TeXFont& tf, TexStyle style) const {
+    return _id >= 0 ? tf.getChar(_id, style) : tf.getChar(_name, style);
+  }
+
   sptr<Box> createBox(Environment& env) override;
 
   // FIXME
   // workaround for the MSVS's LNK2019 error
   // it should be implemented in the atom_char.cpp file
-  sptr<CharFont> getCharFont(TeXFont& tf) override {
-    return tf.getChar(_name, TexStyle::display).getCharFont();
+  CharFont getCharFont(TeXFont& tf) override {
+    return getChar(tf, TexStyle::display).getCharFont();
   }
 
   static void addSymbolAtom(const std::string& file);
@@ -141,6 +152,19 @@ public:
    */
   static sptr<SymbolAtom> get(const std::string& name);
 
+  /**
+   * Same as #get(name) but return nullptr instead of throwing if no symbol
+   * with the given name was found.
+   */
+  static sptr<SymbolAtom> find(const std::string& name);
+
+  /**
+   * Resolve the interned ids of all the defined symbols, must be called after
+   * the symbol mappings of the fonts changed. The symbols without id fall back
+   * to the lookup by name.
+   */
+  static void resolveIds();
+
   __decl_clone(SymbolAtom)
 };
 
@@ -157,10 +181,11 @@ private:
   bool _mathMode;
 
   /**
-   * Get the Char-object representing this character ("c") in the right text
-   * style
+   * Get the Char-object representing this character ("c") in the given text
+   * style (empty means the default text style). Unlike the symbols, the text
+   * style is not interned, its mapping is looked up by name.
    */
-  Char getChar(TeXFont& tf, TexStyle style, bool smallCap);
+  Char getChar(TeXFont& tf, TexStyle style, bool smallCap, const std::string& textStyle);
 
 public:
   CharAtom() = delete;
@@ -191,8 +216,8 @@ public:
   // FIXME
   // workaround for the MSVS's LNK2019 error
   // it should be implemented in the atom_char.cpp file
-  sptr<CharFont> getCharFont(TeXFont& tf) override {
-    return getChar(tf, TexStyle::display, false).getCharFont();
+  CharFont getCharFont(TeXFont& tf) override {
+    return getChar(tf, TexStyle::display, false, _textStyle).getCharFont();
   }
 
   __decl_clone(CharAtom)
@@ -8,8 +8,8 @@ using namespace tex;
 /**************************************** small atoms *********************************************/
 
 const float FBoxAtom::INTERSPACE = 0.65f;
-float OvalAtom::_multiplier = 0.5f;
-float OvalAtom::_diameter = 0.f;
+thread_local float OvalAtom::_multiplier = 0.5f;
+thread_local float OvalAtom::_diameter = 0.f;
 
 const int FencedAtom::DELIMITER_FACTOR = 901;
 const float FencedAtom::DELIMITER_SHORTFALL = 5.f;
@@ -19,6 +19,9 @@ void FencedAtom::init(const sptr<Atom>& b, const sptr<SymbolAtom>& l, const sptr
     _base = sptrOf<RowAtom>();
   else
     _base = b;
+  // can not break
+  auto* ra = dynamic_cast<RowAtom*>(_base.get());
+  if (ra != nullptr) ra->setBreakable(false);
   if (l == nullptr || l->getName() != "normaldot") _left = l;
   if (r == nullptr || r->getName() != "normaldot") _right = r;
 }
@@ -30,9 +33,6 @@ void FencedAtom::center(Box& b, float axis) {
 
 sptr<Box> FencedAtom::createBox(Environment& env) {
   TeXFont& tf = *(env.getTeXFont());
-  // can not break
-  auto* ra = dynamic_cast<RowAtom*>(_base.get());
-  if (ra != nullptr) ra->setBreakable(false);
   auto content = _base->createBox(env);
   float shortfall = DELIMITER_SHORTFALL * SpaceAtom::getFactor(UnitType::point, env);
   float axis = tf.getAxisHeight(env.getStyle());
@@ -42,20 +42,25 @@ sptr<Box> FencedAtom::createBox(Environment& env) {
   auto* hb = new HBox();
 
   if (!_middle.empty()) {
+    // the middle delimiters are sized after the content, then the content is
+    // laid out again with them
+    vector<pair<const Atom*, sptr<Box>>> middles;
     for (const auto& atom : _middle) {
       auto* sym = dynamic_cast<SymbolAtom*>(atom->_base.get());
       if (sym != nullptr) {
-        auto b = DelimiterFactory::create(sym->getName(), env, minh);
+        auto b = DelimiterFactory::create(sym->getChar(tf, env.getStyle()), env, minh);
         center(*b, axis);
-        atom->_box = b;
+        middles.emplace_back(atom.get(), b);
       }
     }
-    if (!_middle.empty()) content = _base->createBox(env);
+    const auto prev = env.setMiddleBoxes(&middles);
+    content = _base->createBox(env);
+    env.setMiddleBoxes(prev);
   }
 
   // left delimiter
   if (_left != nullptr) {
-    auto b = DelimiterFactory::create(_left->getName(), env, minh);
+    auto b = DelimiterFactory::create(_left->getChar(tf, env.getStyle()), env, minh);
     center(*b, axis);
     hb->add(b);
   }
@@ -72,7 +77,7 @@ sptr<Box> FencedAtom::createBox(Environment& env) {
 
   // right delimiter
   if (_right != nullptr) {
-    auto b = DelimiterFactory::create(_right->getName(), env, minh);
+    auto b = DelimiterFactory::create(_right->getChar(tf, env.getStyle()), env, minh);
     center(*b, axis);
     hb->add(b);
   }
@@ -102,8 +107,11 @@ sptr<Box> FractionAtom::createBox(Environment& env) {
   TexStyle style = env.getStyle();
   // set thickness to default if default value should be use
   float drt = tf.getDefaultRuleThickness(style);
-  if (_nodefault) _thickness *= SpaceAtom::getFactor(_unit, env);
-  else _thickness = _deffactorset ? _deffactor * drt : drt;
+  const float thickness = (
+    _nodefault
+    ? _thickness * SpaceAtom::getFactor(_unit, env)
+    : (_deffactorset ? _deffactor * drt : drt)
+  );
 
   // create equal width boxes in appropriate styles
   auto num = (
@@ -127,7 +135,7 @@ sptr<Box> FractionAtom::createBox(Environment& env) {
     shiftdown = tf.getDenom1(style);
   } else {
     shiftdown = tf.getDenom2(style);
-    if (_thickness > 0) shiftup = tf.getNum2(style);
+    if (thickness > 0) shiftup = tf.getNum2(style);
     else shiftup = tf.getNum3(style);
   }
 
@@ -138,14 +146,14 @@ sptr<Box> FractionAtom::createBox(Environment& env) {
   // calculate clearance clr, adjust shift amounts and create vertical box
   float clr, delta, axis = tf.getAxisHeight(style);
 
-  if (_thickness > 0) {
+  if (thickness > 0) {
     // with fraction rule
     // clearance clr
-    if (style < TexStyle::text) clr = 3 * _thickness;
-    else clr = _thickness;
+    if (style < TexStyle::text) clr = 3 * thickness;
+    else clr = thickness;
 
     // adjust shift amount
-    delta = _thickness / 2.f;
+    delta = thickness / 2.f;
     float kern1 = shiftup - num->_depth - (axis + delta);
     float kern2 = axis - delta - (denom->_height - shiftdown);
     float delta1 = clr - kern1;
@@ -161,7 +169,7 @@ sptr<Box> FractionAtom::createBox(Environment& env) {
 
     // fill vertical box
     vb->add(sptrOf<StrutBox>(0.f, kern1, 0.f, 0.f));
-    vb->add(sptrOf<RuleBox>(_thickness, num->_width, 0.f));
+    vb->add(sptrOf<RuleBox>(thickness, num->_width, 0.f));
     vb->add(sptrOf<StrutBox>(0.f, kern2, 0.f, 0.f));
   } else {
     // without fraction rule
@@ -203,7 +211,9 @@ sptr<Box> NthRoot::createBox(Environment& env) {
   TexStyle style = env.getStyle();
   // calculate minimum clearance clr
   float clr, drt = tf.getDefaultRuleThickness(style);
-  if (style < TexStyle::text) clr = tf.getXHeight(style, tf.getChar(_sqrtSymbol, style).getFontCode());
+  static const int sqrtId = DefaultTeXFont::symbolId(_sqrtSymbol);
+  const Char sign = tf.getChar(sqrtId, style);
+  if (style < TexStyle::text) clr = tf.getXHeight(style, sign.getFontCode());
   else clr = drt;
   clr = drt + abs(clr) / 4.f;
 
@@ -215,7 +225,7 @@ sptr<Box> NthRoot::createBox(Environment& env) {
 
   // create root sign
   float totalH = b->_height + b->_depth;
-  auto rootSign = DelimiterFactory::create(_sqrtSymbol, env, totalH + clr + drt);
+  auto rootSign = DelimiterFactory::create(sign, env, totalH + clr + drt);
 
   // add half the excess to clr
   float delta = rootSign->_depth - (totalH + clr);
@@ -76,7 +76,8 @@ public:
     auto b = _base->createBox(env);
     auto* vb = new VBox();
     vb->add(b);
-    Char ch = env.getTeXFont()->getChar("mathcedilla", env.getStyle());
+    static const int cedillaId = DefaultTeXFont::symbolId("mathcedilla");
+    Char ch = env.getTeXFont()->getChar(cedillaId, env.getStyle());
     float italic = ch.getItalic();
     Box* cedilla = new CharBox(ch);
     Box* y;
@@ -103,11 +104,20 @@ public:
 
 /** An atom representing ddots */
 class DdtosAtom : public Atom {
+private:
+  // the \ldots the dots are as wide as, parsed with the macros of the formula
+  sptr<Atom> _ldots;
+
 public:
+  DdtosAtom() = delete;
+
+  explicit DdtosAtom(const sptr<Atom>& ldots) : _ldots(ldots) {}
+
   sptr<Box> createBox(Environment& env) override {
-    auto ldots = Formula::get(L"ldots")->_root->createBox(env);
+    auto ldots = _ldots->createBox(env);
     float w = ldots->_width;
-    auto dot = SymbolAtom::get("ldotp")->createBox(env);
+    static const int ldotpId = DefaultTeXFont::symbolId("ldotp");
+    sptr<Box> dot = sptrOf<CharBox>(env.getTeXFont()->getChar(ldotpId, env.getStyle()));
     auto* hb1 = new HBox(dot, w, Alignment::left);
     auto* hb2 = new HBox(dot, w, Alignment::center);
     auto* hb3 = new HBox(dot, w, Alignment::right);
@@ -200,8 +210,8 @@ public:
  */
 class OvalAtom : public FBoxAtom {
 public:
-  static float _multiplier;
-  static float _diameter;
+  static thread_local float _multiplier;
+  static thread_local float _diameter;
 
   OvalAtom() = delete;
 
@@ -350,11 +360,20 @@ public:
 
 /** An atom representing id-dots */
 class IddotsAtom : public Atom {
+private:
+  // the \ldots the dots are as wide as, parsed with the macros of the formula
+  sptr<Atom> _ldots;
+
 public:
+  IddotsAtom() = delete;
+
+  explicit IddotsAtom(const sptr<Atom>& ldots) : _ldots(ldots) {}
+
   sptr<Box> createBox(Environment& env) override {
-    auto ldots = Formula::get(L"ldots")->_root->createBox(env);
+    auto ldots = _ldots->createBox(env);
     float w = ldots->_width;
-    auto dot = SymbolAtom::get("ldotp")->createBox(env);
+    static const int ldotpId = DefaultTeXFont::symbolId("ldotp");
+    sptr<Box> dot = sptrOf<CharBox>(env.getTeXFont()->getChar(ldotpId, env.getStyle()));
     sptr<Box> hb1(new HBox(dot, w, Alignment::right));
     sptr<Box> hb2(new HBox(dot, w, Alignment::center));
     sptr<Box> hb3(new HBox(dot, w, Alignment::left));
@@ -472,7 +491,8 @@ public:
   explicit LCaronAtom(bool upper) : _upper(upper) {}
 
   sptr<Box> createBox(Environment& env) override {
-    auto* A = new CharBox(env.getTeXFont()->getChar("textapos", env.getStyle()));
+    static const int aposId = DefaultTeXFont::symbolId("textapos");
+    auto* A = new CharBox(env.getTeXFont()->getChar(aposId, env.getStyle()));
     auto* L = new CharBox(env.getTeXFont()->getChar(_upper ? 'L' : 'l', "mathnormal", env.getStyle()));
     auto* hb = new HBox(sptr<Box>(L));
     if (_upper)
@@ -523,7 +543,8 @@ public:
     auto b = _base->createBox(env);
     auto* vb = new VBox();
     vb->add(b);
-    Char ch = env.getTeXFont()->getChar("ogonek", env.getStyle());
+    static const int ogonekId = DefaultTeXFont::symbolId("ogonek");
+    Char ch = env.getTeXFont()->getChar(ogonekId, env.getStyle());
     float italic = ch.getItalic();
     Box* ogonek = new CharBox(ch);
     Box* y = nullptr;
@@ -651,10 +672,10 @@ public:
     _type = base->_type;
     _base = base;
     _keepAspectRatio = keepAspectRatio;
-    auto[wu, w] = SpaceAtom::getLength(ws);
-    auto[hu, h] = SpaceAtom::getLength(hs);
-    _wu = wu, _w = w;
-    _hu = hu, _h = h;
+    const auto w = SpaceAtom::getLength(ws);
+    const auto h = SpaceAtom::getLength(hs);
+    _wu = w.first, _w = w.second;
+    _hu = h.first, _h = h.second;
   }
 
   AtomType leftType() const override { return _base->leftType(); }
@@ -852,7 +873,8 @@ public:
 class TCaronAtom : public Atom {
 public:
   sptr<Box> createBox(Environment& env) override {
-    Char a = env.getTeXFont()->getChar("textapos", env.getStyle());
+    static const int aposId = DefaultTeXFont::symbolId("textapos");
+    Char a = env.getTeXFont()->getChar(aposId, env.getStyle());
     auto* A = new CharBox(a);
     Char t = env.getTeXFont()->getChar('t', "mathnormal", env.getStyle());
     auto* T = new CharBox(t);
@@ -875,7 +897,8 @@ public:
   explicit TextCircledAtom(const sptr<Atom>& a) : _at(a) {}
 
   sptr<Box> createBox(Environment& env) override {
-    auto circle = SymbolAtom::get("bigcirc")->createBox(env);
+    static const int bigcircId = DefaultTeXFont::symbolId("bigcirc");
+    sptr<Box> circle = sptrOf<CharBox>(env.getTeXFont()->getChar(bigcircId, env.getStyle()));
     circle->_shift = -0.07f * SpaceAtom::getFactor(UnitType::ex, env);
     auto box = _at->createBox(env);
     auto* hb = new HBox(box, circle->_width, Alignment::center);
@@ -920,7 +943,8 @@ public:
   explicit TStrokeAtom(bool u) : _upper(u) {}
 
   sptr<Box> createBox(Environment& env) override {
-    Char ch = env.getTeXFont()->getChar("bar", env.getStyle());
+    static const int barId = DefaultTeXFont::symbolId("bar");
+    Char ch = env.getTeXFont()->getChar(barId, env.getStyle());
     float italic = ch.getItalic();
     Char t = env.getTeXFont()->getChar(_upper ? 'T' : 't', "mathnormal", env.getStyle());
     auto* T = new CharBox(t);
@@ -1067,7 +1091,8 @@ public:
 class VdotsAtom : public Atom {
 public:
   sptr<Box> createBox(Environment& env) override {
-    auto dot = SymbolAtom::get("ldotp")->createBox(env);
+    static const int ldotpId = DefaultTeXFont::symbolId("ldotp");
+    sptr<Box> dot = sptrOf<CharBox>(env.getTeXFont()->getChar(ldotpId, env.getStyle()));
     auto* vb = new VBox(dot, 0, Alignment::bottom);
     auto b = SpaceAtom(UnitType::mu, 0, 4, 0).createBox(env);
     vb->add(b);
@@ -1,12 +1,32 @@
+#include <map>
 #include <memory>
+#include <mutex>
 
 #include "atom/atom_impl.h"
+#include "core/layout_cache.h"
+#include "core/macro.h"
+#include "core/render_state.h"
+#include "utils/arena.h"
+#include "utils/thread_pool.h"
 
 using namespace std;
 using namespace tex;
 
 color MatrixAtom::LINE_COLOR = transparent;
 
+// the pools shared by the large matrices to lay out their cells, one per count
+// of threads, one matrix at a time, the others (nested or on other threads)
+// are laid out sequentially
+static mutex cellPoolMutex;
+
+static ThreadPool& cellPool(size_t threads) {
+  // guarded by cellPoolMutex
+  static map<size_t, unique_ptr<ThreadPool>> pools;
+  auto& pool = pools[threads];
+  if (pool == nullptr) pool.reset(new ThreadPool(threads));
+  return *pool;
+}
+
 map<wstring, wstring> MatrixAtom::_colspeReplacement;
 
 SpaceAtom MatrixAtom::_hsep(UnitType::em, 1.f, 0.f, 0.f);
@@ -19,7 +39,20 @@ SpaceAtom MatrixAtom::_align(SpaceType::medMuSkip);
 sptr<Box> MatrixAtom::_nullbox(new StrutBox(0.f, 0.f, 0.f, 0.f));
 
 void MatrixAtom::defineColumnSpecifier(const wstring& rep, const wstring& spe) {
-  _colspeReplacement[rep] = spe;
+  MacroScope* scope = MacroScope::current();
+  auto& replacement = scope == nullptr ? _colspeReplacement : scope->_columnSpecifiers;
+  replacement[rep] = spe;
+  MacroScope::record(rep, spe);
+}
+
+const wstring* MatrixAtom::findColumnSpecifier(const wstring& rep) {
+  MacroScope* scope = MacroScope::current();
+  if (scope != nullptr) {
+    auto it = scope->_columnSpecifiers.find(rep);
+    if (it != scope->_columnSpecifiers.end()) return &it->second;
+  }
+  auto it = _colspeReplacement.find(rep);
+  return it == _colspeReplacement.end() ? nullptr : &it->second;
 }
 
 void MatrixAtom::parsePositions(wstring opt, vector<Alignment>& lpos) {
@@ -103,10 +136,10 @@ void MatrixAtom::parsePositions(wstring opt, vector<Alignment>& lpos) {
         int spos = len + 1;
         bool hasrep = false;
         while (--spos > pos) {
-          auto it = _colspeReplacement.find(opt.substr(pos, spos - pos));
-          if (it != _colspeReplacement.end()) {
+          const wstring* rep = findColumnSpecifier(opt.substr(pos, spos - pos));
+          if (rep != nullptr) {
             hasrep = true;
-            opt.insert(spos, it->second);
+            opt.insert(spos, *rep);
             len = opt.length();
             pos = spos - 1;
             break;
@@ -124,9 +157,9 @@ void MatrixAtom::parsePositions(wstring opt, vector<Alignment>& lpos) {
   if (lpos.empty()) lpos.push_back(Alignment::center);
 }
 
-float* MatrixAtom::getColumnSep(Environment& env, float width) {
+vector<float> MatrixAtom::getColumnSep(Environment& env, float width) {
   const int cols = _matrix->cols();
-  auto* arr = new float[cols + 1]();
+  vector<float> arr(cols + 1);
   sptr<Box> Align, AlignSep, Hsep;
   float h, w = env.getTextWidth();
   int i = 0;
@@ -234,19 +267,19 @@ float* MatrixAtom::getColumnSep(Environment& env, float width) {
 
 void MatrixAtom::recalculateLine(
   const int rows,
-  sptr<Box>** boxarr,
-  vector<sptr<Atom>>& multiRows,
+  CellBoxes& boxarr,
+  const vector<MultiCell>& multiRows,
   float* height,
   float* depth,
   float drt,
   float vspace
 ) {
-  const size_t s = multiRows.size();
-  for (size_t i = 0; i < s; i++) {
-    auto* m = (MultiRowAtom*) multiRows[i].get();
-    const int r = m->_i;
-    const int c = m->_j;
-    int n = m->_n;
+  for (const auto& cell : multiRows) {
+    auto* m = (MultiRowAtom*) cell.atom;
+    const int r = cell.row;
+    const int c = cell.col;
+    // work on copies, the atom may be laid out again
+    int top = r, n = m->_n;
     int skipped = 0;
     float h = 0;
     if (n < 0) {
@@ -262,7 +295,7 @@ void MatrixAtom::recalculateLine(
           h += height[j] + depth[j] + vspace;
         }
       }
-      m->_i = ++j;
+      top = ++j;
       auto tmp = boxarr[r][c];
       boxarr[r][c] = boxarr[j][c];
       boxarr[j][c] = tmp;
@@ -279,24 +312,24 @@ void MatrixAtom::recalculateLine(
         }
       }
     }
-    m->_n = abs(n);
-    auto b = boxarr[m->_i][m->_j];
+    n = abs(n);
+    auto b = boxarr[top][c];
     const float bh = b->_height + b->_depth + vspace;
     if (h > bh) {
       b->_height = (h - bh + vspace) / 2.f;
     } else if (h < bh) {
       const float ex = (bh - h) / skipped / 2.f;
-      const int mr = m->_i + m->_n;
-      for (int j = m->_i; j < mr; j++) {
+      const int mr = top + n;
+      for (int j = top; j < mr; j++) {
         if (boxarr[j][0]->_type != AtomType::hline) {
           height[j] += ex;
           depth[j] += ex;
         }
       }
-      b->_height = height[m->_i];
+      b->_height = height[top];
       b->_depth = bh - b->_height - vspace;
     }
-    boxarr[m->_i][m->_j]->_type = AtomType::none;
+    boxarr[top][c]->_type = AtomType::none;
   }
 }
 
@@ -309,7 +342,7 @@ sptr<Box> MatrixAtom::generateMulticolumn(
   int j
 ) {
   float w = 0;
-  auto* mca = (MulticolumnAtom*) (_matrix->_array[i][j].get());
+  auto* mca = (MulticolumnAtom*) _matrix->get(i, j).get();
   int k, n = mca->skipped();
   for (k = j; k < j + n - 1; k++) {
     w += colWidth[k] + hsep[k + 1];
@@ -318,10 +351,7 @@ sptr<Box> MatrixAtom::generateMulticolumn(
   }
   w += colWidth[k];
 
-  if (mca->isNeedWidth() && mca->colWidth() <= PREC) {
-    mca->setColWidth(w);
-    return mca->createBox(env);
-  }
+  if (mca->isNeedWidth()) return mca->createBox(env, w);
 
   if (b->_width >= w) return b;
 
@@ -390,84 +420,149 @@ void MatrixAtom::applyCell(WrapperBox& box, int i, int j) {
     for (const auto& s : row->second) s->apply(box);
   }
   // 3. cell specifier
-  const string key = tostring(i) + tostring(j);
-  auto cell = _matrix->_cellSpecifiers.find(key);
+  const auto cell = _matrix->_cellSpecifiers.find({i, j});
   if (cell != _matrix->_cellSpecifiers.end()) {
     for (const auto& s : cell->second) s->apply(box);
   }
 }
 
+void MatrixAtom::createCells(Environment& env, CellBoxes& boxarr, float* height, float* depth, float* width) {
+  const int rows = _matrix->rows();
+  const int cols = _matrix->cols();
+  const size_t count = (size_t) rows * cols;
+  // every cell starts from the font used before the matrix, so the cells do
+  // not depend on each other and can be laid out in any order
+  const int fontId = env.getLastFontId();
+
+  const auto layout = [&](Environment& e, int i, int j) {
+    e.setLastFontId(fontId);
+    const sptr<Atom>& atom = _matrix->get(i, j);
+    if (atom == nullptr) return _nullbox;
+    auto box = atom->createBox(e);
+    if (atom->_type == AtomType::interText) box->_type = AtomType::interText;
+    return box;
+  };
+
+  const auto extend = [](const Box& box, int i, int j, float* h, float* d, float* w) {
+    if (box._type != AtomType::multiRow) {
+      // Find the highest line (row)
+      d[i] = max(box._depth, d[i]);
+      h[i] = max(box._height, h[i]);
+    }
+    if (box._type != AtomType::multiColumn) {
+      // Find the widest column
+      w[j] = max(box._width, w[j]);
+    }
+  };
+
+  const ParallelCells& parallel = RenderState::parallelCells();
+  unique_lock<mutex> lock(cellPoolMutex, defer_lock);
+  ThreadPool* pool = nullptr;
+  if (parallel.cells != 0 && count >= parallel.cells && lock.try_lock()) {
+    pool = &cellPool(parallel.threads);
+    if (pool->size() < 2) {
+      pool = nullptr;
+      lock.unlock();
+    }
+  }
+
+  if (pool == nullptr) {
+    int lastFontId = fontId;
+    for (int i = 0; i < rows; i++) {
+      for (int j = 0; j < cols; j++) {
+        boxarr[i][j] = layout(env, i, j);
+        extend(*boxarr[i][j], i, j, height, depth, width);
+        if (env.getLastFontId() != fontId) lastFontId = env.getLastFontId();
+      }
+    }
+    env.setLastFontId(lastFontId);
+    return;
+  }
+
+  // the workers lay out with the state of this thread, each one with its own
+  // environment, arena and layout cache, and keeps its own extents, reduced
+  // once all the cells are laid out
+  const RenderState state;
+  const size_t workers = pool->size(), stride = 2 * rows + cols;
+  vector<sptr<Environment>> envs(workers);
+  vector<sptr<Arena>> arenas(workers);
+  vector<unique_ptr<LayoutCache>> caches(workers);
+  vector<float> extents(workers * stride, 0.f);
+  vector<int> fontIds(count);
+  pool->forEach(count, [&](size_t k, size_t w) {
+    if (envs[w] == nullptr) {
+      envs[w] = env.detach();
+      if (state.usesArena()) arenas[w] = std::make_shared<Arena>();
+      if (state.memoizes()) caches[w].reset(new LayoutCache());
+    }
+    RenderStateScope scope(state, arenas[w].get(), caches[w].get());
+    const int i = k / cols, j = k % cols;
+    boxarr[i][j] = layout(*envs[w], i, j);
+    fontIds[k] = envs[w]->getLastFontId();
+    float* h = &extents[w * stride];
+    extend(*boxarr[i][j], i, j, h, h + rows, h + 2 * rows);
+  });
+
+  for (size_t w = 0; w < workers; w++) {
+    const float* h = &extents[w * stride];
+    for (int i = 0; i < rows; i++) {
+      height[i] = max(h[i], height[i]);
+      depth[i] = max(h[rows + i], depth[i]);
+    }
+    for (int j = 0; j < cols; j++) width[j] = max(h[2 * rows + j], width[j]);
+  }
+
+  int lastFontId = fontId;
+  for (const int id : fontIds) {
+    if (id != fontId) lastFontId = id;
+  }
+  env.setLastFontId(lastFontId);
+}
+
 sptr<Box> MatrixAtom::createBox(Environment& e) {
   Environment& env = e;
   const int rows = _matrix->rows();
   const int cols = _matrix->cols();
 
-  auto* lineDepth = new float[rows]();
-  auto* lineHeight = new float[rows]();
-  auto* colWidth = new float[cols]();
-  auto** boxarr = new sptr<Box>* [rows]();
-  for (int i = 0; i < rows; i++) boxarr[i] = new sptr<Box>[cols]();
+  vector<float> lineDepth(rows), lineHeight(rows), colWidth(cols);
+  CellBoxes boxarr(rows, cols);
 
   float matW = 0;
   float drt = env.getTeXFont()->getDefaultRuleThickness(env.getStyle());
 
   if (_matType == MatrixType::smallMatrix) {
-    env = *(e.copy());
+    // hold the copy, the assignment replaces the member that owns it
+    const sptr<Environment> copy = e.copy();
+    env = *copy;
     env.setStyle(TexStyle::script);
   } /* else if (_matType == MatrixType::matrix) {
     env = *(e.copy());
     env.setStyle(STYLE_TEXT);
   }*/
 
+  createCells(env, boxarr, lineHeight.data(), lineDepth.data(), colWidth.data());
+
   // multi-column & multi-row atoms
-  vector<sptr<Atom>> listMultiCol;
-  vector<sptr<Atom>> listMultiRow;
+  vector<MultiCell> listMultiCol;
+  vector<MultiCell> listMultiRow;
   for (int i = 0; i < rows; i++) {
-    lineDepth[i] = 0;
-    lineHeight[i] = 0;
-    const int size = _matrix->_array[i].size();
-    for (int j = 0; j < cols; j++) {
-      if (j >= size) {
-        // If current row is not full-filled, fill the row with _nullbox
-        for (int k = j; k < cols; k++) boxarr[i][k] = _nullbox;
-        break;
-      }
-
-      sptr<Atom> atom = _matrix->_array[i][j];
-      boxarr[i][j] = (atom == nullptr) ? _nullbox : atom->createBox(env);
-      if (atom != nullptr && atom->_type == AtomType::interText) {
-        boxarr[i][j]->_type = AtomType::interText;
-      }
-
-      if (boxarr[i][j]->_type != AtomType::multiRow) {
-        // Find the highest line (row)
-        lineDepth[i] = max(boxarr[i][j]->_depth, lineDepth[i]);
-        lineHeight[i] = max(boxarr[i][j]->_height, lineHeight[i]);
-      } else {
-        auto* mra = (MultiRowAtom*) atom.get();
-        mra->setRowColumn(i, j);
-        listMultiRow.push_back(atom);
-      }
-
-      if (boxarr[i][j]->_type != AtomType::multiColumn) {
-        // Find the widest column
-        colWidth[j] = max(boxarr[i][j]->_width, colWidth[j]);
-      } else {
-        auto* mca = (MulticolumnAtom*) atom.get();
-        mca->setRowColumn(i, j);
-        listMultiCol.push_back(atom);
-      }
+    const int size = min(_matrix->rowSize(i), cols);
+    for (int j = 0; j < size; j++) {
+      Atom* atom = _matrix->get(i, j).get();
+      if (atom == nullptr) continue;
+      if (boxarr[i][j]->_type == AtomType::multiRow) listMultiRow.push_back({atom, i, j});
+      if (boxarr[i][j]->_type == AtomType::multiColumn) listMultiCol.push_back({atom, i, j});
     }
   }
 
   for (int j = 0; j < cols; j++) matW += colWidth[j];
 
   // The horizontal separator's width
-  float* Hsep = getColumnSep(env, matW);
+  const vector<float> Hsep = getColumnSep(env, matW);
 
-  for (auto& i : listMultiCol) {
-    auto* multi = (MulticolumnAtom*) i.get();
-    const int c = multi->col(), r = multi->row(), n = multi->skipped();
+  for (const auto& cell : listMultiCol) {
+    auto* multi = (MulticolumnAtom*) cell.atom;
+    const int c = cell.col, r = cell.row, n = multi->skipped();
     float w = 0;
     int j = 0;
     for (j = c; j < c + n - 1; j++) w += colWidth[j] + Hsep[j + 1];
@@ -490,7 +585,7 @@ sptr<Box> MatrixAtom::createBox(Environment& e) {
 
   auto Vsep = _vsep_in.createBox(env);
   // Recalculate the height of the row
-  recalculateLine(rows, boxarr, listMultiRow, lineHeight, lineDepth, drt, Vsep->_height);
+  recalculateLine(rows, boxarr, listMultiRow, lineHeight.data(), lineDepth.data(), drt, Vsep->_height);
 
   auto* vb = new VBox();
   float totalHeight = 0;
@@ -505,10 +600,11 @@ sptr<Box> MatrixAtom::createBox(Environment& e) {
           if (j == 0) {
             auto it = _vlines.find(0);
             if (it != _vlines.end()) {
-              auto vat = it->second;
-              vat->_height = lineHeight[i] + lineDepth[i] + Vsep->_height;
-              vat->_shift = lineDepth[i] + Vspace;
-              auto vatBox = vat->createBox(env);
+              // lay out a copy sized to the row, the atom is shared by the rows
+              VlineAtom vat(*it->second);
+              vat._height = lineHeight[i] + lineDepth[i] + Vsep->_height;
+              vat._shift = lineDepth[i] + Vspace;
+              auto vatBox = vat.createBox(env);
               hb->add(vatBox);
             }
           }
@@ -523,8 +619,8 @@ sptr<Box> MatrixAtom::createBox(Environment& e) {
               boxarr[i][j], colWidth[j], lineHeight[i], lineDepth[i], _position[j]  //
             );
           } else {
-            auto b = generateMulticolumn(env, boxarr[i][j], Hsep, colWidth, i, j);
-            auto* matom = (MulticolumnAtom*) _matrix->_array[i][j].get();
+            auto b = generateMulticolumn(env, boxarr[i][j], Hsep.data(), colWidth.data(), i, j);
+            auto* matom = (MulticolumnAtom*) _matrix->get(i, j).get();
             j += matom->skipped() - 1;
             wb = new WrapperBox(b, b->_width, lineHeight[i], lineDepth[i], Alignment::left);
             isLastVline = matom->hasRightVline();
@@ -538,10 +634,10 @@ sptr<Box> MatrixAtom::createBox(Environment& e) {
 
           auto it = _vlines.find(j + 1);
           if (isLastVline && it != _vlines.end()) {
-            auto vat = it->second;
-            vat->_height = lineHeight[i] + lineDepth[i] + Vsep->_height;
-            vat->_shift = lineDepth[i] + Vspace;
-            auto vatBox = vat->createBox(env);
+            VlineAtom vat(*it->second);
+            vat._height = lineHeight[i] + lineDepth[i] + Vsep->_height;
+            vat._shift = lineDepth[i] + Vspace;
+            auto vatBox = vat.createBox(env);
             hb->add(vatBox);
           }
         }
@@ -556,14 +652,16 @@ sptr<Box> MatrixAtom::createBox(Environment& e) {
           break;
 
         case AtomType::hline: {
-          auto* at = (HlineAtom*) _matrix->_array[i][j].get();
-          at->setColor(LINE_COLOR);
-          at->setWidth(matW);
-          if (i >= 1 && dynamic_cast<HlineAtom*>(_matrix->_array[i - 1][j].get()) != nullptr) {
+          // lay out a copy as wide as the matrix, the first pass measured the
+          // atom with no width
+          HlineAtom at(*(HlineAtom*) _matrix->get(i, j).get());
+          at.setColor(LINE_COLOR);
+          at.setWidth(matW);
+          if (i >= 1 && dynamic_cast<HlineAtom*>(_matrix->get(i - 1, j).get()) != nullptr) {
             hb->add(sptrOf<StrutBox>(0.f, 2 * drt, 0.f, 0.f));
           }
 
-          hb->add(at->createBox(env));
+          hb->add(at.createBox(env));
           j = cols;
         }
           break;
@@ -583,13 +681,6 @@ sptr<Box> MatrixAtom::createBox(Environment& e) {
   vb->_height = totalHeight / 2 + axis;
   vb->_depth = totalHeight / 2 - axis;
 
-  delete[] Hsep;
-  delete[] lineDepth;
-  delete[] lineHeight;
-  delete[] colWidth;
-  for (int i = 0; i < rows; i++) delete[] boxarr[i];
-  delete[] boxarr;
-
   return sptr<Box>(vb);
 }
 
@@ -644,11 +735,11 @@ Alignment MulticolumnAtom::parseAlign(const string& str) {
   return align;
 }
 
-sptr<Box> MulticolumnAtom::createBox(Environment& env) {
+sptr<Box> MulticolumnAtom::createBox(Environment& env, float width) {
   sptr<Box> b = (
-    _width == 0
+    width == 0
     ? _cols->createBox(env)
-    : sptrOf<HBox>(_cols->createBox(env), _width, _align)
+    : sptrOf<HBox>(_cols->createBox(env), width, _align)
   );
   b->_type = AtomType::multiColumn;
   return b;
@@ -664,19 +755,19 @@ sptr<Box> HdotsforAtom::createBox(float space, const sptr<Box>& b, Environment&
   return vb;
 }
 
-sptr<Box> HdotsforAtom::createBox(Environment& env) {
+sptr<Box> HdotsforAtom::createBox(Environment& env, float width) {
   auto dot = _cols->createBox(env);
   float space = Glue::getSpace(SpaceType::thinMuSkip, env) * _coeff * 2;
 
   // If no width specified, create a box with one dot
-  if (_width == 0) return createBox(space, dot, env);
+  if (width == 0) return createBox(space, dot, env);
 
-  float x = (_width - dot->_width) / (space + dot->_width);
+  float x = (width - dot->_width) / (space + dot->_width);
   int count = (int) floor(x);
 
   // Only one dot can be placed in
   if (count == 0) {
-    auto b = sptrOf<HBox>(dot, _width, Alignment::center);
+    auto b = sptrOf<HBox>(dot, width, Alignment::center);
     return createBox(space, b, env);
   }
 
@@ -690,7 +781,7 @@ sptr<Box> HdotsforAtom::createBox(Environment& env) {
   }
   b->add(dot);
 
-  auto hb = sptrOf<HBox>(b, _width, Alignment::center);
+  auto hb = sptrOf<HBox>(b, width, Alignment::center);
   return createBox(space, hb, env);
 }
 
@@ -702,14 +793,14 @@ sptr<Box> MultlineAtom::createBox(Environment& env) {
     return MatrixAtom(_isPartial, _column, L"").createBox(env);
 
   auto* vb = new VBox();
-  auto atom = _column->_array[0][0];
+  auto atom = _column->get(0, 0);
   Alignment alignment = _lineType == MultiLineType::gather ? Alignment::center : Alignment::left;
   if (atom->_alignment != Alignment::none) alignment = atom->_alignment;
 
   vb->add(sptrOf<HBox>(atom->createBox(env), tw, alignment));
   auto Vsep = _vsep_in.createBox(env);
   for (size_t i = 1; i < _column->rows() - 1; i++) {
-    atom = _column->_array[i][0];
+    atom = _column->get(i, 0);
     alignment = Alignment::center;
     if (atom->_alignment != Alignment::none) alignment = atom->_alignment;
     vb->add(Vsep);
@@ -717,7 +808,7 @@ sptr<Box> MultlineAtom::createBox(Environment& env) {
   }
 
   if (_column->rows() > 1) {
-    atom = _column->_array[_column->rows() - 1][0];
+    atom = _column->get(_column->rows() - 1, 0);
     alignment = _lineType == MultiLineType::gather ? Alignment::center : Alignment::right;
     if (atom->_alignment != Alignment::none) alignment = atom->_alignment;
     vb->add(Vsep);
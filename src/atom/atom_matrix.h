@@ -81,6 +81,23 @@ private:
   bool _isPartial;
   bool _spaceAround;
 
+  /** The boxes of the cells of the matrix being laid out, in row-major order */
+  struct CellBoxes {
+    std::vector<sptr<Box>> boxes;
+    int cols;
+
+    CellBoxes(int rows, int cols) : boxes((std::size_t) rows * cols), cols(cols) {}
+
+    /** Get the boxes of the given row */
+    inline sptr<Box>* operator[](int row) { return boxes.data() + (std::size_t) row * cols; }
+  };
+
+  /** A multi-row or multi-column cell found while the matrix is laid out */
+  struct MultiCell {
+    Atom* atom;
+    int row, col;
+  };
+
   void parsePositions(std::wstring opt, std::vector<Alignment>& lpos);
 
   sptr<Box> generateMulticolumn(
@@ -94,15 +111,26 @@ private:
 
   static void recalculateLine(
     int rows,
-    sptr<Box>** boxarr,
-    std::vector<sptr<Atom>>& multiRows,
+    CellBoxes& boxarr,
+    const std::vector<MultiCell>& multiRows,
     float* height,
     float* depth,
     float drt,
     float vspace
   );
 
-  float* getColumnSep(Environment& env, float width);
+  std::vector<float> getColumnSep(Environment& env, float width);
+
+  /**
+   * Lay out the cells into boxarr and find the height and the depth of the
+   * rows and the width of the columns, without the multi-row and the
+   * multi-column cells. The cells of a large matrix are laid out in parallel,
+   * see TeXRenderBuilder::setParallelCells.
+   */
+  void createCells(Environment& env, CellBoxes& boxarr, float* height, float* depth, float* width);
+
+  /** Find the replacement of the given column specifier, nullptr if not defined */
+  static const std::wstring* findColumnSpecifier(const std::wstring& rep);
 
   void applyCell(WrapperBox& box, int i, int j);
 
@@ -189,9 +217,7 @@ protected:
   // Number of columns across
   int _n;
   Alignment _align;
-  float _width;
   int _beforeVlines, _afterVlines;
-  int _row, _col;
   sptr<Atom> _cols;
 
   Alignment parseAlign(const std::string& str);
@@ -200,7 +226,7 @@ public:
   MulticolumnAtom() = delete;
 
   MulticolumnAtom(int n, const std::string& align, const sptr<Atom>& cols)
-    : _width(0), _beforeVlines(0), _afterVlines(0), _row(0), _col(0) {
+    : _beforeVlines(0), _afterVlines(0) {
     _n = n >= 1 ? n : 1;
     _cols = cols;
     _align = parseAlign(align);
@@ -208,26 +234,21 @@ public:
 
   virtual bool isNeedWidth() const { return false; }
 
-  inline void setColWidth(float w) { _width = w; }
-
-  inline float colWidth() const { return _width; }
-
   inline int skipped() const { return _n; }
 
   inline bool hasRightVline() const { return _afterVlines != 0; }
 
-  inline void setRowColumn(int i, int j) {
-    _row = i;
-    _col = j;
-  }
-
   inline Alignment align() { return _align; }
 
-  inline int row() const { return _row; }
-
-  inline int col() const { return _col; }
+  sptr<Box> createBox(Environment& env) override {
+    return createBox(env, 0);
+  }
 
-  sptr<Box> createBox(Environment& env) override;
+  /**
+   * Create the box of this atom in the given width of the columns it spans,
+   * or in its natural width if the given width is 0.
+   */
+  virtual sptr<Box> createBox(Environment& env, float width);
 
   __decl_clone(MulticolumnAtom)
 };
@@ -253,7 +274,7 @@ public:
     return true;
   }
 
-  sptr<Box> createBox(Environment& env) override;
+  sptr<Box> createBox(Environment& env, float width) override;
 
   __decl_clone(HdotsforAtom)
 };
@@ -264,17 +285,12 @@ private:
   sptr<Atom> _rows;
 
 public:
-  int _i, _j, _n;
+  int _n;
 
   MultiRowAtom() = delete;
 
   MultiRowAtom(int n, const std::wstring& option, const sptr<Atom>& rows)
-    : _i(0), _j(0), _rows(rows), _n(n == 0 ? 1 : n) {}
-
-  inline void setRowColumn(int r, int c) {
-    _i = r;
-    _j = c;
-  }
+    : _rows(rows), _n(n == 0 ? 1 : n) {}
 
   sptr<Box> createBox(Environment& env) override {
     auto b = _rows->createBox(env);
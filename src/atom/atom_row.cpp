@@ -3,6 +3,7 @@
 #include <memory>
 #include "atom/atom_basic.h"
 #include "core/core.h"
+#include "core/layout_cache.h"
 
 using namespace std;
 using namespace tex;
@@ -17,7 +18,7 @@ inline bool Dummy::isCharInMathMode() const {
   return at != nullptr && at->isMathMode();
 }
 
-inline sptr<CharFont> Dummy::getCharFont(TeXFont& tf) const {
+inline CharFont Dummy::getCharFont(TeXFont& tf) const {
   return ((CharSymbol*) _atom.get())->getCharFont(tf);
 }
 
@@ -27,11 +28,25 @@ void Dummy::changeAtom(const sptr<FixedCharAtom>& atom) {
   _type = AtomType::none;
 }
 
-sptr<Box> Dummy::createBox(Environment& env) {
-  if (_textSymbol) ((CharSymbol*) _atom.get())->markAsTextSymbol();
-  auto box = _atom->createBox(env);
-  if (_textSymbol) ((CharSymbol*) _atom.get())->removeMark();
-  return box;
+sptr<Box> Row::createBox(const sptr<Atom>& atom, Environment& env, AtomType previous) {
+  auto* row = dynamic_cast<Row*>(atom.get());
+  if (row == nullptr) return atom->createBox(env);
+  return row->createBox(env, previous);
+}
+
+sptr<Box> Dummy::createBox(Environment& env, AtomType previous) {
+  if (!_textSymbol) {
+    // only the layout of a row depends on the atom before it
+    if (dynamic_cast<Row*>(_atom.get()) == nullptr) previous = AtomType::none;
+    LayoutCache* cache = LayoutCache::current();
+    if (cache == nullptr) return Row::createBox(_atom, env, previous);
+    return cache->createBox(_atom, previous, env);
+  }
+  // the atom may be shared (e.g. predefined symbols), mark a copy of it
+  // rather than the atom itself
+  auto atom = _atom->clone();
+  ((CharSymbol*) atom.get())->markAsTextSymbol();
+  return atom->createBox(env);
 }
 
 inline bool Dummy::isKern() const {
@@ -39,12 +54,7 @@ inline bool Dummy::isKern() const {
   return (x != nullptr);
 }
 
-void Dummy::setPreviousAtom(const sptr<Dummy>& prev) {
-  auto* row = dynamic_cast<Row*>(_atom.get());
-  if (row != nullptr) row->setPreviousAtom(prev);
-}
-
-bool RowAtom::_breakEveywhere = false;
+thread_local bool RowAtom::_breakEveywhere = false;
 
 bitset<16> RowAtom::_binSet = bitset<16>()
   .set(static_cast<i8>(AtomType::binaryOperator))
@@ -63,7 +73,7 @@ bitset<16> RowAtom::_ligKernSet = bitset<16>()
   .set(static_cast<i8>(AtomType::punctuation));
 
 RowAtom::RowAtom(const sptr<Atom>& atom)
-  : _lookAtLastAtom(false), _previousAtom(nullptr), _breakable(true) {
+  : _lookAtLastAtom(false), _breakable(true) {
   if (atom != nullptr) {
     auto* x = dynamic_cast<RowAtom*>(atom.get());
     if (x != nullptr) {
@@ -98,10 +108,10 @@ void RowAtom::add(const sptr<Atom>& atom) {
   if (atom != nullptr) _elements.push_back(atom);
 }
 
-void RowAtom::changeToOrd(Dummy* cur, Dummy* prev, Atom* next) {
+void RowAtom::changeToOrd(Dummy* cur, AtomType prev, Atom* next) {
   AtomType type = cur->leftType();
   if ((type == AtomType::binaryOperator)
-      && ((prev == nullptr || _binSet[static_cast<i8>(prev->rightType())]) || next == nullptr)) {
+      && ((prev == AtomType::none || _binSet[static_cast<i8>(prev)]) || next == nullptr)) {
     cur->_type = AtomType::ordinary;
   } else if (next != nullptr && cur->rightType() == AtomType::binaryOperator) {
     AtomType nextType = next->leftType();
@@ -124,9 +134,13 @@ AtomType RowAtom::rightType() const {
 }
 
 sptr<Box> RowAtom::createBox(Environment& env) {
+  return createBox(env, AtomType::none);
+}
+
+sptr<Box> RowAtom::createBox(Environment& env, AtomType previous) {
   auto x = env.getTeXFont();
   TeXFont& tf = *x;
-  auto* hbox = new HBox();
+  auto hbox = sptrOf<HBox>();
 
   // convert atoms to boxes and add to the horizontal box
   const int end = _elements.size() - 1;
@@ -144,30 +158,30 @@ sptr<Box> RowAtom::createBox(Environment& env) {
       }
     }
 
-    auto atom = sptrOf<Dummy>(at);
+    Dummy atom(at);
     // if necessary, change BIN type to ORD
     // i.e. for formula: $+ e - f$, the plus sign should be treat as an ordinary type
     sptr<Atom> nextAtom(nullptr);
     if (i < end) nextAtom = _elements[i + 1];
-    changeToOrd(atom.get(), _previousAtom.get(), nextAtom.get());
+    changeToOrd(&atom, previous, nextAtom.get());
 
     // check for ligature or kerning
     float kern = 0;
-    while (i < end && atom->rightType() == AtomType::ordinary && atom->isCharSymbol()) {
+    while (i < end && atom.rightType() == AtomType::ordinary && atom.isCharSymbol()) {
       auto next = _elements[++i];
       auto* c = dynamic_cast<CharSymbol*>(next.get());
       if (c != nullptr && _ligKernSet[static_cast<i8>(next->leftType())]) {
-        atom->markAsTextSymbol();
-        auto l = atom->getCharFont(tf);
+        atom.markAsTextSymbol();
+        auto l = atom.getCharFont(tf);
         auto r = c->getCharFont(tf);
-        auto lig = tf.getLigature(*l, *r);
+        auto lig = tf.getLigature(l, r);
         if (lig == nullptr) {
-          kern = tf.getKern(*l, *r, env.getStyle());
+          kern = tf.getKern(l, r, env.getStyle());
           i--;
           break;  // iterator remains unchanged (no ligature!)
         } else {
           // fixed with ligature
-          atom->changeAtom(std::make_shared<FixedCharAtom>(lig));
+          atom.changeAtom(sptrOf<FixedCharAtom>(*lig));
         }
       } else {
         i--;
@@ -178,19 +192,18 @@ sptr<Box> RowAtom::createBox(Environment& env) {
     // insert glue, unless it's the first element of the row
     // or this element or the next is a kerning
     if (i != 0
-        && _previousAtom != nullptr
-        && !_previousAtom->isKern()
-        && !atom->isKern()
+        && previous != AtomType::none
+        && !atom.isKern()
       ) {
-      hbox->add(Glue::get(_previousAtom->rightType(), atom->leftType(), env));
+      hbox->add(Glue::get(previous, atom.leftType(), env));
     }
 
-    // insert atom's box
-    atom->setPreviousAtom(_previousAtom);
-    auto b = atom->createBox(env);
+    // insert atom's box, it may be shared with the other rows (see
+    // LayoutCache) and is added as is, but a char box that is never shared
+    auto b = atom.createBox(env, previous);
     auto* cb = dynamic_cast<CharBox*>(b.get());
     if (cb != nullptr
-        && !atom->isCharInMathMode()
+        && !atom.isCharInMathMode()
         && dynamic_cast<CharSymbol*>(nextAtom.get()) != nullptr
       ) {
       // When we have a single char, we need to add italic correction
@@ -218,13 +231,7 @@ sptr<Box> RowAtom::createBox(Environment& env) {
     if (abs(kern) > PREC) hbox->add(sptrOf<StrutBox>(kern, 0.f, 0.f, 0.f));
 
     // kerning do not interfere with the normal glue-rules without kerning
-    if (!atom->isKern()) _previousAtom = atom;
+    if (!atom.isKern()) previous = atom.rightType();
   }
-  // reset previous atom
-  _previousAtom = nullptr;
-  return sptr<Box>(hbox);
-}
-
-void RowAtom::setPreviousAtom(const sptr<Dummy>& prev) {
-  _previousAtom = prev;
+  return hbox;
 }
@@ -28,17 +28,24 @@ class TeXFont;
 class Row {
 public:
   /**
-   * Sets the given dummy containing the atom that comes just before the first
-   * child atom of this "composed atom". This method will always be called by
-   * another composed atom, so this composed atom will be a child of it
-   * (nested). This is necessary to determine the glue to insert between the
-   * first child atom of this nested composed atom and the atom that the dummy
-   * contains.
+   * Create the box of this "composed atom" laid out just after an atom of the
+   * given type. This method will always be called by another composed atom,
+   * so this composed atom will be a child of it (nested). This is necessary
+   * to determine the type of the first child atom of this nested composed
+   * atom. The type is passed rather than kept by the atom, so the same atom
+   * can be laid out several times (even at once).
    *
-   * @param dummy
-   *      the dummy that comes just before this "composed atom"
+   * @param env the environment to lay out in
+   * @param previous the right type of the atom that comes just before this
+   * "composed atom", AtomType::none if none
    */
-  virtual void setPreviousAtom(const sptr<Dummy>& dummy) = 0;
+  virtual sptr<Box> createBox(Environment& env, AtomType previous) = 0;
+
+  /**
+   * Create the box of the given atom laid out just after an atom of the given
+   * type, the type is ignored if the atom is not a "composed atom".
+   */
+  static sptr<Box> createBox(const sptr<Atom>& atom, Environment& env, AtomType previous);
 };
 
 /**
@@ -86,7 +93,7 @@ public:
   bool isCharInMathMode() const;
 
   /** This method will only be called if isCharSymbol returns true. */
-  sptr<CharFont> getCharFont(TeXFont& tf) const;
+  CharFont getCharFont(TeXFont& tf) const;
 
   /**
    * Changes this atom into the given "ligature atom".
@@ -95,7 +102,14 @@ public:
    */
   void changeAtom(const sptr<FixedCharAtom>& atom);
 
-  sptr<Box> createBox(Environment& env);
+  /**
+   * Create the box of this atom.
+   *
+   * @param env the environment to lay out in
+   * @param previous the right type of the atom before this one in the row,
+   * AtomType::none if none
+   */
+  sptr<Box> createBox(Environment& env, AtomType previous);
 
   inline void markAsTextSymbol() {
     _textSymbol = true;
@@ -103,9 +117,6 @@ public:
 
   /** Test if this atom is a kern. */
   bool isKern() const;
-
-  /** Only for row-elements */
-  void setPreviousAtom(const sptr<Dummy>& prev);
 };
 
 /**
@@ -124,19 +135,19 @@ private:
   bool _breakable;
   // atoms to be displayed horizontally next to each-other
   std::vector<sptr<Atom>> _elements;
-  // previous atom (for nested Row atoms)
-  sptr<Dummy> _previousAtom;
 
   /**
    * Change the atom-type to ORD if necessary
    * <p>
    * i.e. for formula: `$+ e - f$`, the plus sign should be treat as
    * an ordinary type
+   *
+   * @param prev the right type of the previous atom, AtomType::none if none
    */
-  static void changeToOrd(Dummy* cur, Dummy* prev, Atom* next);
+  static void changeToOrd(Dummy* cur, AtomType prev, Atom* next);
 
 public:
-  static bool _breakEveywhere;
+  static thread_local bool _breakEveywhere;
 
   bool _lookAtLastAtom;
 
@@ -176,7 +187,7 @@ public:
 
   sptr<Box> createBox(Environment& env) override;
 
-  void setPreviousAtom(const sptr<Dummy>& prev) override;
+  sptr<Box> createBox(Environment& env, AtomType previous) override;
 
   AtomType leftType() const override;
 
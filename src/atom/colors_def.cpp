@@ -1,4 +1,6 @@
 #include "atom_basic.h"
+#include "core/macro.h"
+#include "utils/sorted_table.h"
 
 #define c(name, c, m, y, k) \
   { name, cmyk(c, m, y, k) }
@@ -6,7 +8,7 @@
 using namespace std;
 using namespace tex;
 
-map<string, tex::color> tex::ColorAtom::_colors{
+static constexpr TableEntry<TableKey<char>, color> predefinedColors[]{
   {"black", black},
   {"white", white},
   {"red", red},
@@ -78,6 +80,11 @@ map<string, tex::color> tex::ColorAtom::_colors{
   c("gray", 0.f, 0.f, 0.f, 0.50f),
 };
 
+// sorted at compile time since C++14, at startup otherwise
+static SORTED_TABLE_CONSTEXPR const auto predefined = sortedTable(predefinedColors);
+
+map<string, tex::color> tex::ColorAtom::_colors;
+
 color ColorAtom::getColor(std::string name) {
   if (name.empty()) return _default;
   trim(name);
@@ -85,9 +92,18 @@ color ColorAtom::getColor(std::string name) {
   // #AARRGGBB formatted color
   if (name[0] == '#') return decode(name);
   if (name.find(',') == string::npos) {
-    // find from predefined colors
-    auto it = _colors.find(tolower(name));
+    const string key = tolower(name);
+    // find from the colors defined by the current parsing context
+    MacroScope* scope = MacroScope::current();
+    if (scope != nullptr) {
+      auto it = scope->_colors.find(key);
+      if (it != scope->_colors.end()) return it->second;
+    }
+    // find from the colors defined without a parsing context, then from the predefined ones
+    auto it = _colors.find(key);
     if (it != _colors.end()) return it->second;
+    const color* found = predefined.find(key);
+    if (found != nullptr) return *found;
     // AARRGGBB formatted color
     if (name.find('.') == string::npos) return decode("#" + name);
     // gray color
@@ -12,14 +12,14 @@ sptr<Box> DelimiterFactory::create(SymbolAtom& symbol, Environment& env, int siz
 
   TeXFont& tf = *(env.getTeXFont());
   const TexStyle style = env.getStyle();
-  Char c = tf.getChar(symbol.getName(), style);
+  Char c = symbol.getChar(tf, style);
   int i = 0;
 
   for (int i = 1; i <= size && tf.hasNextLarger(c); i++) c = tf.getNextLarger(c, style);
 
   if (i <= size && !tf.hasNextLarger(c)) {
     CharBox A(tf.getChar(L'A', "mathnormal", style));
-    auto b = create(symbol.getName(), env, size * (A._height + A._depth));
+    auto b = create(symbol.getChar(tf, style), env, size * (A._height + A._depth));
     return b;
   }
 
@@ -27,9 +27,13 @@ sptr<Box> DelimiterFactory::create(SymbolAtom& symbol, Environment& env, int siz
 }
 
 sptr<Box> DelimiterFactory::create(const string& symbol, Environment& env, float minHeight) {
+  return create(env.getTeXFont()->getChar(symbol, env.getStyle()), env, minHeight);
+}
+
+sptr<Box> DelimiterFactory::create(const Char& symbol, Environment& env, float minHeight) {
   TeXFont& tf = *(env.getTeXFont());
   const TexStyle style = env.getStyle();
-  Char c = tf.getChar(symbol, style);
+  Char c = symbol;
 
   // start with smallest character
   float total = c.getHeight() + c.getDepth();
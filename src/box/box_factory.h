@@ -32,6 +32,18 @@ public:
    *     according to the required minimum size.
    */
   static sptr<Box> create(const std::string& symbol, Environment& env, float minHeight);
+
+  /**
+   * Create a delimiter from the given character and min height
+   *
+   * @param symbol the smallest variant of the delimiter
+   * @param env the Environment in which to create the delimiter box
+   * @param minHeight the minimum required total height of the box (height + depth).
+   *
+   * @return the box representing the delimiter variant that fits best
+   *     according to the required minimum size.
+   */
+  static sptr<Box> create(const Char& symbol, Environment& env, float minHeight);
 };
 
 /** Responsible for creating a box containing a delimiter symbol that exists in different sizes. */
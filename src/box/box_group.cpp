@@ -94,9 +94,22 @@ pair<sptr<HBox>, sptr<HBox>> HBox::split(int pos, int shift) {
 
 void HBox::draw(Graphics2D& g2, float x, float y) {
   float xPos = x;
-  for (const auto& box : _children) {
-    box->draw(g2, xPos, y + box->_shift);
-    xPos += box->_width;
+  const size_t count = _children.size();
+  for (size_t i = 0; i < count;) {
+    const auto& box = _children[i];
+    // coalesce the consecutive characters into one run
+    size_t j = i + 1;
+    auto* cb = dynamic_cast<CharBox*>(box.get());
+    if (cb != nullptr) {
+      while (j < count && cb->isSameRun(*_children[j])) j++;
+    }
+    if (j - i > 1) {
+      xPos = CharBox::drawRun(g2, &_children[i], j - i, xPos, y);
+    } else {
+      box->draw(g2, xPos, y + box->_shift);
+      xPos += box->_width;
+    }
+    i = j;
   }
 }
 
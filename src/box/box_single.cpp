@@ -1,5 +1,6 @@
 #include "box_single.h"
 #include "fonts/fonts.h"
+#include "utils/arena.h"
 
 using namespace std;
 using namespace tex;
@@ -18,19 +19,50 @@ void CharBox::addItalicCorrectionToWidth() {
   _italic = 0;
 }
 
+bool CharBox::isSameRun(const Box& box) const {
+  auto* cb = dynamic_cast<const CharBox*>(&box);
+  return cb != nullptr && cb->_cf.fontId == _cf.fontId && cb->_size == _size;
+}
+
+float CharBox::drawRun(Graphics2D& g2, const sptr<Box>* boxes, size_t count, float x, float y) {
+  const auto* first = static_cast<const CharBox*>(boxes[0].get());
+  const float size = first->_size;
+  static thread_local vector<wchar_t> chars;
+  static thread_local vector<Point> positions;
+  chars.resize(count);
+  positions.resize(count);
+  float xPos = 0;
+  for (size_t i = 0; i < count; i++) {
+    const auto* box = static_cast<const CharBox*>(boxes[i].get());
+    chars[i] = box->_cf.chr;
+    positions[i] = Point(xPos / size, box->_shift / size);
+    xPos += box->_width;
+  }
+
+  g2.translate(x, y);
+  const Font* font = FontInfo::getFont(first->_cf.fontId);
+  if (size != 1) g2.scale(size, size);
+  if (g2.getFont() != font) g2.setFont(font);
+  g2.drawGlyphs(chars.data(), positions.data(), (int) count);
+  // reset
+  if (size != 1) g2.scale(1.f / size, 1.f / size);
+  g2.translate(-x, -y);
+  return x + xPos;
+}
+
 void CharBox::draw(Graphics2D& g2, float x, float y) {
   g2.translate(x, y);
-  const Font* font = FontInfo::getFont(_cf->fontId);
+  const Font* font = FontInfo::getFont(_cf.fontId);
   if (_size != 1) g2.scale(_size, _size);
   if (g2.getFont() != font) g2.setFont(font);
-  g2.drawChar(_cf->chr, 0, 0);
+  g2.drawChar(_cf.chr, 0, 0);
   // reset
   if (_size != 1) g2.scale(1.f / _size, 1.f / _size);
   g2.translate(-x, -y);
 }
 
 int CharBox::lastFontId() {
-  return _cf->fontId;
+  return _cf.fontId;
 }
 
 sptr<Font> TextRenderingBox::_font(nullptr);
@@ -46,6 +78,8 @@ void TextRenderingBox::_free_() {
 }
 
 void TextRenderingBox::setFont(const string& name) {
+  // set by \externalfont while parsing, the font outlives the render
+  ArenaSuspension suspension;
   _font = Font::_create(name, PLAIN, 10);
 }
 
@@ -64,7 +98,7 @@ void TextRenderingBox::init(
 void TextRenderingBox::draw(Graphics2D& g2, float x, float y) {
   g2.translate(x, y);
   g2.scale(0.1f * _size, 0.1f * _size);
-  _layout->draw(g2, 0, 0);
+  g2.drawTextLayout(_layout, 0, 0);
   g2.scale(10 / _size, 10 / _size);
   g2.translate(-x, -y);
 }
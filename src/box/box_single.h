@@ -2,13 +2,10 @@
 #define LATEX_BOX_SINGLE_H
 
 #include "atom/atom.h"
+#include "fonts/font_basic.h"
 
 namespace tex {
 
-class Char;
-
-class CharFont;
-
 /** A box representing whitespace */
 class StrutBox : public Box {
 public:
@@ -56,7 +53,7 @@ public:
 /** A box representing a single character */
 class CharBox : public Box {
 private:
-  sptr<CharFont> _cf;
+  CharFont _cf;
   float _size;
   float _italic;
 
@@ -73,6 +70,22 @@ public:
 
   void addItalicCorrectionToWidth();
 
+  /** Test if the given box is a CharBox can be drawn in the same run with this box. */
+  bool isSameRun(const Box& box) const;
+
+  /**
+   * Draw the given CharBoxes (must be in the same run) in a row with one single
+   * Graphics2D::drawGlyphs call.
+   *
+   * @param g2 the graphics context
+   * @param boxes the boxes to draw
+   * @param count the count of the boxes
+   * @param x the x-coordinate of the first box
+   * @param y the y-coordinate of the baseline
+   * @return the x-coordinate after the last box
+   */
+  static float drawRun(Graphics2D& g2, const sptr<Box>* boxes, size_t count, float x, float y);
+
   void draw(Graphics2D& g2, float x, float y) override;
 
   int lastFontId() override;
@@ -4,6 +4,8 @@
 #include "box/box_group.h"
 #include "common.h"
 
+#include <limits>
+
 using namespace std;
 using namespace tex;
 
@@ -86,7 +88,7 @@ sptr<Box> BoxSplitter::split(const sptr<Box>& b, float width, float lineSpace) {
 sptr<Box> BoxSplitter::split(const sptr<HBox>& hb, float width, float lineSpace) {
   if (width == 0 || hb->_width <= width) return hb;
 
-  auto* vbox = new VBox();
+  auto vbox = sptrOf<VBox>();
   sptr<HBox> first, second;
   stack<Position> positions;
   sptr<HBox> hbox = hb;
@@ -112,7 +114,7 @@ sptr<Box> BoxSplitter::split(const sptr<HBox>& hb, float width, float lineSpace)
 
   if (second != nullptr) {
     vbox->add(second, lineSpace);
-    return sptr<Box>(vbox);
+    return vbox;
   }
 
   return hbox;
@@ -178,6 +180,129 @@ int BoxSplitter::getBreakPosition(const sptr<HBox>& hb, int i) {
   return hb->_breakPositions[pos - 1];
 }
 
+void BoxSplitter::collectBreaks(
+  const HBox& hbox, float x, vector<int>& path, vector<Break>& breaks, vector<int>& pool
+) {
+  const auto& children = hbox._children;
+  const int count = children.size();
+  auto bp = hbox._breakPositions.begin();
+  const auto end = hbox._breakPositions.end();
+  for (int i = 0; i < count; i++) {
+    // a break before the first child or after the last one makes no line
+    while (bp != end && *bp < i) ++bp;
+    if (bp != end && *bp == i && i > 0) {
+      breaks.push_back({x, (int) pool.size(), (int) path.size() + 1});
+      pool.insert(pool.end(), path.begin(), path.end());
+      pool.push_back(i);
+    }
+    const auto* child = dynamic_cast<const HBox*>(children[i].get());
+    if (child != nullptr) {
+      path.push_back(i);
+      collectBreaks(*child, x, path, breaks, pool);
+      path.pop_back();
+    }
+    x += children[i]->_width;
+  }
+}
+
+sptr<HBox> BoxSplitter::slice(
+  HBox& hbox, int depth, const int* from, int fromDepth, const int* to, int toDepth
+) {
+  auto& children = hbox._children;
+  auto line = hbox.cloneBox();
+  // the child to break into at the start and at the end, -1 if none
+  int first = 0, last = children.size(), head = -1, tail = -1;
+  if (depth < fromDepth) {
+    if (depth == fromDepth - 1) {
+      first = from[depth];
+    } else {
+      head = from[depth];
+      first = head + 1;
+    }
+  }
+  if (depth < toDepth) {
+    last = to[depth];
+    if (depth < toDepth - 1) tail = last;
+  }
+
+  auto nested = [&](int i) -> HBox& { return static_cast<HBox&>(*children[i]); };
+  if (head >= 0 && head == tail) {
+    line->add(slice(nested(head), depth + 1, from, fromDepth, to, toDepth));
+    return line;
+  }
+  if (head >= 0) line->add(slice(nested(head), depth + 1, from, fromDepth, nullptr, 0));
+  for (int i = first; i < last; i++) line->add(children[i]);
+  if (tail >= 0) line->add(slice(nested(tail), depth + 1, nullptr, 0, to, toDepth));
+  return line;
+}
+
+sptr<Box> BoxSplitter::splitOptimal(const sptr<Box>& box, float width, float lineSpace) {
+  auto hb = dynamic_pointer_cast<HBox>(box);
+  if (hb == nullptr || width == 0 || hb->_width <= width) return box;
+
+  // the candidate breaks and the best way to reach each of them, reused
+  // between the calls
+  struct Node {
+    double demerits;
+    int prev;
+  };
+  static thread_local vector<Break> breaks;
+  static thread_local vector<int> pool, path, lines;
+  static thread_local vector<Node> nodes;
+  breaks.clear();
+  pool.clear();
+  path.clear();
+  lines.clear();
+
+  // the start and the end of the box are breaks too
+  breaks.push_back({0.f, 0, 0});
+  collectBreaks(*hb, 0.f, path, breaks, pool);
+  breaks.push_back({hb->_width, 0, 0});
+  const int n = breaks.size();
+
+  // the demerits of a line of the given natural width, a line that overflows
+  // costs more than any line that does not
+  const auto demerits = [width](float w, bool isLast) {
+    constexpr double linePenalty = 10, overflow = 1e12;
+    if (w > width) return overflow * (1 + (w - width) / width);
+    if (isLast) return linePenalty * linePenalty;
+    const double r = (width - w) / width;
+    const double badness = 100 * r * r * r;
+    return (linePenalty + badness) * (linePenalty + badness);
+  };
+
+  nodes.assign(n, {numeric_limits<double>::infinity(), -1});
+  nodes[0].demerits = 0;
+  for (int j = 1; j < n; j++) {
+    const bool isLast = j == n - 1;
+    // the lines from the nearest breaks, stop once a line overflows
+    for (int i = j - 1; i >= 0; i--) {
+      const float w = breaks[j].x - breaks[i].x;
+      const double d = nodes[i].demerits + demerits(w, isLast);
+      if (d < nodes[j].demerits) nodes[j] = {d, i};
+      if (w > width) break;
+    }
+  }
+
+  // a single line, nothing to break
+  if (nodes[n - 1].prev <= 0) return box;
+  // the breaks of the lines, from the end to the start
+  lines.clear();
+  for (int j = n - 1; j > 0; j = nodes[j].prev) lines.push_back(j);
+  auto vbox = sptrOf<VBox>();
+  int from = 0;
+  for (auto it = lines.rbegin(); it != lines.rend(); ++it) {
+    const Break& a = breaks[from];
+    const Break& b = breaks[*it];
+    vbox->add(
+      slice(*hb, 0, pool.data() + a.path, a.depth, pool.data() + b.path, b.depth),
+      lineSpace
+    );
+    from = *it;
+  }
+  return vbox;
+}
+
 /************************************* Environment implementation ******************************/
 
 Environment::Environment(TexStyle style, const sptr<TeXFont>& tf, UnitType wu, float tw) {
@@ -196,64 +321,75 @@ void Environment::setTextWidth(UnitType wu, float w) {
   _textWidth = w * SpaceAtom::getFactor(wu, *this);
 }
 
+sptr<Box> Environment::getMiddleBox(const Atom* atom) const {
+  if (_middleBoxes == nullptr) return nullptr;
+  for (const auto& middle : *_middleBoxes) {
+    if (middle.first == atom) return middle.second;
+  }
+  return nullptr;
+}
+
+sptr<Environment>& Environment::derive(sptr<Environment>& env, TexStyle style, const sptr<TeXFont>& tf) {
+  if (env == nullptr) {
+    env = sptrOf<Environment>(style, _scaleFactor, tf, _textStyle, _smallCap);
+    return env;
+  }
+  Environment& e = *env;
+  e.init();
+  e._style = style;
+  e._scaleFactor = _scaleFactor;
+  e._tf = tf;
+  e._textStyle = _textStyle;
+  e._smallCap = _smallCap;
+  e.setInterline(UnitType::ex, 1.f);
+  return env;
+}
+
 sptr<Environment>& Environment::copy() {
-  Environment* t = new Environment(_style, _scaleFactor, _tf, _textStyle, _smallCap);
-  _copy = sptr<Environment>(t);
-  return _copy;
+  return derive(_copy, _style, _tf);
 }
 
 sptr<Environment>& Environment::copy(const sptr<TeXFont>& tf) {
-  Environment* te = new Environment(_style, _scaleFactor, tf, _textStyle, _smallCap);
-  te->_textWidth = _textWidth;
-  te->_interline = _interline;
-  te->_interlineUnit = _interlineUnit;
-  _copytf = sptr<Environment>(te);
+  derive(_copytf, _style, tf);
+  _copytf->_textWidth = _textWidth;
+  _copytf->_interline = _interline;
+  _copytf->_interlineUnit = _interlineUnit;
   return _copytf;
 }
 
+sptr<Environment> Environment::detach() const {
+  auto env = sptrOf<Environment>(*this);
+  env->_tf = _tf->copy();
+  env->_copy = env->_copytf = env->_cramp = env->_dnom = nullptr;
+  env->_num = env->_root = env->_sub = env->_sup = nullptr;
+  return env;
+}
+
 sptr<Environment>& Environment::crampStyle() {
-  Environment* t = new Environment(_style, _scaleFactor, _tf, _textStyle, _smallCap);
-  _cramp = sptr<Environment>(t);
   const i8 style = static_cast<i8>(_style);
-  _cramp->_style = static_cast<TexStyle>(style % 2 == 1 ? style : style + 1);
-  return _cramp;
+  return derive(_cramp, static_cast<TexStyle>(style % 2 == 1 ? style : style + 1), _tf);
 }
 
 sptr<Environment>& Environment::dnomStyle() {
-  Environment* t = new Environment(_style, _scaleFactor, _tf, _textStyle, _smallCap);
-  _dnom = sptr<Environment>(t);
   const i8 style = static_cast<i8>(_style);
-  _dnom->_style = static_cast<TexStyle>(2 * (style / 2) + 1 + 2 - 2 * (style / 6));
-  return _dnom;
+  return derive(_dnom, static_cast<TexStyle>(2 * (style / 2) + 1 + 2 - 2 * (style / 6)), _tf);
 }
 
 sptr<Environment>& Environment::numStyle() {
-  Environment* t = new Environment(_style, _scaleFactor, _tf, _textStyle, _smallCap);
-  _num = sptr<Environment>(t);
   const i8 style = static_cast<i8>(_style);
-  _num->_style = static_cast<TexStyle>(style + 2 - 2 * (style / 6));
-  return _num;
+  return derive(_num, static_cast<TexStyle>(style + 2 - 2 * (style / 6)), _tf);
 }
 
 sptr<Environment>& Environment::rootStyle() {
-  Environment* t = new Environment(_style, _scaleFactor, _tf, _textStyle, _smallCap);
-  _root = sptr<Environment>(t);
-  _root->_style = TexStyle::scriptScript;
-  return _root;
+  return derive(_root, TexStyle::scriptScript, _tf);
 }
 
 sptr<Environment>& Environment::subStyle() {
-  Environment* t = new Environment(_style, _scaleFactor, _tf, _textStyle, _smallCap);
-  _sub = sptr<Environment>(t);
   const i8 style = static_cast<i8>(_style);
-  _sub->_style = static_cast<TexStyle>(2 * (style / 4) + 4 + 1);
-  return _sub;
+  return derive(_sub, static_cast<TexStyle>(2 * (style / 4) + 4 + 1), _tf);
 }
 
 sptr<Environment>& Environment::supStyle() {
-  Environment* t = new Environment(_style, _scaleFactor, _tf, _textStyle, _smallCap);
-  _sup = sptr<Environment>(t);
   const i8 style = static_cast<i8>(_style);
-  _sup->_style = static_cast<TexStyle>(2 * (style / 4) + 4 + (style % 2));
-  return _sup;
+  return derive(_sup, static_cast<TexStyle>(2 * (style / 4) + 4 + (style % 2)), _tf);
 }
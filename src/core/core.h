@@ -3,6 +3,7 @@
 
 #include <cstring>
 #include <stack>
+#include <vector>
 
 #include "common.h"
 #include "fonts/fonts.h"
@@ -12,6 +13,8 @@ namespace tex {
 
 class Box;
 
+class Atom;
+
 #ifdef HAVE_LOG
 
 void print_box(const sptr<Box>& box);
@@ -29,14 +32,49 @@ public:
   };
 
 private:
+  /**
+   * A place to break a line, the path of the nested boxes to break is in a
+   * shared pool: the index of the child to break into for each nested box,
+   * then the index of the first child of the next line in the innermost one.
+   */
+  struct Break {
+    // the position of the break from the start of the box
+    float x;
+    // the offset and the length of the path in the pool
+    int path, depth;
+  };
+
   static float canBreak(std::stack<Position>& stack, const sptr<HBox>& hbox, float width);
 
   static int getBreakPosition(const sptr<HBox>& hb, int index);
 
+  static void collectBreaks(
+    const HBox& hbox, float x, std::vector<int>& path,
+    std::vector<Break>& breaks, std::vector<int>& pool
+  );
+
+  static sptr<HBox> slice(
+    HBox& hbox, int depth, const int* from, int fromDepth, const int* to, int toDepth
+  );
+
 public:
   static sptr<Box> split(const sptr<Box>& box, float width, float lineSpace);
 
   static sptr<Box> split(const sptr<HBox>& hb, float width, float lineSpace);
+
+  /**
+   * Break the given box into lines of the given width with the total-fit
+   * algorithm of Knuth and Plass: rather than filling the lines one by one
+   * (like split does), the breaks of all the lines are chosen at once to
+   * make the lines as evenly full as possible, and the lines that overflow
+   * are avoided as long as there is a way to.
+   *
+   * @param box the box to break, it is returned as is if it is not a HBox or
+   * if it fits the width
+   * @param width the width of the lines
+   * @param lineSpace the space between the lines
+   */
+  static sptr<Box> splitOptimal(const sptr<Box>& box, float width, float lineSpace);
 };
 
 /**
@@ -64,11 +102,22 @@ private:
   UnitType _interlineUnit;
   // The inter line space
   float _interline{};
+  // The boxes of the middle delimiters of the fenced atom being laid out
+  const std::vector<std::pair<const Atom*, sptr<Box>>>* _middleBoxes{};
 
-  // Member to store copies to prevent destruct
+  // The derived environments, allocated once and reset each time they are
+  // derived again, so the layout of the nested scripts and fractions does
+  // not allocate an environment per atom
   sptr<Environment> _copy, _copytf, _cramp, _dnom;
   sptr<Environment> _num, _root, _sub, _sup;
 
+  /**
+   * Reset the given derived environment to a copy of this one (without its
+   * width and inter-line space) with the given style and font, allocate it
+   * if it does not exist.
+   */
+  sptr<Environment>& derive(sptr<Environment>& env, TexStyle style, const sptr<TeXFont>& tf);
+
   inline void init() {
     _style = TexStyle::display;
     _lastFontId = TeXFont::NO_FONT;
@@ -77,8 +126,10 @@ private:
     _scaleFactor = 1.f;
     _interlineUnit = UnitType::em;
     _interline = 0;
+    _middleBoxes = nullptr;
   }
 
+public:
   Environment(
     TexStyle style, float scaleFactor,
     const sptr<TeXFont>& tf,
@@ -93,7 +144,6 @@ private:
     setInterline(UnitType::ex, 1.f);
   }
 
-public:
   Environment(TexStyle style, const sptr<TeXFont>& tf) {
     init();
     _style = style;
@@ -110,6 +160,9 @@ public:
 
   float getInterline() const;
 
+  /** Get the inter-line space in the unit it was set with */
+  inline std::pair<UnitType, float> getInterlineSpec() const { return {_interlineUnit, _interline}; }
+
   void setTextWidth(UnitType widthUnit, float width);
 
   inline float getTextWidth() const { return _textWidth; }
@@ -122,6 +175,13 @@ public:
 
   sptr<Environment>& copy(const sptr<TeXFont>& tf);
 
+  /**
+   * Get a copy of this environment that shares neither its font nor its
+   * derived environments with this one, so the copy can be used to lay out
+   * on another thread while this one is used as well.
+   */
+  sptr<Environment> detach() const;
+
   /**
    * Copy of this envrionment in cramped style.
    */
@@ -175,6 +235,27 @@ public:
   inline int getLastFontId() const {
     return (_lastFontId == TeXFont::NO_FONT ? _tf->getMuFontId() : _lastFontId);
   }
+
+  /**
+   * Set the boxes of the middle delimiters, sized by the fenced atom they are
+   * in, the atoms are laid out into them rather than keep them.
+   *
+   * @param boxes the boxes of the middle atoms, nullptr if none
+   * @return the previous boxes
+   */
+  inline const std::vector<std::pair<const Atom*, sptr<Box>>>* setMiddleBoxes(
+    const std::vector<std::pair<const Atom*, sptr<Box>>>* boxes
+  ) {
+    const auto prev = _middleBoxes;
+    _middleBoxes = boxes;
+    return prev;
+  }
+
+  /** Get the box of the given middle atom, nullptr if not sized yet */
+  sptr<Box> getMiddleBox(const Atom* atom) const;
+
+  /** Test if the boxes of the middle delimiters are set, see setMiddleBoxes */
+  inline bool hasMiddleBoxes() const { return _middleBoxes != nullptr; }
 };
 
 }  // namespace tex
@@ -2,19 +2,23 @@
 
 #include "common.h"
 #include "core/core.h"
+#include "core/macro.h"
+#include "core/parse_cache.h"
 #include "core/parser.h"
 #include "fonts/alphabet.h"
 #include "fonts/fonts.h"
 #include "res/parser/formula_parser.h"
 
+#include <mutex>
+
 using namespace std;
 using namespace tex;
 
-map<wstring, sptr<Formula>> Formula::_predefinedTeXFormulas;
+thread_local map<pair<wstring, size_t>, sptr<Formula>> Formula::_predefinedTeXFormulas;
 
 map<UnicodeBlock, FontInfos*> Formula::_externalFontMap;
 
-float Formula::PIXELS_PER_POINT = 1.f;
+thread_local float Formula::PIXELS_PER_POINT = 1.f;
 
 void Formula::_init_() {
 #ifdef HAVE_LOG
@@ -41,56 +45,60 @@ Formula::Formula(
   const wstring& latex,
   const string& textStyle,
   bool preprocess, bool isMathMode
-) : _parser(tp.isPartial(), latex, this, preprocess, isMathMode) {
+) : _parser(tp, latex, this, preprocess, isMathMode), _xml(&tp._formula->xmlMap()) {
   _textStyle = textStyle;
-  _xmlMap = tp._formula->_xmlMap;
-  if (tp.isPartial()) {
-    try {
-      _parser.parse();
-    } catch (exception& e) {
-      if (_root == nullptr) _root = sptrOf<EmptyAtom>();
-    }
-  } else {
-    _parser.parse();
-  }
+  parseNested(latex, preprocess, true);
 }
 
 Formula::Formula(const TeXParser& tp, const wstring& latex, bool preprocess)
-  : _parser(tp.isPartial(), latex, this, preprocess) {
+  : _parser(tp, latex, this, preprocess), _xml(&tp._formula->xmlMap()) {
   _textStyle = "";
-  _xmlMap = tp._formula->_xmlMap;
-  if (tp.isPartial()) {
-    try {
-      _parser.parse();
-    } catch (exception& e) {}
-  } else {
-    _parser.parse();
-  }
+  parseNested(latex, preprocess, false);
 }
 
 Formula::Formula(const TeXParser& tp, const wstring& latex)
-  : _parser(tp.isPartial(), latex, this) {
+  : _parser(tp, latex, this, !tp.isExpanded()), _xml(&tp._formula->xmlMap()) {
   _textStyle = "";
-  _xmlMap = tp._formula->_xmlMap;
-  if (tp.isPartial()) {
+  parseNested(latex, !tp.isExpanded(), true);
+}
+
+void Formula::parseNested(const wstring& latex, bool preprocess, bool emptyOnError) {
+  ParseCache* cache = preprocess ? nullptr : ParseCache::current();
+  ParseCache::Key key;
+  if (cache != nullptr) {
+    key = {latex, _textStyle, _parser.cacheState()};
+    auto atom = cache->find(key);
+    if (atom != nullptr) {
+      _root = ParseCache::instance(atom);
+      return;
+    }
+  }
+
+  if (_parser.isPartial()) {
     try {
       _parser.parse();
     } catch (exception& e) {
-      if (_root == nullptr) _root = sptrOf<EmptyAtom>();
+      if (emptyOnError && _root == nullptr) _root = sptrOf<EmptyAtom>();
+      return;
     }
   } else {
     _parser.parse();
   }
+  if (cache != nullptr && _root != nullptr && _middle.empty()
+      && key.state == _parser.cacheState()) {
+    cache->put(std::move(key), _root);
+  }
 }
 
-Formula::Formula() : _parser(L"", this, false) {}
+Formula::Formula() : _parser(L"", this, false), _xml(&_xmlMap) {}
 
-Formula::Formula(const wstring& latex) : _parser(latex, this) {
+Formula::Formula(const wstring& latex) : _parser(latex, this), _xml(&_xmlMap) {
   _textStyle = "";
   _parser.parse();
 }
 
-Formula::Formula(const wstring& latex, bool preprocess) : _parser(latex, this, preprocess) {
+Formula::Formula(const wstring& latex, bool preprocess)
+  : _parser(latex, this, preprocess), _xml(&_xmlMap) {
   _textStyle = "";
   _parser.parse();
 }
@@ -132,30 +140,49 @@ void Formula::setDEBUG(bool b) {
 }
 
 sptr<Formula> Formula::get(const wstring& name) {
-  auto it = _predefinedTeXFormulas.find(name);
+  auto tf = find(name);
+  if (tf == nullptr) throw ex_formula_not_found(wide2utf8(name));
+  return tf;
+}
+
+sptr<Formula> Formula::find(const wstring& name) {
+  // the formula may use the macros the user defined, the contexts with the
+  // same definitions share the same template
+  const MacroScope* scope = MacroScope::current();
+  const auto key = make_pair(name, scope == nullptr ? 0 : scope->_fingerprint);
+  auto it = _predefinedTeXFormulas.find(key);
   if (it == _predefinedTeXFormulas.end()) {
-    auto i = _predefinedTeXFormulasAsString.find(name);
-    if (i == _predefinedTeXFormulasAsString.end())
-      throw ex_formula_not_found(wide2utf8(name));
-    auto tf = sptrOf<Formula>(i->second);
-    auto* ra = dynamic_cast<RowAtom*>(tf->_root.get());
-    if (ra == nullptr) {
-      _predefinedTeXFormulas[name] = tf;
-    }
+    const wchar_t* src = findPredefinedTeXFormulaAsString(name);
+    if (src == nullptr) return nullptr;
+    // the formula is cached, must not be allocated from the current arena nor
+    // share the parsed atoms of the current context
+    ArenaSuspension suspension;
+    ParseCacheActivation cache(nullptr);
+    auto tf = sptrOf<Formula>(wstring(src));
+    _predefinedTeXFormulas[key] = tf;
     return tf;
   }
   return it->second;
 }
 
+sptr<Atom> Formula::instantiate() const {
+  return ParseCache::instance(_root);
+}
+
 void Formula::setDPITarget(float dpi) {
   PIXELS_PER_POINT = dpi / 72.f;
 }
 
+// the external fonts are registered lazily, maybe by several contexts concurrently
+static mutex externalFontMutex;
+
 bool Formula::isRegisteredBlock(const UnicodeBlock& block) {
+  lock_guard<mutex> lock(externalFontMutex);
   return _externalFontMap.find(block) != _externalFontMap.end();
 }
 
 FontInfos* Formula::getExternalFont(const UnicodeBlock& block) {
+  lock_guard<mutex> lock(externalFontMutex);
   auto it = _externalFontMap.find(block);
   FontInfos* infos = nullptr;
   if (it == _externalFontMap.end()) {
@@ -175,24 +202,25 @@ void Formula::addSymbolMappings(const string& file) {
 
 void Formula::_free_() {
   for (auto i : _externalFontMap) delete i.second;
+  _externalFontMap.clear();
 }
 
 /*************************************** ArrayFormula implementation ******************************/
 
 ArrayFormula::ArrayFormula() : _row(0), _col(0) {
-  _array.emplace_back();
+  _rowStarts.push_back(0);
 }
 
 void ArrayFormula::addCol() {
-  _array[_row].push_back(_root);
+  _cells.push_back(_root);
   _root = nullptr;
   _col++;
 }
 
 void ArrayFormula::addCol(int n) {
-  _array[_row].push_back(_root);
+  _cells.push_back(_root);
   for (int i = 1; i < n - 1; i++) {
-    _array[_row].push_back(nullptr);
+    _cells.push_back(nullptr);
   }
   _root = nullptr;
   _col += n;
@@ -200,34 +228,39 @@ void ArrayFormula::addCol(int n) {
 
 void ArrayFormula::insertAtomIntoCol(int col, const sptr<Atom>& atom) {
   _col++;
-  for (size_t j = 0; j < _row; j++) {
-    auto it = _array[j].begin();
-    _array[j].insert(it + col, atom);
+  // rebuild the cells at once rather than moving the following rows for each
+  // inserted cell, the rows shorter than the column are filled with empty cells
+  vector<sptr<Atom>> cells;
+  cells.reserve(_cells.size() + _row * (col + 1));
+  for (size_t i = 0; i < _rowStarts.size(); i++) {
+    const size_t start = _rowStarts[i], end = rowEnd(i);
+    _rowStarts[i] = cells.size();
+    if (i >= _row) {
+      cells.insert(cells.end(), _cells.begin() + start, _cells.begin() + end);
+      continue;
+    }
+    for (size_t j = start; j < end || j < start + col; j++) {
+      if (j == start + col) cells.push_back(atom);
+      cells.push_back(j < end ? _cells[j] : nullptr);
+    }
+    if (end <= start + col) cells.push_back(atom);
   }
+  _cells.swap(cells);
 }
 
 void ArrayFormula::addRow() {
   addCol();
-  _array.emplace_back();
+  _rowStarts.push_back(_cells.size());
   _row++;
   _col = 0;
 }
 
 void ArrayFormula::addRowSpecifier(const sptr<CellSpecifier>& spe) {
-  auto it = _rowSpecifiers.find(_row);
-  if (it == _rowSpecifiers.end()) {
-    _rowSpecifiers[_row] = vector<sptr<CellSpecifier>>();
-  }
   _rowSpecifiers[_row].push_back(spe);
 }
 
 void ArrayFormula::addCellSpecifier(const sptr<CellSpecifier>& spe) {
-  string str = tostring(_row) + tostring(_col);
-  auto it = _cellSpecifiers.find(str);
-  if (it == _cellSpecifiers.end()) {
-    _cellSpecifiers[str] = vector<sptr<CellSpecifier>>();
-  }
-  _cellSpecifiers[str].push_back(spe);
+  _cellSpecifiers[{_row, _col}].push_back(spe);
 }
 
 int ArrayFormula::rows() const {
@@ -238,32 +271,28 @@ int ArrayFormula::cols() const {
   return _col;
 }
 
+const sptr<Atom>& ArrayFormula::get(int row, int col) const {
+  static const sptr<Atom> empty;
+  const size_t i = _rowStarts[row] + col;
+  return i < rowEnd(row) ? _cells[i] : empty;
+}
+
 sptr<VRowAtom> ArrayFormula::getAsVRow() {
   auto* vr = new VRowAtom();
   vr->setAddInterline(true);
-  for (auto& c : _array) {
-    for (auto& j : c) vr->append(j);
-  }
+  for (auto& c : _cells) vr->append(c);
   return sptr<VRowAtom>(vr);
 }
 
 void ArrayFormula::checkDimensions() {
-  if (!_array.back().empty() || _root != nullptr) addRow();
+  if (rowEnd(_row) > _rowStarts[_row] || _root != nullptr) addRow();
 
-  _row = _array.size() - 1;
-  _col = _array[0].size();
-
-  // Find the column count of the widest row
-  for (size_t i = 1; i < _row; i++) {
-    if (_array[i].size() > _col) _col = _array[i].size();
-  }
-
-  for (size_t i = 0; i < _row; i++) {
-    size_t j = _array[i].size();
-    if (j != _col && _array[i][0] != nullptr && _array[i][0]->_type != AtomType::interText) {
-      // Fill the row with null atom
-      vector<sptr<Atom>>& r = _array[i];
-      for (; j < _col; j++) r.push_back(nullptr);
-    }
-  }
+  // the last row is empty
+  _row = _rowStarts.size() - 1;
+  _col = 0;
+  // Find the column count of the widest row, the missing cells of the others
+  // are empty
+  for (size_t i = 0; i < _row; i++) _col = max(_col, (size_t) rowSize(i));
+  _cells.shrink_to_fit();
+  _rowStarts.shrink_to_fit();
 }
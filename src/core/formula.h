@@ -49,15 +49,40 @@ struct FontInfos {
 class Formula {
 private:
   TeXParser _parser;
+  // the map in use by \xml, the own one, or the one of the formula this formula
+  // is parsed from
+  std::map<std::string, std::string>* _xml;
+
+  /**
+   * Parse this nested formula, or reuse the atoms of the same text parsed by
+   * the last parse if a ParseCache is active.
+   *
+   * @param latex the text to parse
+   * @param preprocess if the text has been preprocessed by the parser, the
+   *    atoms of the preprocessed text are never reused
+   * @param emptyOnError if set the root to an empty atom if the text failed
+   *    to be parsed in partial mode
+   */
+  void parseNested(const std::wstring& latex, bool preprocess, bool emptyOnError);
 
 public:
   std::map<std::string, std::string> _xmlMap;
-  // point-to-pixel conversion
-  static float PIXELS_PER_POINT;
+  // point-to-pixel conversion, per thread so every LaTeXContext can have its own target DPI
+  static thread_local float PIXELS_PER_POINT;
 
-  // predefined TeX formulas
-  static std::map<std::wstring, sptr<Formula>> _predefinedTeXFormulas;
-  static std::map<std::wstring, std::wstring> _predefinedTeXFormulasAsString;
+  // predefined TeX formulas, parsed once and cached per thread since the
+  // cached atoms are not immutable (e.g. the rows keep state while laid out),
+  // keyed by the name and the fingerprint of the macros they are parsed with
+  static thread_local std::map<std::pair<std::wstring, std::size_t>, sptr<Formula>>
+    _predefinedTeXFormulas;
+
+  /**
+   * Find the source of the predefined TeX formula with the given name, the
+   * sources live in a table sorted at compile time.
+   *
+   * @return the source of the formula, or nullptr if not found
+   */
+  static const wchar_t* findPredefinedTeXFormulaAsString(const std::wstring& name);
 
   // character-to-symbol and character-to-delimiter mappings
   static std::map<int, std::string> _symbolMappings;
@@ -73,7 +98,9 @@ public:
 
   /**
    * Creates a new Formula by parsing the given string (using a primitive
-   * TeX parser).
+   * TeX parser). The string is read in place and the nested formula shares the
+   * state of the formula parsed by the given parser; the string is not
+   * preprocessed again if it comes from a preprocessed formula.
    *
    * @param tp the given TeXParser
    * @param latex the string to be parsed
@@ -112,6 +139,9 @@ public:
    */
   void setLaTeX(const std::wstring& latex);
 
+  /** Get the map of the substitutions of \xml, shared with the outer formula if any */
+  inline std::map<std::string, std::string>& xmlMap() { return *_xml; }
+
   /** Inserts an a at the end of the current formula. */
   Formula* add(const sptr<Atom>& a);
 
@@ -125,7 +155,8 @@ public:
    * Get a predefined Formula.
    *
    * @param name the name of the predefined Formula
-   * @return a <b>copy</b> of the predefined Formula
+   * @return the predefined Formula, it is parsed once and shared by all the
+   * callers on the current thread, thus must not be modified
    *
    * @throw ex_formula_not_found
    *      if no predefined Formula is found with the given name
@@ -133,7 +164,23 @@ public:
   static sptr<Formula> get(const std::wstring& name);
 
   /**
-   * Set the DPI of target
+   * Find a predefined Formula, same as #get(name) but return nullptr instead
+   * of throwing if no predefined Formula is found with the given name.
+   *
+   * The formula is parsed once per thread and per set of macros defined in
+   * the current context, which the formula may use.
+   */
+  static sptr<Formula> find(const std::wstring& name);
+
+  /**
+   * Get the root atom of this (predefined) Formula to insert into a formula
+   * being parsed. The atoms are shared with this Formula, except a row at the
+   * root, which is copied (shallowly) since the parser appends to it.
+   */
+  sptr<Atom> instantiate() const;
+
+  /**
+   * Set the DPI of target for the current thread
    *
    * @param dpi the target DPI
    */
@@ -156,14 +203,42 @@ public:
   virtual ~Formula() = default;
 };
 
+/** Set the point-to-pixel conversion of the current thread during the lifetime of this object */
+class PixelsPerPointScope {
+private:
+  const float _prev;
+
+public:
+  explicit PixelsPerPointScope(float pixelsPerPoint) : _prev(Formula::PIXELS_PER_POINT) {
+    Formula::PIXELS_PER_POINT = pixelsPerPoint;
+  }
+
+  no_copy_assign(PixelsPerPointScope);
+
+  ~PixelsPerPointScope() { Formula::PIXELS_PER_POINT = _prev; }
+};
+
+/**
+ * The cells of an array (matrix, align environment...), built row by row while
+ * the array is parsed. The cells are stored contiguously in row-major order; a
+ * row may have less cells than the array has columns, the missing cells are
+ * empty.
+ */
 class ArrayFormula : public Formula {
 private:
   size_t _row, _col;
+  // the cells of all the rows, in row-major order
+  std::vector<sptr<Atom>> _cells;
+  // the index in _cells of the first cell of each row
+  std::vector<size_t> _rowStarts;
+
+  inline size_t rowEnd(size_t row) const {
+    return row + 1 < _rowStarts.size() ? _rowStarts[row + 1] : _cells.size();
+  }
 
 public:
-  std::vector<std::vector<sptr<Atom>>> _array;
   std::map<int, std::vector<sptr<CellSpecifier>>> _rowSpecifiers;
-  std::map<std::string, std::vector<sptr<CellSpecifier>>> _cellSpecifiers;
+  std::map<std::pair<int, int>, std::vector<sptr<CellSpecifier>>> _cellSpecifiers;
 
   ArrayFormula();
 
@@ -183,6 +258,12 @@ public:
 
   int cols() const;
 
+  /** Get the count of the cells of the given row, it may be less than cols() */
+  inline int rowSize(int row) const { return (int) (rowEnd(row) - _rowStarts[row]); }
+
+  /** Get the atom of the given cell, nullptr if the cell is empty */
+  const sptr<Atom>& get(int row, int col) const;
+
   sptr<VRowAtom> getAsVRow();
 
   void checkDimensions();
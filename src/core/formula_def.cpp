@@ -1,9 +1,10 @@
 #include "core/formula.h"
+#include "utils/sorted_table.h"
 
 using namespace std;
 using namespace tex;
 
-map<wstring, wstring> Formula::_predefinedTeXFormulasAsString{
+static constexpr TableEntry<TableKey<wchar_t>, const wchar_t*> predefinedTeXFormulas[]{
   {L"qquad",              L"\\quad\\quad"},
   {L" ",                  L"\\nbsp"},
   {L"ne",                 L"\\not\\equals"},
@@ -135,3 +136,11 @@ map<wstring, wstring> Formula::_predefinedTeXFormulasAsString{
   {L"TeX",                L"\\large{\\dT\\dE\\dX}\\normalsize"},
   {L"LaTeX",              L"\\text{L\\kern-0.4em\\raisebox{.45ex}{\\scalebox{0.7}{A}}\\kern-.2em T\\kern-.15em\\raisebox{-.5ex}{E}\\kern-.15em X}"},
 };
+
+// sorted at compile time since C++14, at startup otherwise
+static SORTED_TABLE_CONSTEXPR const auto predefined = sortedTable(predefinedTeXFormulas);
+
+const wchar_t* Formula::findPredefinedTeXFormulaAsString(const wstring& name) {
+  const auto src = predefined.find(name);
+  return src == nullptr ? nullptr : *src;
+}
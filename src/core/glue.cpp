@@ -1,6 +1,9 @@
 #include "core/core.h"
 #include "glue.h"
 
+#include <algorithm>
+#include <vector>
+
 using namespace std;
 using namespace tex;
 
@@ -68,9 +71,33 @@ int Glue::indexOf(AtomType ltype, AtomType rtype, const Environment& env) {
   return _table[static_cast<u8>(l)][static_cast<u8>(r)][k] - '0';
 }
 
+sptr<Box> Glue::getBox(int index, float factor) {
+  // the boxes of the glue types per factor, there are few factors in use
+  // (one per size and style), the cache is reset if there are too many
+  struct Boxes {
+    float factor;
+    sptr<Box> boxes[4];
+  };
+  static thread_local vector<Boxes> cache;
+
+  auto it = find_if(cache.begin(), cache.end(), [&](const Boxes& b) { return b.factor == factor; });
+  if (it == cache.end()) {
+    if (cache.size() >= 32) cache.clear();
+    cache.push_back({factor, {}});
+    it = cache.end() - 1;
+  }
+  sptr<Box>& box = it->boxes[index];
+  if (box == nullptr) {
+    // never from an arena, the box outlives the render
+    const Glue& glue = _glueTypes[index];
+    box = make_shared<GlueBox>(glue._space * factor, glue._stretch * factor, glue._shrink * factor);
+  }
+  return box;
+}
+
 sptr<Box> Glue::get(AtomType ltype, AtomType rtype, const Environment& env) {
   int i = indexOf(ltype, rtype, env);
-  return _glueTypes[i].createBox(env);
+  return getBox(i, getFactor(env));
 }
 
 const Glue& Glue::getGlue(SpaceType skipType) {
@@ -26,6 +26,13 @@ private:
 
   sptr<Box> createBox(const Environment& env) const;
 
+  /**
+   * Get the box of the glue type of the given index scaled by the given
+   * factor, the boxes are immutable and shared by all the rows laid out on
+   * the current thread.
+   */
+  static sptr<Box> getBox(int index, float factor);
+
   static float getFactor(const Environment& env);
 
   static const Glue& getGlue(SpaceType skipType);
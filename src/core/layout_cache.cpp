@@ -0,0 +1,88 @@
+#include "core/layout_cache.h"
+#include "atom/atom_basic.h"
+#include "atom/atom_char.h"
+#include "box/box_single.h"
+#include "core/core.h"
+
+using namespace std;
+using namespace tex;
+
+thread_local LayoutCache* LayoutCache::_current = nullptr;
+
+bool LayoutCache::Key::operator==(const Key& o) const {
+  return atom == o.atom
+         && prevType == o.prevType
+         && style == o.style
+         && flags == o.flags
+         && lastFontId == o.lastFontId
+         && size == o.size
+         && fontScale == o.fontScale
+         && scale == o.scale
+         && textWidth == o.textWidth
+         && interline == o.interline
+         && interlineUnit == o.interlineUnit
+         && textStyle == o.textStyle;
+}
+
+size_t LayoutCache::KeyHash::operator()(const Key& k) const {
+  size_t h = hash<Atom*>()(k.atom.get());
+  h = h * 31 + static_cast<size_t>(k.prevType);
+  h = h * 31 + static_cast<size_t>(k.style);
+  h = h * 31 + hash<string>()(k.textStyle);
+  h = h * 31 + k.flags;
+  h = h * 31 + k.lastFontId;
+  h = h * 31 + hash<float>()(k.size);
+  h = h * 31 + hash<float>()(k.scale);
+  return h * 31 + hash<float>()(k.textWidth);
+}
+
+LayoutCache* LayoutCache::activate(LayoutCache* cache) {
+  LayoutCache* prev = _current;
+  _current = cache;
+  return prev;
+}
+
+LayoutCache::Key LayoutCache::keyOf(const sptr<Atom>& atom, AtomType prevType, Environment& env) {
+  TeXFont& tf = *env.getTeXFont();
+  const auto interline = env.getInterlineSpec();
+  const unsigned flags = (unsigned) env.getSmallCap()
+                         | (unsigned) tf.isBold() << 1
+                         | (unsigned) tf.isRoman() << 2
+                         | (unsigned) tf.isSs() << 3
+                         | (unsigned) tf.isTt() << 4
+                         | (unsigned) tf.isIt() << 5;
+  return {
+    atom, prevType, env.getStyle(), env.getTextStyle(), flags, env.getLastFontId(),
+    tf.getSize(), tf.getScaleFactor(), env.getScaleFactor(), env.getTextWidth(),
+    interline.second, interline.first
+  };
+}
+
+sptr<Box> LayoutCache::createBox(const sptr<Atom>& atom, AtomType prevType, Environment& env) {
+  // a char is cheaper to lay out than to look up, and the box of a middle
+  // delimiter is made by the fenced atom around it
+  if (dynamic_cast<CharSymbol*>(atom.get()) != nullptr
+      || dynamic_cast<MiddleAtom*>(atom.get()) != nullptr) {
+    return atom->createBox(env);
+  }
+  // an atom laid out with the sized middle delimiters may contain one (e.g.
+  // a scripted \middle), its box differs from the one laid out without them
+  if (env.hasMiddleBoxes()) return Row::createBox(atom, env, prevType);
+
+  Key key = keyOf(atom, prevType, env);
+  const auto it = _boxes.find(key);
+  if (it != _boxes.end()) {
+    env.setLastFontId(it->second.lastFontId);
+    return it->second.box;
+  }
+
+  auto box = Row::createBox(atom, env, prevType);
+  // the atoms that change the environment they are laid out in (but the last
+  // used font) can not be skipped, and a char box may be modified by the row
+  Key after = keyOf(atom, prevType, env);
+  after.lastFontId = key.lastFontId;
+  if (box != nullptr && after == key && dynamic_cast<CharBox*>(box.get()) == nullptr) {
+    _boxes.emplace(std::move(key), Entry{box, env.getLastFontId()});
+  }
+  return box;
+}
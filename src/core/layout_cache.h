@@ -0,0 +1,112 @@
+#ifndef LAYOUT_CACHE_H_INCLUDED
+#define LAYOUT_CACHE_H_INCLUDED
+
+#include <string>
+#include <unordered_map>
+
+#include "atom/atom.h"
+#include "box/box.h"
+#include "common.h"
+
+namespace tex {
+
+class Environment;
+
+/**
+ * The boxes laid out from the atoms of a formula, keyed by the atom and the
+ * environment it was laid out in, so the atoms that appear several times in
+ * the formula (the parser shares the atoms parsed from the same source, see
+ * ParseCache) are laid out once and their box is shared.
+ *
+ * A box is shared only in the rows, the box of an element of a row is added
+ * as is into the box of the row and never modified. The atoms around a row
+ * modify the box of the row (e.g. shift it), never the boxes in it, and the
+ * line breaking copies the rows it breaks rather than modify them. The boxes
+ * modified in place by the row (the chars) and the atoms whose box depends
+ * on the layout of another atom (the middle delimiters, and the atoms laid
+ * out with their sized boxes) are never cached.
+ *
+ * The cache can be activated on the current thread while a formula is laid
+ * out, see TeXRenderBuilder::setMemoize.
+ */
+class LayoutCache {
+private:
+  struct Key {
+    // the atom is held so its address is not reused while it is cached
+    sptr<Atom> atom;
+    // the type of the atom before a row, or AtomType::none
+    AtomType prevType;
+    TexStyle style;
+    std::string textStyle;
+    // the flags of the environment and of its font
+    unsigned flags;
+    int lastFontId;
+    float size, fontScale, scale, textWidth, interline;
+    UnitType interlineUnit;
+
+    bool operator==(const Key& o) const;
+  };
+
+  struct KeyHash {
+    std::size_t operator()(const Key& k) const;
+  };
+
+  struct Entry {
+    sptr<Box> box;
+    // the last used font id once the atom is laid out
+    int lastFontId;
+  };
+
+  static thread_local LayoutCache* _current;
+
+  std::unordered_map<Key, Entry, KeyHash> _boxes;
+
+  static Key keyOf(const sptr<Atom>& atom, AtomType prevType, Environment& env);
+
+public:
+  LayoutCache() = default;
+
+  no_copy_assign(LayoutCache);
+
+  /** Get the cache active on the current thread, nullptr if none. */
+  inline static LayoutCache* current() { return _current; }
+
+  /**
+   * Make the given cache active on the current thread.
+   *
+   * @param cache the cache to activate, nullptr to deactivate
+   * @return the previous active cache
+   */
+  static LayoutCache* activate(LayoutCache* cache);
+
+  /**
+   * Create the box of the given element of a row, or get the one created
+   * before from the same atom in the same environment.
+   *
+   * @param atom the atom to lay out
+   * @param prevType the type of the atom before the given one if it is a row
+   * (its layout depends on it), AtomType::none otherwise
+   * @param env the environment to lay out in
+   */
+  sptr<Box> createBox(const sptr<Atom>& atom, AtomType prevType, Environment& env);
+
+  /** Get the count of the cached boxes. */
+  inline std::size_t size() const { return _boxes.size(); }
+};
+
+/** Activate a LayoutCache on the current thread during the lifetime of this object */
+class LayoutCacheActivation {
+private:
+  LayoutCache* const _prev;
+
+public:
+  explicit LayoutCacheActivation(LayoutCache* cache) : _prev(LayoutCache::activate(cache)) {}
+
+  no_copy_assign(LayoutCacheActivation);
+
+  ~LayoutCacheActivation() { LayoutCache::activate(_prev); }
+};
+
+}  // namespace tex
+
+#endif  // LAYOUT_CACHE_H_INCLUDED
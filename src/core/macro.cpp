@@ -7,13 +7,52 @@
 using namespace std;
 using namespace tex;
 
-bool NewCommandMacro::_errIfConflict = true;
+thread_local bool NewCommandMacro::_errIfConflict = true;
+
+thread_local MacroScope* MacroScope::_current = nullptr;
+
+MacroScope* MacroScope::activate(MacroScope* scope) {
+  MacroScope* prev = _current;
+  _current = scope;
+  return prev;
+}
+
+void MacroScope::clear() {
+  for (const auto& i : _commands) delete i.second;
+  _commands.clear();
+  _codes.clear();
+  _replacements.clear();
+  _columnSpecifiers.clear();
+  _colors.clear();
+  _fingerprint = 0;
+}
+
+MacroScope::~MacroScope() {
+  clear();
+}
 
 bool NewCommandMacro::isMacro(const wstring& name) {
+  MacroScope* scope = MacroScope::current();
+  if (scope != nullptr && scope->_codes.find(name) != scope->_codes.end()) return true;
   auto it = _codes.find(name);
   return (it != _codes.end());
 }
 
+void NewCommandMacro::define(const wstring& name, const wstring& code) {
+  MacroScope* scope = MacroScope::current();
+  auto& codes = scope == nullptr ? _codes : scope->_codes;
+  codes[name] = code;
+  MacroScope::record(name, code);
+}
+
+void NewCommandMacro::define(const wstring& name, const wstring& code, const wstring& def) {
+  define(name, code);
+  MacroScope* scope = MacroScope::current();
+  auto& replacements = scope == nullptr ? _replacements : scope->_replacements;
+  replacements[name] = def;
+  MacroScope::record(def);
+}
+
 void NewCommandMacro::checkNew(const wstring& name) {
   if (_errIfConflict && isMacro(name))
     throw ex_parse(
@@ -32,7 +71,7 @@ void NewCommandMacro::checkRenew(const wstring& name) {
 
 void NewCommandMacro::addNewCommand(const wstring& name, const wstring& code, int argc) {
   checkNew(name);
-  _codes[name] = code;
+  define(name, code);
   MacroInfo::add(name, new InflationMacroInfo(_instance, argc));
 }
 
@@ -43,14 +82,13 @@ void NewCommandMacro::addNewCommand(
   const wstring& def
 ) {
   checkNew(name);
-  _codes[name] = code;
-  _replacements[name] = def;
+  define(name, code, def);
   MacroInfo::add(name, new InflationMacroInfo(_instance, argc, 1));
 }
 
 void NewCommandMacro::addRenewCommand(const wstring& name, const wstring& code, int argc) {
   checkRenew(name);
-  _codes[name] = code;
+  define(name, code);
   MacroInfo::add(name, new InflationMacroInfo(_instance, argc));
 }
 
@@ -61,18 +99,21 @@ void NewCommandMacro::addRenewCommand(
   const wstring& def
 ) {
   checkRenew(name);
-  _codes[name] = code;
-  _replacements[name] = def;
+  define(name, code, def);
   MacroInfo::add(name, new InflationMacroInfo(_instance, argc, 1));
 }
 
 void NewCommandMacro::execute(TeXParser& tp, vector<wstring>& args) {
-  wstring code = _codes[args[0]];
-  wstring rep;
-  size_t argc = args.size() - 12;
-  int dec = 0;
+  MacroScope* scope = MacroScope::current();
+  const bool local = scope != nullptr && scope->_codes.find(args[0]) != scope->_codes.end();
+  auto& codes = local ? scope->_codes : _codes;
+  auto& replacements = local ? scope->_replacements : _replacements;
 
-  auto it = _replacements.find(args[0]);
+  const wstring& code = codes[args[0]];
+  const int argc = (int) args.size() - 12;
+  const wstring* opt = nullptr;
+
+  auto it = replacements.find(args[0]);
 
   // FIXME
   // Keep slash "\" and dollar "$" signs?
@@ -80,21 +121,36 @@ void NewCommandMacro::execute(TeXParser& tp, vector<wstring>& args) {
   //      \newcommand{\cmd}[2][\sqrt{e^x}]{ #2 - #1 }
   // we want the optional argument "\sqrt{e^x}" keep the slash sign
   if (!args[argc + 1].empty()) {
-    dec = 1;
-    // quotereplace(args[argc + 1], rep);
-    replaceall(code, L"#1", args[argc + 1]);
-  } else if (it != _replacements.end()) {
-    dec = 1;
-    // quotereplace(it->second, rep);
-    replaceall(code, L"#1", it->second);
+    opt = &args[argc + 1];
+  } else if (it != replacements.end()) {
+    opt = &it->second;
   }
-
-  for (int i = 1; i <= argc; i++) {
-    rep = args[i];
-    replaceall(code, L"#" + towstring(i + dec), rep);
+  const int dec = opt == nullptr ? 0 : 1;
+
+  // substitute the parameters #1...#9 in one pass, the substituted arguments
+  // are never scanned again
+  wstring inflated;
+  inflated.reserve(code.size());
+  const size_t len = code.size();
+  for (size_t i = 0; i < len; i++) {
+    const wchar_t ch = code[i];
+    if (ch == L'#' && i + 1 < len && code[i + 1] >= L'1' && code[i + 1] <= L'9') {
+      const int n = code[i + 1] - L'0';
+      if (dec == 1 && n == 1) {
+        inflated += *opt;
+        i++;
+        continue;
+      }
+      if (n - dec <= argc) {
+        inflated += args[n - dec];
+        i++;
+        continue;
+      }
+    }
+    inflated += ch;
   }
   // push back as returned value (inflated macro)
-  args.push_back(code);
+  args.push_back(inflated);
 }
 
 void NewEnvironmentMacro::addNewEnvironment(
@@ -112,7 +168,7 @@ void NewEnvironmentMacro::addRenewEnvironment(
   const wstring& begDef, const wstring& endDef,
   int argc
 ) {
-  if (_codes.find(name + L"@env") == _codes.end()) {
+  if (!isMacro(name + L"@env")) {
     throw ex_parse(
       "Environment " + wide2utf8(name)
       + "is not defined! Use newenvironment instead!"
@@ -127,22 +183,34 @@ void NewEnvironmentMacro::addRenewEnvironment(
 
 void NewCommandMacro::_free_() {
   delete _instance;
+  _instance = nullptr;
+  _codes.clear();
+  _replacements.clear();
 }
 
 void MacroInfo::add(const wstring& name, MacroInfo* mac) {
-  auto it = _commands.find(name);
-  if (it != _commands.end()) delete it->second;
-  _commands[name] = mac;
+  MacroScope* scope = MacroScope::current();
+  auto& commands = scope == nullptr ? _commands : scope->_commands;
+  auto it = commands.find(name);
+  if (it != commands.end()) delete it->second;
+  commands[name] = mac;
+  MacroScope::record(name, mac->_argc, mac->_posOpts);
 }
 
 MacroInfo* MacroInfo::get(const std::wstring& name) {
+  MacroScope* scope = MacroScope::current();
+  if (scope != nullptr) {
+    auto it = scope->_commands.find(name);
+    if (it != scope->_commands.end()) return it->second;
+  }
   auto it = _commands.find(name);
-  if (it == _commands.end()) return nullptr;
+  if (it == _commands.end()) return findPredefined(name);
   return it->second;
 }
 
 void MacroInfo::_free_() {
   for (const auto& i : _commands) delete i.second;
+  _commands.clear();
 }
 
 sptr<Atom> PreDefMacro::invoke(
@@ -4,12 +4,83 @@
 #include "atom/atom.h"
 #include "common.h"
 
+#include <functional>
 #include <map>
 #include <string>
 
 namespace tex {
 
 class TeXParser;
+class MacroInfo;
+
+/**
+ * The table of the macros defined while parsing (via \newcommand,
+ * \newenvironment, \newcolumntype, \definecolor and so on). The predefined macros live in
+ * the shared tables that are read-only after initialization, the user-defined
+ * ones go into the scope that is active on the current thread, so different
+ * parsing contexts never see (or race on) each other's definitions. If no
+ * scope is active, the definitions go into the shared tables.
+ */
+class MacroScope {
+private:
+  static thread_local MacroScope* _current;
+
+public:
+  std::map<std::wstring, std::wstring> _codes;
+  std::map<std::wstring, std::wstring> _replacements;
+  std::map<std::wstring, MacroInfo*> _commands;
+  std::map<std::wstring, std::wstring> _columnSpecifiers;
+  std::map<std::string, color> _colors;
+  // the hash of all the definitions made (in order) in this scope, the
+  // formulas parsed with the same fingerprint see the same macros
+  std::size_t _fingerprint = 0;
+
+  MacroScope() = default;
+
+  no_copy_assign(MacroScope);
+
+  /** Get the scope active on the current thread, nullptr if none. */
+  inline static MacroScope* current() { return _current; }
+
+  /**
+   * Make the given scope active on the current thread.
+   *
+   * @param scope the scope to activate, nullptr to deactivate
+   * @return the previous active scope
+   */
+  static MacroScope* activate(MacroScope* scope);
+
+  /**
+   * Record a definition (or any other change that alters the way the formulas
+   * are parsed) into the fingerprint of the active scope if any.
+   */
+  template <typename... Ts>
+  static void record(const Ts&... values) {
+    if (_current == nullptr) return;
+    std::size_t& h = _current->_fingerprint;
+    // the elements of a braced list are evaluated in order
+    const int mix[] = {0, ((h = h * 31 + std::hash<Ts>()(values) + 0x9e3779b9), 0)...};
+    (void) mix;
+  }
+
+  /** Remove all the definitions of this scope. */
+  void clear();
+
+  ~MacroScope();
+};
+
+/** Activate a MacroScope on the current thread during the lifetime of this object */
+class MacroScopeActivation {
+private:
+  MacroScope* const _prev;
+
+public:
+  explicit MacroScopeActivation(MacroScope* scope) : _prev(MacroScope::activate(scope)) {}
+
+  no_copy_assign(MacroScopeActivation);
+
+  ~MacroScopeActivation() { MacroScope::activate(_prev); }
+};
 
 class Macro {
 public:
@@ -28,13 +99,22 @@ protected:
 
   static void checkRenew(const std::wstring& name);
 
+  /** Store the code of the given command into the active MacroScope if any. */
+  static void define(const std::wstring& name, const std::wstring& code);
+
+  static void define(
+    const std::wstring& name,
+    const std::wstring& code,
+    const std::wstring& def
+  );
+
 public:
   /**
    * If notify a fatal error when defining a new command but it has been
    * defined already or redefine a command but it has not been defined,
    * default is true.
    */
-  static bool _errIfConflict;
+  static thread_local bool _errIfConflict;
 
   void execute(TeXParser& tp, std::vector<std::wstring>& args) override;
 
@@ -91,13 +171,25 @@ public:
 };
 
 class MacroInfo {
+private:
+  /** Find the predefined macro with the given name, return nullptr if not found. */
+  static MacroInfo* findPredefined(const std::wstring& name);
+
 public:
+  // the macros added while no MacroScope is active, the predefined ones live
+  // in a table sorted at compile time and are shadowed by these
   static std::map<std::wstring, MacroInfo*> _commands;
 
-  /** Add a macro, replace it if the macro is exists. */
+  /**
+   * Add a macro, replace it if the macro is exists. The macro goes into the
+   * active MacroScope if any.
+   */
   static void add(const std::wstring& name, MacroInfo* mac);
 
-  /** Get the macro info from given name, return nullptr if not found. */
+  /**
+   * Get the macro info from given name, return nullptr if not found. The
+   * active MacroScope is looked up first.
+   */
   static MacroInfo* get(const std::wstring& name);
 
   // Number of arguments
@@ -110,11 +202,11 @@ public:
   //      \scalebox{0.5}[2]{\LaTeX}
   const int _posOpts;
 
-  MacroInfo() : _argc(0), _posOpts(0) {}
+  constexpr MacroInfo() : _argc(0), _posOpts(0) {}
 
-  MacroInfo(int argc, int posOpts) : _argc(argc), _posOpts(posOpts) {}
+  constexpr MacroInfo(int argc, int posOpts) : _argc(argc), _posOpts(posOpts) {}
 
-  explicit MacroInfo(int argc) : _argc(argc), _posOpts(0) {}
+  constexpr explicit MacroInfo(int argc) : _argc(argc), _posOpts(0) {}
 
   virtual sptr<Atom> invoke(
     TeXParser& tp,
@@ -160,10 +252,10 @@ private:
 public:
   PreDefMacro() = delete;
 
-  PreDefMacro(int argc, int posOpts, MacroDelegate delegate)
+  constexpr PreDefMacro(int argc, int posOpts, MacroDelegate delegate)
     : MacroInfo(argc, posOpts), _delegate(delegate) {}
 
-  PreDefMacro(int argc, MacroDelegate delegate)
+  constexpr PreDefMacro(int argc, MacroDelegate delegate)
     : MacroInfo(argc), _delegate(delegate) {}
 
   sptr<Atom> invoke(
@@ -1,25 +1,30 @@
 #include "common.h"
 #include "core/macro.h"
 #include "macro_impl.h"
+#include "utils/sorted_table.h"
 
 using namespace std;
 using namespace tex;
 
-#define mac3(argc, name, code) \
-  { L##code, m(argc, name) }
+/**
+ * The predefined macro with the given delegate and arguments, one instance per
+ * combination, constant initialized, so it needs no allocation at startup.
+ */
+template <MacroDelegate del, int argc, int posOpts>
+struct PreDef {
+  static PreDefMacro instance;
+};
 
-#define mac4(argc, posOpts, name, code) \
-  { L##code, m(argc, posOpts, name) }
+template <MacroDelegate del, int argc, int posOpts>
+PreDefMacro PreDef<del, argc, posOpts>::instance(argc, posOpts, del);
 
-inline static PreDefMacro* m(int argc, int posOpts, MacroDelegate del) {
-  return new PreDefMacro(argc, posOpts, del);
-}
+#define mac3(argc, name, code) \
+  { L##code, &PreDef<name, argc, 0>::instance }
 
-inline static PreDefMacro* m(int argc, MacroDelegate del) {
-  return new PreDefMacro(argc, del);
-}
+#define mac4(argc, posOpts, name, code) \
+  { L##code, &PreDef<name, argc, posOpts>::instance }
 
-map<wstring, MacroInfo*> MacroInfo::_commands{
+static constexpr TableEntry<TableKey<wchar_t>, MacroInfo*> predefinedMacros[]{
 #define mac mac4
     mac(2, 2, macro_newcommand, "newcommand"),
     mac(2, 2, macro_renewcommand, "renewcommand"),
@@ -326,6 +331,16 @@ map<wstring, MacroInfo*> MacroInfo::_commands{
 #endif  // GRAPHICS_DEBUG
 };
 
+// sorted at compile time since C++14, at startup otherwise
+static SORTED_TABLE_CONSTEXPR const auto predefined = sortedTable(predefinedMacros);
+
+MacroInfo* MacroInfo::findPredefined(const wstring& name) {
+  const auto mac = predefined.find(name);
+  return mac == nullptr ? nullptr : *mac;
+}
+
+map<wstring, MacroInfo*> MacroInfo::_commands;
+
 map<wstring, wstring> NewCommandMacro::_codes;
 map<wstring, wstring> NewCommandMacro::_replacements;
 Macro* NewCommandMacro::_instance = new NewCommandMacro();
@@ -348,6 +363,7 @@ inline static void cmd(
 }
 
 void NewCommandMacro::_init_() {
+  if (_instance == nullptr) _instance = new NewCommandMacro();
   // region Predefined environments
   env(1, L"array", L"\\array@@env{#1}{", L"}");
   env(1, L"tabular", L"\\array@@env{#1}{", L"}");
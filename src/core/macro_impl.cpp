@@ -432,7 +432,7 @@ macro(muskips) {
 }
 
 macro(xml) {
-  map<string, string>& m = tp._formula->_xmlMap;
+  map<string, string>& m = tp._formula->xmlMap();
   wstring str(args[1]);
   wstring buf;
   size_t start = 0;
@@ -460,7 +460,8 @@ macro(xml) {
   buf.append(str);
   str = buf;
 
-  return Formula(tp, str)._root;
+  // the substituted values are not from the source, preprocess them
+  return Formula(tp, str, true)._root;
 }
 
 }  // namespace tex
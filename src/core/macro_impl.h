@@ -23,11 +23,13 @@ namespace tex {
 
 inline macro(debug) {
   Formula::setDEBUG(true);
+  MacroScope::record(args[0]);
   return nullptr;
 }
 
 inline macro(undebug) {
   Formula::setDEBUG(false);
+  MacroScope::record(args[0]);
   return nullptr;
 }
 
@@ -35,6 +37,7 @@ inline macro(undebug) {
 
 inline macro(fatalIfCmdConflict) {
   NewCommandMacro::_errIfConflict = args[1] == L"true";
+  MacroScope::record(args[0], args[1]);
   return nullptr;
 }
 
@@ -228,12 +231,12 @@ inline macro(binom) {
 
 inline macro(above) {
   auto num = tp.popFormulaAtom();
-  auto[unit, value] = tp.getLength();
+  const auto length = tp.getLength();
   auto den = Formula(tp, tp.getOverArgument(), false)._root;
   if (num == nullptr || den == nullptr)
     throw ex_parse("Both numerator and denominator of a fraction can't be empty!");
 
-  return sptrOf<FractionAtom>(num, den, unit, value);
+  return sptrOf<FractionAtom>(num, den, length.first, length.second);
 }
 
 inline macro(mbox) {
@@ -473,11 +476,15 @@ inline macro(vdots) {
 }
 
 inline macro(ddots) {
-  return sptrOf<TypedAtom>(AtomType::inner, AtomType::inner, sptrOf<DdtosAtom>());
+  // the dots are as wide as \ldots with the macros defined so far
+  auto dots = sptrOf<DdtosAtom>(Formula::get(L"ldots")->instantiate());
+  return sptrOf<TypedAtom>(AtomType::inner, AtomType::inner, dots);
 }
 
 inline macro(iddots) {
-  return sptrOf<TypedAtom>(AtomType::inner, AtomType::inner, sptrOf<IddotsAtom>());
+  // the dots are as wide as \ldots with the macros defined so far
+  auto dots = sptrOf<IddotsAtom>(Formula::get(L"ldots")->instantiate());
+  return sptrOf<TypedAtom>(AtomType::inner, AtomType::inner, dots);
 }
 
 inline macro(leftparenthesis) {
@@ -522,7 +529,7 @@ inline macro(backslashcr) {
 
 inline macro(smallmatrixATATenv) {
   auto* arr = new ArrayFormula();
-  TeXParser parser(tp.isPartial(), args[1], arr, false);
+  TeXParser parser(tp, args[1], arr, false);
   parser.parse();
   arr->checkDimensions();
   return sptrOf<MatrixAtom>(tp.isPartial(), sptr<ArrayFormula>(arr), MatrixType::smallMatrix);
@@ -530,7 +537,7 @@ inline macro(smallmatrixATATenv) {
 
 inline macro(matrixATATenv) {
   auto* arr = new ArrayFormula();
-  TeXParser parser(tp.isPartial(), args[1], arr, false);
+  TeXParser parser(tp, args[1], arr, false);
   parser.parse();
   arr->checkDimensions();
   return sptrOf<MatrixAtom>(tp.isPartial(), sptr<ArrayFormula>(arr), MatrixType::matrix);
@@ -559,7 +566,7 @@ inline macro(hdotsfor) {
 
 inline macro(arrayATATenv) {
   auto* arr = new ArrayFormula();
-  TeXParser parser(tp.isPartial(), args[2], arr, false);
+  TeXParser parser(tp, args[2], arr, false);
   parser.parse();
   arr->checkDimensions();
   return sptrOf<MatrixAtom>(tp.isPartial(), sptr<ArrayFormula>(arr), args[1], true);
@@ -567,7 +574,7 @@ inline macro(arrayATATenv) {
 
 inline macro(alignATATenv) {
   auto* arr = new ArrayFormula();
-  TeXParser parser(tp.isPartial(), args[1], arr, false);
+  TeXParser parser(tp, args[1], arr, false);
   parser.parse();
   arr->checkDimensions();
   return sptrOf<MatrixAtom>(tp.isPartial(), sptr<ArrayFormula>(arr), MatrixType::align);
@@ -575,7 +582,7 @@ inline macro(alignATATenv) {
 
 inline macro(flalignATATenv) {
   auto* arr = new ArrayFormula();
-  TeXParser parser(tp.isPartial(), args[1], arr, false);
+  TeXParser parser(tp, args[1], arr, false);
   parser.parse();
   arr->checkDimensions();
   return sptrOf<MatrixAtom>(tp.isPartial(), sptr<ArrayFormula>(arr), MatrixType::flAlign);
@@ -583,7 +590,7 @@ inline macro(flalignATATenv) {
 
 inline macro(alignatATATenv) {
   auto* arr = new ArrayFormula();
-  TeXParser par(tp.isPartial(), args[2], arr, false);
+  TeXParser par(tp, args[2], arr, false);
   par.parse();
   arr->checkDimensions();
   size_t n = 0;
@@ -595,7 +602,7 @@ inline macro(alignatATATenv) {
 
 inline macro(alignedATATenv) {
   auto* arr = new ArrayFormula();
-  TeXParser p(tp.isPartial(), args[1], arr, false);
+  TeXParser p(tp, args[1], arr, false);
   p.parse();
   arr->checkDimensions();
   return sptrOf<MatrixAtom>(tp.isPartial(), sptr<ArrayFormula>(arr), MatrixType::aligned);
@@ -603,7 +610,7 @@ inline macro(alignedATATenv) {
 
 inline macro(alignedatATATenv) {
   auto* arr = new ArrayFormula();
-  TeXParser p(tp.isPartial(), args[2], arr, false);
+  TeXParser p(tp, args[2], arr, false);
   p.parse();
   arr->checkDimensions();
   size_t n = 0;
@@ -617,7 +624,7 @@ inline macro(alignedatATATenv) {
 
 inline macro(multlineATATenv) {
   auto* arr = new ArrayFormula();
-  TeXParser p(tp.isPartial(), args[1], arr, false);
+  TeXParser p(tp, args[1], arr, false);
   p.parse();
   arr->checkDimensions();
   if (arr->cols() > 1) {
@@ -630,7 +637,7 @@ inline macro(multlineATATenv) {
 
 inline macro(gatherATATenv) {
   auto* arr = new ArrayFormula();
-  TeXParser p(tp.isPartial(), args[1], arr, false);
+  TeXParser p(tp, args[1], arr, false);
   p.parse();
   arr->checkDimensions();
   if (arr->cols() > 1) throw ex_parse("Requires exact one column in gather envrionment!");
@@ -642,7 +649,7 @@ inline macro(gatherATATenv) {
 
 inline macro(gatheredATATenv) {
   auto* arr = new ArrayFormula();
-  TeXParser p(tp.isPartial(), args[1], arr, false);
+  TeXParser p(tp, args[1], arr, false);
   p.parse();
   arr->checkDimensions();
   if (arr->cols() > 1) throw ex_parse("Requires exact one column in gathered envrionment!");
@@ -996,6 +1003,7 @@ inline macro(doteq) {
 inline macro(externalfont) {
   std::string x = wide2utf8(args[1]);
   TextRenderingBox::setFont(x);
+  MacroScope::record(args[1]);
   return nullptr;
 }
 
@@ -1019,6 +1027,7 @@ inline macro(declaremathsizes) {
   float a, b, c, d;
   valueof(args[1], a), valueof(args[2], b), valueof(args[3], c), valueof(args[4], d);
   DefaultTeXFont::setMathSizes(a, b, c, c);
+  MacroScope::record(a, b, c, d);
   return nullptr;
 }
 
@@ -1026,6 +1035,7 @@ inline macro(magnification) {
   float x;
   valueof(args[1], x);
   DefaultTeXFont::setMagnification(x);
+  MacroScope::record(x);
   return nullptr;
 }
 
@@ -0,0 +1,61 @@
+#include "core/parse_cache.h"
+#include "atom/atom_basic.h"
+#include "atom/atom_row.h"
+
+using namespace std;
+using namespace tex;
+
+thread_local ParseCache* ParseCache::_current = nullptr;
+
+size_t ParseCache::KeyHash::operator()(const Key& k) const {
+  size_t h = hash<wstring>()(k.text);
+  h = h * 31 + hash<string>()(k.textStyle);
+  h = h * 31 + k.state.fingerprint;
+  return h * 31 + k.state.flags;
+}
+
+ParseCache* ParseCache::activate(ParseCache* cache) {
+  ParseCache* prev = _current;
+  _current = cache;
+  return prev;
+}
+
+sptr<Atom> ParseCache::find(const Key& key) {
+  auto it = _next.find(key);
+  if (it != _next.end()) return it->second;
+  it = _last.find(key);
+  if (it == _last.end()) return nullptr;
+  _next.emplace(it->first, it->second);
+  return it->second;
+}
+
+void ParseCache::put(Key&& key, const sptr<Atom>& atom) {
+  // the scripts that follow these atoms are added into them in place, and a
+  // middle delimiter is sized by the fenced atom it was parsed in, they can
+  // not be shared
+  if (dynamic_cast<CumulativeScriptsAtom*>(atom.get()) != nullptr
+      || dynamic_cast<OverUnderDelimiter*>(atom.get()) != nullptr
+      || dynamic_cast<MiddleAtom*>(atom.get()) != nullptr) {
+    return;
+  }
+  _next.emplace(std::move(key), atom);
+}
+
+void ParseCache::commit() {
+  _last.swap(_next);
+  _next.clear();
+}
+
+void ParseCache::rollback() {
+  _next.clear();
+}
+
+void ParseCache::clear() {
+  _last.clear();
+  _next.clear();
+}
+
+sptr<Atom> ParseCache::instance(const sptr<Atom>& atom) {
+  if (dynamic_cast<RowAtom*>(atom.get()) != nullptr) return atom->clone();
+  return atom;
+}
@@ -0,0 +1,124 @@
+#ifndef PARSE_CACHE_H_INCLUDED
+#define PARSE_CACHE_H_INCLUDED
+
+#include <string>
+#include <unordered_map>
+
+#include "atom/atom.h"
+#include "common.h"
+
+namespace tex {
+
+/**
+ * The atoms parsed from the groups, the arguments and the commands of the last
+ * parsed formula, keyed by their source, so the formula can be parsed again
+ * after an edit with the atoms of the untouched groups reused rather than
+ * parsed again. The identical groups of the same formula share their atoms
+ * too.
+ *
+ * A source is parsed into the same atoms as long as the state of the parser
+ * and the macros defined so far are the same, so the key is made of the text
+ * and this state. The groups that change the state (e.g. define a macro) are
+ * never cached, since reusing them would skip the change.
+ *
+ * The cache can be activated on the current thread, then the parsers on this
+ * thread use it, see LaTeXContext::setIncremental and
+ * LaTeXContext::setMemoize.
+ */
+class ParseCache {
+public:
+  /** The state of the parser that the atoms parsed from a text depend on */
+  struct State {
+    // the fingerprint of the macros defined so far, see MacroScope
+    std::size_t fingerprint;
+    // the flags of the parser
+    unsigned flags;
+
+    inline bool operator==(const State& o) const {
+      return fingerprint == o.fingerprint && flags == o.flags;
+    }
+  };
+
+  struct Key {
+    std::wstring text;
+    std::string textStyle;
+    State state;
+
+    inline bool operator==(const Key& o) const {
+      return state == o.state && textStyle == o.textStyle && text == o.text;
+    }
+  };
+
+private:
+  struct KeyHash {
+    std::size_t operator()(const Key& k) const;
+  };
+
+  using Map = std::unordered_map<Key, sptr<Atom>, KeyHash>;
+
+  static thread_local ParseCache* _current;
+
+  // the atoms of the last (committed) parse and of the running one
+  Map _last, _next;
+
+public:
+  ParseCache() = default;
+
+  no_copy_assign(ParseCache);
+
+  /** Get the cache active on the current thread, nullptr if none. */
+  inline static ParseCache* current() { return _current; }
+
+  /**
+   * Make the given cache active on the current thread.
+   *
+   * @param cache the cache to activate, nullptr to deactivate
+   * @return the previous active cache
+   */
+  static ParseCache* activate(ParseCache* cache);
+
+  /**
+   * Find the atom parsed from the given key by the last or the running parse,
+   * return nullptr if not found. The found atom is kept for the next parse.
+   */
+  sptr<Atom> find(const Key& key);
+
+  /**
+   * Put the atom parsed from the given key by the running parse, the atoms
+   * that are modified in place by the parser are ignored.
+   */
+  void put(Key&& key, const sptr<Atom>& atom);
+
+  /** The running parse succeeded, drop the atoms it did not use. */
+  void commit();
+
+  /** The running parse failed, forget the atoms it put. */
+  void rollback();
+
+  /** Forget all the atoms. */
+  void clear();
+
+  /**
+   * Get an instance of the given cached atom to insert into a formula. The
+   * atoms are shared, except a row, which is copied (shallowly) since the
+   * parser appends to it.
+   */
+  static sptr<Atom> instance(const sptr<Atom>& atom);
+};
+
+/** Activate a ParseCache on the current thread during the lifetime of this object */
+class ParseCacheActivation {
+private:
+  ParseCache* const _prev;
+
+public:
+  explicit ParseCacheActivation(ParseCache* cache) : _prev(ParseCache::activate(cache)) {}
+
+  no_copy_assign(ParseCacheActivation);
+
+  ~ParseCacheActivation() { ParseCache::activate(_prev); }
+};
+
+}  // namespace tex
+
+#endif  // PARSE_CACHE_H_INCLUDED
@@ -72,39 +72,61 @@ const set<wstring> TeXParser::_unparsedContents = {
   L"externalFont",
 };
 
-bool TeXParser::_isLoading = false;
+thread_local bool TeXParser::_isLoading = false;
 
 void TeXParser::init(
   bool isPartial,
   const wstring& latex,
   Formula* formula,
-  bool firstPass
+  bool firstPass,
+  bool copy
 ) {
   _pos = _spos = _len = 0;
   _line = _col = 0;
   _group = 0;
   _atIsLetter = 0;
-  _insertion = _arrayMode = _isMathMode = false;
+  _insertion = _arrayMode = _isMathMode = _expanded = false;
   _isPartial = _hideUnknownChar = true;
+  _mark = 0;
+  _preprocessing = false;
 
   _formula = formula;
   _isMathMode = true;
   _isPartial = isPartial;
   if (!latex.empty()) {
-    _latex = latex;
+    if (copy) {
+      _buffer = latex;
+      _latex = _buffer;
+    } else {
+      _latex = latex;
+    }
     _len = latex.length();
     _pos = 0;
     if (firstPass) preprocess();
   } else {
-    _latex = L"";
+    _latex = TextView();
     _pos = 0;
     _len = 0;
   }
   _arrayMode = formula->isArrayMode();
 }
 
+TeXParser::TeXParser(
+  const TeXParser& parent,
+  const wstring& latex,
+  Formula* formula,
+  bool preprocess,
+  bool isMathMode
+) {
+  init(parent._isPartial, latex, formula, preprocess, false);
+  // the text comes from the parent's, so it is as expanded as the parent's
+  if (!preprocess) _expanded = parent._expanded;
+  _isMathMode = isMathMode;
+}
+
 void TeXParser::reset(const wstring& latex) {
-  _latex = latex;
+  _buffer = latex;
+  _latex = _buffer;
   _len = latex.length();
   _formula->_root = nullptr;
   _pos = 0;
@@ -151,8 +173,8 @@ wstring TeXParser::getDollarGroup(wchar_t openclose) {
     if (ch == ESCAPE) _pos++;
   } while (_pos < _len && ch != openclose);
 
-  if (ch == openclose) return _latex.substr(spos, _pos - spos - 1);
-  return _latex.substr(spos, _pos - spos);
+  if (ch == openclose) return wstring(_latex.substr(spos, _pos - spos - 1));
+  return wstring(_latex.substr(spos, _pos - spos));
 }
 
 wstring TeXParser::getGroup(wchar_t open, wchar_t close) {
@@ -177,12 +199,41 @@ wstring TeXParser::getGroup(wchar_t open, wchar_t close) {
 
     _pos++;
 
-    if (group != 0) return _latex.substr(spos + 1, _pos - spos - 1);
-    return _latex.substr(spos + 1, _pos - spos - 2);
+    if (group != 0) return wstring(_latex.substr(spos + 1, _pos - spos - 1));
+    return wstring(_latex.substr(spos + 1, _pos - spos - 2));
   }
   throw ex_parse("Missing '" + tostring((char) open) + "'!");
 }
 
+int TeXParser::findGroupEnd(int pos, wchar_t open, wchar_t close) const {
+  int group = 1;
+  while (pos < _len - 1) {
+    pos++;
+    const wchar_t ch = _latex[pos];
+    if (ch == open) {
+      group++;
+    } else if (ch == close) {
+      if (--group == 0) return pos;
+    } else if (ch == ESCAPE && pos != _len - 1) {
+      pos++;
+    }
+  }
+  return -1;
+}
+
+ParseCache::State TeXParser::cacheState() const {
+  const MacroScope* scope = MacroScope::current();
+  const unsigned flags =
+    _isMathMode
+    | _arrayMode << 1
+    | _isPartial << 2
+    | _hideUnknownChar << 3
+    | _expanded << 4
+    | _insertion << 5
+    | (unsigned) _atIsLetter << 6;
+  return {scope == nullptr ? 0 : scope->_fingerprint, flags};
+}
+
 wstring TeXParser::getGroup(const wstring& open, const wstring& close) {
   int group = 1;
   int ol = open.length();
@@ -328,17 +379,51 @@ wstring TeXParser::getCommand() {
 
   if (_pos == spos) _pos++;
 
-  wstring com = _latex.substr(spos, _pos - spos);
+  wstring com(_latex.substr(spos, _pos - spos));
   if (com == L"cr" && _pos < _len && _latex[_pos] == ' ') _pos++;
 
   return com;
 }
 
 void TeXParser::insert(int beg, int end, const wstring& formula) {
-  _latex.replace(beg, end - beg, formula);
-  _len = _latex.length();
-  _pos = beg;
+  splice(beg, end, formula);
   _insertion = true;
+  _expanded = false;
+}
+
+void TeXParser::own() {
+  if (_latex.data() == _buffer.data() && _latex.length() == _buffer.length()) return;
+  _buffer = wstring(_latex);
+  _latex = _buffer;
+}
+
+void TeXParser::splice(int beg, int end, const wstring& text) {
+  // the consumed text is the output of the preprocessing, save it first
+  if (_preprocessing) {
+    if (_preprocessed.empty()) _preprocessed.reserve(_len);
+    _preprocessed.append(_latex.data() + _mark, beg - _mark);
+  }
+  own();
+  const int n = text.length();
+  if (n <= end) {
+    _pos = end - n;
+    std::copy(text.begin(), text.end(), _buffer.begin() + _pos);
+  } else {
+    // not enough room, make the room at least as large as the unread text,
+    // so the cost of the copy is paid by the expansions that fill the room
+    const int rest = _len - end;
+    const int room = n + rest;
+    wstring buf;
+    buf.reserve(room + n + rest);
+    buf.assign(room, L'\0');
+    buf.append(text);
+    buf.append(_buffer, end, rest);
+    _buffer.swap(buf);
+    _latex = _buffer;
+    _len = _latex.length();
+    _pos = room;
+  }
+  _mark = _pos;
 }
 
 wstring TeXParser::getCommandWithArgs(const wstring& command) {
@@ -388,7 +473,7 @@ void TeXParser::skipWhiteSpace() {
 
 wstring TeXParser::forwardBalancedGroup() {
   if (_group == 0) {
-    const wstring& sub = _latex.substr(_pos);
+    const wstring sub(_latex.substr(_pos));
     finish();
     return sub;
   }
@@ -404,7 +489,7 @@ wstring TeXParser::forwardBalancedGroup() {
   if (closing != 0) {
     throw ex_parse("Found a closing '}' without an opening '{'!");
   }
-  const wstring& sub = _latex.substr(_pos, i - _pos);
+  const wstring sub(_latex.substr(_pos, i - _pos));
   _pos = i;
   return sub;
 }
@@ -484,14 +569,14 @@ sptr<Atom> TeXParser::processEscape() {
     return processCommands(command, mac);
   }
 
+  // most of the commands are symbols or predefined formulas, look them up
+  // without the cost of throwing and catching
+  const auto tf = Formula::find(command);
+  if (tf != nullptr) return tf->instantiate();
+
   const string cmd = wide2utf8(command);
-  try {
-    return Formula::get(command)->_root;
-  } catch (ex_formula_not_found& e) {
-    try {
-      return SymbolAtom::get(cmd);
-    } catch (ex_symbol_not_found& ex) {}
-  }
+  const auto sym = SymbolAtom::find(cmd);
+  if (sym != nullptr) return sym;
 
   // not a valid command or symbol or predefined Formula found
   if (!_isPartial) {
@@ -517,7 +602,34 @@ sptr<Atom> TeXParser::processCommands(const wstring& cmd, MacroInfo* mac) {
     return ret;
   }
 
-  return mac->invoke(*this, args);
+  ParseCache* cache = ParseCache::current();
+  if (cache == nullptr) return mac->invoke(*this, args);
+
+  // the same command with the same arguments makes the same atom in the same
+  // state, share it unless the command reads further or changes the formula
+  wstring text;
+  for (const auto& arg : args) {
+    text += arg;
+    text += L'\0';
+  }
+  ParseCache::Key key{std::move(text), _formula->_textStyle, cacheState()};
+  auto atom = cache->find(key);
+  if (atom != nullptr) return ParseCache::instance(atom);
+
+  const int pos = _pos;
+  const auto root = _formula->_root;
+  auto* row = dynamic_cast<RowAtom*>(root.get());
+  const size_t size = row == nullptr ? 0 : row->size();
+  const auto last = size == 0 ? nullptr : row->get(size - 1);
+  atom = mac->invoke(*this, args);
+  if (atom != nullptr && _pos == pos && _formula->_root == root
+      && (row == nullptr || (row->size() == size && (size == 0 || row->get(size - 1) == last)))
+      && _formula->_textStyle == key.textStyle && cacheState() == key.state) {
+    // the formula appends to a row, keep the cached one intact
+    cache->put(std::move(key), atom);
+    return ParseCache::instance(atom);
+  }
+  return atom;
 }
 
 sptr<Atom> TeXParser::getScripts(wchar_t first) {
@@ -597,13 +709,56 @@ sptr<Atom> TeXParser::getArgument() {
   else return sptrOf<EmptyAtom>();
 
   if (ch == L_GROUP) {
+    // reuse the atoms parsed from the same group by the last parse if any
+    ParseCache* cache = ParseCache::current();
+    ParseCache::Key key;
+    int end = -1;
+    if (cache != nullptr && (end = findGroupEnd(_pos, L_GROUP, R_GROUP)) >= 0) {
+      key = {wstring(_latex.substr(_pos + 1, end - _pos - 1)), "", cacheState()};
+      auto atom = cache->find(key);
+      if (atom != nullptr) {
+        for (int i = _pos; i < end; i++) {
+          if (_latex[i] == '\n') _line++, _col = i;
+        }
+        _pos = end + 1;
+        atom = ParseCache::instance(atom);
+        if (_formula->_root == nullptr) {
+          auto* rm = new RowAtom();
+          rm->add(atom);
+          return sptr<Atom>(rm);
+        }
+        return atom;
+      }
+    }
+
+    // the group is parsed into its own formula, the parser is restored even if
+    // the group fails, so it can parse again (e.g. the next edit of reparse)
+    struct GroupScope {
+      TeXParser& tp;
+      Formula* const formula;
+      const int pos, group;
+      bool parsed;
+
+      ~GroupScope() {
+        tp._formula = formula;
+        if (!parsed) tp._pos = pos, tp._group = group;
+      }
+    };
+
     Formula tf;
-    Formula* tmp = _formula;
-    _formula = &tf;
-    _pos++;
-    _group++;
-    parse();
-    _formula = tmp;
+    {
+      GroupScope scope{*this, _formula, _pos, _group, false};
+      _formula = &tf;
+      _pos++;
+      _group++;
+      parse();
+      scope.parsed = true;
+    }
+    // the group must not change the state nor be closed elsewhere than found
+    if (end >= 0 && _pos == end + 1 && tf._root != nullptr && tf._middle.empty()
+        && key.state == cacheState()) {
+      cache->put(std::move(key), tf._root);
+    }
     if (_formula->_root == nullptr) {
       auto* rm = new RowAtom();
       rm->add(tf._root);
@@ -640,7 +795,7 @@ pair<UnitType, float> TeXParser::getLength() {
   if (ch == '\\') _pos--;
   else skipWhiteSpace();
 
-  return SpaceAtom::getLength(_latex.substr(start, end - start - 1));
+  return SpaceAtom::getLength(wstring(_latex.substr(start, end - start - 1)));
 }
 
 bool TeXParser::replaceScript() {
@@ -648,16 +803,14 @@ bool TeXParser::replaceScript() {
   auto it = SUP_SCRIPT_MAP.find(ch);
   if (it != SUP_SCRIPT_MAP.end()) {
     wstring sup = wstring(L"\\mathcumsup{").append(1, (wchar_t) (it->second)).append(L"}");
-    _latex.replace(_pos, 1, sup);
-    _len = _latex.length();
+    splice(_pos, _pos + 1, sup);
     _pos += sup.size();
     return true;
   }
   it = SUB_SCRIPT_MAP.find(ch);
   if (it != SUB_SCRIPT_MAP.end()) {
     wstring sub = wstring(L"\\mathcumsub{").append(1, (wchar_t) (it->second)).append(L"}");
-    _latex.replace(_pos, 1, sub);
-    _len = _latex.length();
+    splice(_pos, _pos + 1, sub);
     _pos += sub.size();
     return true;
   }
@@ -687,9 +840,7 @@ void TeXParser::preprocessNewCmd(wstring& cmd, Args& args, int& pos) {
   auto mac = MacroInfo::get(cmd);
   getOptsArgs(mac->_argc, mac->_posOpts, args);
   mac->invoke(*this, args);
-  _latex.erase(pos, _pos - pos);
-  _len = _latex.length();
-  _pos = pos;
+  splice(pos, _pos, L"");
 }
 
 void TeXParser::inflateNewCmd(wstring& cmd, Args& args, int& pos) {
@@ -700,13 +851,11 @@ void TeXParser::inflateNewCmd(wstring& cmd, Args& args, int& pos) {
   try {
     mac->invoke(*this, args);
     // The last element is the returned value (after inflated macro)
-    _latex.replace(pos, _pos - pos, args.back());
+    splice(pos, _pos, args.back());
   } catch (ex_parse& e) {
     if (!_isPartial) throw;
-    pos += cmd.length() + 1;
+    _pos = pos + cmd.length() + 1;
   }
-  _len = _latex.length();
-  _pos = pos;
 }
 
 void TeXParser::inflateEnv(wstring& cmd, Args& args, int& pos) {
@@ -727,17 +876,21 @@ void TeXParser::inflateEnv(wstring& cmd, Args& args, int& pos) {
   wstring expr = L"{\\makeatletter \\" + args[1] + L"@env";
   for (int i = 1; i <= mac->_argc - 1; i++) expr += L"{" + optargs[i] + L"}";
   expr += L"{" + grp + L"}\\makeatother}";
-  _latex.replace(pos, _pos - pos, expr);
-  _len = _latex.length();
-  _pos = pos;
+  splice(pos, _pos, expr);
 }
 
 void TeXParser::preprocess() {
-  if (_len == 0) return;
+  if (_len == 0) {
+    _expanded = true;
+    return;
+  }
 
   wchar_t ch;
   int spos;
   vector<wstring> args;
+  _preprocessed.clear();
+  _mark = _pos;
+  _preprocessing = true;
   while (_pos < _len) {
     if (replaceScript()) continue;
 
@@ -762,14 +915,11 @@ void TeXParser::preprocess() {
           if (chr == '\r' || chr == '\n') break;
         }
         if (_pos < _len) _pos--;
-        _latex.replace(spos, _pos - spos, L"");
-        _len = _latex.length();
-        _pos = spos;
+        splice(spos, _pos, L"");
         break;
       }
       case DEGRE: {
-        _latex.replace(_pos, 1, L"^{\\circ}");
-        _len = _latex.length();
+        splice(_pos, _pos + 1, L"^{\\circ}");
         _pos++;
         break;
       }
@@ -778,8 +928,19 @@ void TeXParser::preprocess() {
         break;
     }
   }
-  _pos = 0;
+  _preprocessing = false;
+  if (_preprocessed.empty()) {
+    // nothing is moved out, the unread text is the result, no need to copy
+    _latex = _latex.substr(_mark);
+  } else {
+    _preprocessed.append(_latex.data() + _mark, _len - _mark);
+    _buffer.swap(_preprocessed);
+    _latex = _buffer;
+    _preprocessed.clear();
+  }
+  _pos = _mark = 0;
   _len = _latex.length();
+  _expanded = true;
 }
 
 void TeXParser::parse() {
@@ -846,7 +1007,11 @@ void TeXParser::parse() {
         break;
       case L_GROUP: {
         auto atom = getArgument();
-        if (atom != nullptr) atom->_type = AtomType::ordinary;
+        if (atom != nullptr && atom->_type != AtomType::ordinary) {
+          // the atom may be shared (e.g. a symbol), never change it in place
+          atom = atom->clone();
+          atom->_type = AtomType::ordinary;
+        }
         _formula->add(atom);
       }
         break;
@@ -988,7 +1153,7 @@ sptr<Atom> TeXParser::convertCharacter(wchar_t c, bool oneChar) {
           _pos++;
         }
         return sptrOf<TextRenderingAtom>(
-          _latex.substr(start, en - start + 1), fontInfos);
+          wstring(_latex.substr(start, en - start + 1)), fontInfos);
       }
 
       if (!_isPartial)
@@ -1006,7 +1171,8 @@ sptr<Atom> TeXParser::convertCharacter(wchar_t c, bool oneChar) {
       if (!_isMathMode) {
         auto it = Formula::_symbolTextMappings.find(c);
         if (it != Formula::_symbolTextMappings.end()) {
-          auto atom = SymbolAtom::get(it->second);
+          // copy the predefined symbol, it is shared
+          auto atom = sptrOf<SymbolAtom>(*SymbolAtom::get(it->second));
           atom->setUnicode(c);
           return atom;
         }
@@ -1018,26 +1184,24 @@ sptr<Atom> TeXParser::convertCharacter(wchar_t c, bool oneChar) {
       }
 
       if (sit != Formula::_symbolMappings.end()) {
-        string symbolName = sit->second;
-        try {
-          return SymbolAtom::get(symbolName);
-        } catch (ex_symbol_not_found& e) {
+        const string& symbolName = sit->second;
+        auto sym = SymbolAtom::find(symbolName);
+        if (sym == nullptr) {
           throw ex_parse(
             "The character '" + tostring(c) +
             "' was mapped to an unknown symbol with the name '" + symbolName + "'!",
-            e
+            ex_symbol_not_found(symbolName)
           );
         }
+        return sym;
       }
     }
   } else {
     /*
        * Alphanumeric character
        */
-    FontInfos* infos = nullptr;
-    auto it = Formula::_externalFontMap.find(UnicodeBlock::BASIC_LATIN);
-    if (it != Formula::_externalFontMap.end()) {
-      infos = it->second;
+    if (Formula::isRegisteredBlock(UnicodeBlock::BASIC_LATIN)) {
+      FontInfos* infos = Formula::getExternalFont(UnicodeBlock::BASIC_LATIN);
       if (oneChar) return sptrOf<TextRenderingAtom>(towstring(c), infos);
 
       int start = _pos++;
@@ -1050,7 +1214,7 @@ sptr<Atom> TeXParser::convertCharacter(wchar_t c, bool oneChar) {
         }
         _pos++;
       }
-      return sptrOf<TextRenderingAtom>(_latex.substr(start, en - start + 1), infos);
+      return sptrOf<TextRenderingAtom>(wstring(_latex.substr(start, en - start + 1)), infos);
     }
   }
   return sptrOf<CharAtom>(c, _formula->_textStyle, _isMathMode);
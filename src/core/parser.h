@@ -1,11 +1,13 @@
 #ifndef PARSER_H_INCLUDED
 #define PARSER_H_INCLUDED
 
+#include <algorithm>
 #include <set>
 #include <string>
 
 #include "atom/atom.h"
 #include "common.h"
+#include "core/parse_cache.h"
 
 namespace tex {
 
@@ -21,19 +23,62 @@ class Formula;
 
 class MacroInfo;
 
+/** A view of a text owned by someone else, the text must outlive it */
+class TextView {
+private:
+  const wchar_t* _str;
+  std::size_t _len;
+
+public:
+  TextView() : _str(nullptr), _len(0) {}
+
+  TextView(const wchar_t* str, std::size_t len) : _str(str), _len(len) {}
+
+  TextView(const std::wstring& str) : _str(str.data()), _len(str.length()) {}
+
+  inline wchar_t operator[](std::size_t i) const { return _str[i]; }
+
+  inline const wchar_t* data() const { return _str; }
+
+  inline std::size_t length() const { return _len; }
+
+  inline std::size_t size() const { return _len; }
+
+  /**
+   * Get the view of the count characters at most from the given position, the
+   * position is clamped to the end of the text.
+   */
+  inline TextView substr(std::size_t pos, std::size_t count = std::wstring::npos) const {
+    pos = std::min(pos, _len);
+    return TextView(_str + pos, std::min(count, _len - pos));
+  }
+
+  operator std::wstring() const { return _len == 0 ? std::wstring() : std::wstring(_str, _len); }
+};
+
 /** This class implements a parser for latex formulas */
 class TeXParser {
 private:
-  std::wstring _latex;
+  // the text to parse, a view of _buffer, or of the text of the parent parser
+  // if not modified
+  TextView _latex;
+  std::wstring _buffer;
   int _pos, _spos, _len;
   int _line, _col;
   int _group;
   int _atIsLetter;
   bool _insertion;
+  // if the text has been preprocessed, and not inserted with raw text since
+  bool _expanded;
   bool _arrayMode;
   bool _isMathMode;
   bool _isPartial;
   bool _hideUnknownChar;
+  // the text already preprocessed, and the start of the scanned text in
+  // _latex that is not moved into it yet
+  std::wstring _preprocessed;
+  int _mark;
+  bool _preprocessing;
 
   /** escape character */
   static const wchar_t ESCAPE;
@@ -70,6 +115,18 @@ private:
 
   void insert(int beg, int end, const std::wstring& formula);
 
+  /**
+   * Replace the text in [beg, end) with the given text and continue to scan
+   * from the start of it. The text before beg has been consumed, so the
+   * replacement is written into the room in front of the unread text rather
+   * than shifting the unread text, and the cost is proportional to the length
+   * of the replacement (amortized) instead of the length of the input.
+   */
+  void splice(int beg, int end, const std::wstring& text);
+
+  /** Copy the text into _buffer if it is a view of the text of another parser */
+  void own();
+
   /**
    * Return a string with command, options and arguments.
    *
@@ -97,15 +154,22 @@ private:
 
   void inflateEnv(std::wstring& cmd, Args& args, int& pos);
 
+  /**
+   * Find the end of the group opened at the given position as getGroup does,
+   * return the position of the closing character or -1 if not closed.
+   */
+  int findGroupEnd(int pos, wchar_t open, wchar_t close) const;
+
   void init(
     bool isPartial,
     const std::wstring& latex,
     Formula* formula,
-    bool firstPass
+    bool firstPass,
+    bool copy = true
   );
 
 public:
-  static bool _isLoading;
+  static thread_local bool _isLoading;
 
   Formula* _formula;
 
@@ -183,9 +247,42 @@ public:
     _isMathMode = isMathMode;
   }
 
+  /**
+   * Create a new TeXParser to parse a part of the formula being parsed by the
+   * given parent, such as the argument of a command. The given string is not
+   * copied but read in place, so it must outlive the parse. Note the
+   * arguments themselves are copies out of the text of the parent, see
+   * getOptsArgs.
+   *
+   * @param parent the parser of the outer formula
+   * @param latex the string to be parsed
+   * @param formula the formula to hold the atoms
+   * @param preprocess indicate if the parser must replace the user-defined macros by their content
+   * @param isMathMode a boolean to indicate if the parser must ignore or not the white space
+   *
+   * @throw ex_parse if the string could not be parsed correctly
+   */
+  TeXParser(
+    const TeXParser& parent,
+    const std::wstring& latex,
+    Formula* formula,
+    bool preprocess,
+    bool isMathMode = true
+  );
+
+  TeXParser(const TeXParser&) = delete;
+
+  void operator=(const TeXParser&) = delete;
+
   /** Reset the parser with a new latex expression */
   void reset(const std::wstring& latex);
 
+  /**
+   * Test if the parsed string has been preprocessed (directly or as a part of
+   * the parent's), so a nested formula parsed from it needs no preprocessing
+   */
+  inline bool isExpanded() const { return _expanded; }
+
   /** Return true if we get a partial formula */
   inline bool isPartial() const { return _isPartial; }
 
@@ -195,6 +292,12 @@ public:
   /** Get the number of the current column */
   inline int getCol() const { return _pos - _col - 1; }
 
+  /**
+   * Get the state (the modes and the macros defined so far) that the atoms
+   * parsed by this parser depend on, see ParseCache
+   */
+  ParseCache::State cacheState() const;
+
   /** Get and remove the last atom of the current formula */
   sptr<Atom> popLastAtom() const;
 
@@ -272,7 +375,7 @@ public:
    *
    * @param open the opening character
    * @param close the closing character
-   * @return the enclosed contents
+   * @return the enclosed contents, copied out of the text
    *
    * @throw ex_parse if the contents are badly enclosed
    */
@@ -329,7 +432,8 @@ public:
    *   and must be 2 if they must be found before the second argument,
    *   otherwise there're no options for the command.
    *
-   * @param args a vector to put with argument strings
+   * @param args a vector to put with argument strings, the arguments are
+   *   copied out of the text since the macros take them as strings
    */
   void getOptsArgs(int argc, int opts, Args& args);
 
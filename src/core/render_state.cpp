@@ -0,0 +1,52 @@
+#include "core/render_state.h"
+#include "atom/atom_impl.h"
+#include "atom/atom_row.h"
+#include "core/formula.h"
+#include "core/layout_cache.h"
+#include "core/macro.h"
+#include "core/parse_cache.h"
+#include "utils/arena.h"
+
+using namespace tex;
+
+thread_local ParallelCells RenderState::_parallelCells;
+
+RenderState::RenderState()
+  : _pixelsPerPoint(Formula::PIXELS_PER_POINT),
+    _breakEverywhere(RowAtom::_breakEveywhere),
+    _ovalMultiplier(OvalAtom::_multiplier),
+    _ovalDiameter(OvalAtom::_diameter),
+    _macros(MacroScope::current()),
+    _parseCache(ParseCache::current()),
+    _arena(Arena::current()),
+    _layoutCache(LayoutCache::current()),
+    _parallel(_parallelCells) {}
+
+ParallelCells RenderState::setParallelCells(const ParallelCells& options) {
+  const ParallelCells prev = _parallelCells;
+  _parallelCells = options;
+  return prev;
+}
+
+void RenderState::install(const RenderState& state, Arena* arena, LayoutCache* cache) {
+  Formula::PIXELS_PER_POINT = state._pixelsPerPoint;
+  RowAtom::_breakEveywhere = state._breakEverywhere;
+  OvalAtom::_multiplier = state._ovalMultiplier;
+  OvalAtom::_diameter = state._ovalDiameter;
+  MacroScope::activate(state._macros);
+  ParseCache::activate(state._parseCache);
+  Arena::activate(arena);
+  LayoutCache::activate(cache);
+  _parallelCells = state._parallel;
+}
+
+RenderStateScope::RenderStateScope(const RenderState& state, Arena* arena, LayoutCache* cache) {
+  RenderState::install(state, arena, cache);
+  // a parse writes into the parse cache, the threads must not share it in
+  // case an atom parses while laid out; the macros are only read
+  ParseCache::activate(nullptr);
+}
+
+RenderStateScope::~RenderStateScope() {
+  RenderState::install(_prev, _prev._arena, _prev._layoutCache);
+}
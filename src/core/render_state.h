@@ -0,0 +1,113 @@
+#ifndef RENDER_STATE_H_INCLUDED
+#define RENDER_STATE_H_INCLUDED
+
+#include <cstddef>
+
+namespace tex {
+
+class Arena;
+
+class LayoutCache;
+
+class MacroScope;
+
+class ParseCache;
+
+/** The options of the parallel layout of the cells of the large matrices */
+struct ParallelCells {
+  // the minimum count of cells of a matrix to lay out its cells in parallel,
+  // 0 to always lay them out on the calling thread
+  std::size_t cells;
+  // the count of threads to lay out the cells, 0 means as many as the
+  // hardware supports
+  std::size_t threads;
+
+  ParallelCells(std::size_t cells = 1024, std::size_t threads = 0)
+    : cells(cells), threads(threads) {}
+};
+
+/**
+ * The state of the current thread that the layout of a formula depends on:
+ * the state installed by the context and the builder (the macros, the caches,
+ * the arena and the options), and the state left by the atoms parsed so far
+ * (e.g. \cornersize). It is captured on the thread that lays out a formula and
+ * installed on the threads that lay out parts of it, see
+ * MatrixAtom::createCells.
+ */
+class RenderState {
+private:
+  static thread_local ParallelCells _parallelCells;
+
+  float _pixelsPerPoint;
+  bool _breakEverywhere;
+  float _ovalMultiplier, _ovalDiameter;
+  MacroScope* _macros;
+  ParseCache* _parseCache;
+  Arena* _arena;
+  LayoutCache* _layoutCache;
+  ParallelCells _parallel;
+
+  static void install(const RenderState& state, Arena* arena, LayoutCache* cache);
+
+public:
+  /** Capture the state of the current thread */
+  RenderState();
+
+  /** Test if the captured thread allocates the atoms and the boxes from an arena */
+  inline bool usesArena() const { return _arena != nullptr; }
+
+  /** Test if the captured thread memoizes the layout, see LayoutCache */
+  inline bool memoizes() const { return _layoutCache != nullptr; }
+
+  /** Get the options of the parallel layout on the current thread */
+  inline static const ParallelCells& parallelCells() { return _parallelCells; }
+
+  /**
+   * Set the options of the parallel layout on the current thread.
+   *
+   * @return the previous options
+   */
+  static ParallelCells setParallelCells(const ParallelCells& options);
+
+  friend class RenderStateScope;
+};
+
+/**
+ * Install a captured state on the current thread during the lifetime of this
+ * object. An arena and a layout cache must not be active on more than one
+ * thread, so the thread brings its own ones if the captured thread has. The
+ * parse cache is not installed, it must not be written by several threads.
+ */
+class RenderStateScope {
+private:
+  const RenderState _prev;
+
+public:
+  RenderStateScope(const RenderState& state, Arena* arena, LayoutCache* cache);
+
+  RenderStateScope(const RenderStateScope&) = delete;
+
+  void operator=(const RenderStateScope&) = delete;
+
+  ~RenderStateScope();
+};
+
+/** Set the options of the parallel layout on the current thread during the lifetime of this object */
+class ParallelCellsScope {
+private:
+  const ParallelCells _prev;
+
+public:
+  explicit ParallelCellsScope(const ParallelCells& options)
+    : _prev(RenderState::setParallelCells(options)) {}
+
+  ParallelCellsScope(const ParallelCellsScope&) = delete;
+
+  void operator=(const ParallelCellsScope&) = delete;
+
+  ~ParallelCellsScope() { RenderState::setParallelCells(_prev); }
+};
+
+}  // namespace tex
+
+#endif  // RENDER_STATE_H_INCLUDED
@@ -1,5 +1,7 @@
 #include "fonts/alphabet.h"
 #include "common.h"
+#include "res/reg/builtin_font_reg.h"
+#include "res/reg/builtin_syms_reg.h"
 
 using namespace tex;
 
@@ -55,6 +57,14 @@ const UnicodeBlock& UnicodeBlock::of(wchar_t c) {
 
 /*********************************** alphabet implementation **************************/
 
+const FontSet* AlphabetRegistration::getFontSet() const {
+  return nullptr;
+}
+
+__reg_symbols_func AlphabetRegistration::getSymbolsReg() const {
+  return nullptr;
+}
+
 AlphabetRegistration::~AlphabetRegistration() {}
 
 const std::vector<UnicodeBlock> CyrillicRegistration::_block = {UnicodeBlock::CYRILLIC};
@@ -73,6 +83,15 @@ const std::string CyrillicRegistration::getTeXFontFile() const {
   return RES_BASE + "/" + _font;
 }
 
+const FontSet* CyrillicRegistration::getFontSet() const {
+  static const FontSetCyrillic fonts;
+  return &fonts;
+}
+
+__reg_symbols_func CyrillicRegistration::getSymbolsReg() const {
+  return __symbols_reg(cyrillic);
+}
+
 const std::vector<UnicodeBlock> GreekRegistration::_block = {
     UnicodeBlock::GREEK,
     UnicodeBlock::GREEK_EXTENDED};
@@ -91,3 +110,12 @@ const std::string GreekRegistration::getPackage() const {
 const std::string GreekRegistration::getTeXFontFile() const {
   return RES_BASE + "/" + _font;
 }
+
+const FontSet* GreekRegistration::getFontSet() const {
+  static const FontSetGreek fonts;
+  return &fonts;
+}
+
+__reg_symbols_func GreekRegistration::getSymbolsReg() const {
+  return __symbols_reg(greek);
+}
@@ -4,6 +4,9 @@
 #include <string>
 #include <vector>
 
+#include "fonts/font_reg.h"
+#include "fonts/symbol_reg.h"
+
 namespace tex {
 
 class UnicodeBlock {
@@ -45,6 +48,18 @@ public:
 
   virtual const std::string getTeXFontFile() const = 0;
 
+  /**
+   * Get the fonts of this alphabet compiled into the library, nullptr (the
+   * default) if the alphabet is loaded from its TeX-font file.
+   */
+  virtual const FontSet* getFontSet() const;
+
+  /**
+   * Get the function to register the symbols and the mappings of this alphabet
+   * compiled into the library, only used if the fonts are compiled too.
+   */
+  virtual __reg_symbols_func getSymbolsReg() const;
+
   virtual ~AlphabetRegistration();
 };
 
@@ -60,6 +75,10 @@ public:
   const std::string getPackage() const override;
 
   const std::string getTeXFontFile() const override;
+
+  const FontSet* getFontSet() const override;
+
+  __reg_symbols_func getSymbolsReg() const override;
 };
 
 class GreekRegistration : public AlphabetRegistration {
@@ -74,6 +93,10 @@ public:
   const std::string getPackage() const override;
 
   const std::string getTeXFontFile() const override;
+
+  const FontSet* getFontSet() const override;
+
+  __reg_symbols_func getSymbolsReg() const override;
 };
 
 }  // namespace tex
@@ -10,9 +10,7 @@ namespace tex {
 struct Metrics {
   float width, height, depth, italic, size;
 
-  Metrics() = delete;
-
-  Metrics(const Metrics&) = delete;
+  Metrics() : width(0), height(0), depth(0), italic(0), size(0) {}
 
   explicit Metrics(float w, float h, float d, float i, float factor, float s)
     : width(w * factor), height(h * factor), depth(d * factor), italic(i * factor), size(s) {}
@@ -36,21 +34,24 @@ struct CharFont {
 #endif
 };
 
-/** Class represents a character together with its font, font id and metric information */
+/**
+ * Class represents a character together with its font, font id and metric
+ * information, it is a plain value and cheap to copy
+ */
 class Char {
 private:
   wchar_t _c;
   int _fontCode;
   const Font* _font;
-  sptr<CharFont> _cf;
-  sptr<Metrics> _m;
+  Metrics _m;
 
 public:
   Char() = delete;
 
-  Char(wchar_t c, const Font* f, int fc, const sptr<Metrics>& m);
+  Char(wchar_t c, const Font* f, int fc, const Metrics& m)
+    : _c(c), _fontCode(fc), _font(f), _m(m) {}
 
-  sptr<CharFont> getCharFont() const { return _cf; }
+  inline CharFont getCharFont() const { return CharFont(_c, _fontCode); }
 
   inline wchar_t getChar() const { return _c; }
 
@@ -58,15 +59,15 @@ public:
 
   inline int getFontCode() const { return _fontCode; }
 
-  inline float getWidth() const { return _m->width; }
+  inline float getWidth() const { return _m.width; }
 
-  inline float getItalic() const { return _m->italic; }
+  inline float getItalic() const { return _m.italic; }
 
-  inline float getHeight() const { return _m->height; }
+  inline float getHeight() const { return _m.height; }
 
-  inline float getDepth() const { return _m->depth; }
+  inline float getDepth() const { return _m.depth; }
 
-  inline float getSize() const { return _m->size; }
+  inline float getSize() const { return _m.size; }
 };
 
 /**
@@ -23,11 +23,10 @@ const int* const FontInfo::getExtension(wchar_t ch) const {
   return _extensions.isEmpty() ? nullptr : _extensions((int)ch) + 1;
 }
 
-//sptr<CharFont> FontInfo::getNextLarger(wchar_t ch) const {
-//  const int* const item = _nextLargers((int)ch);
-//  if (item == nullptr) return nullptr;
-//  return sptrOf<CharFont>(item[1], item[2]);
-//}
+const int* const FontInfo::getNextLarger(wchar_t ch) const {
+  const int* const item = _nextLargers((int)ch);
+  return item == nullptr ? nullptr : item + 1;
+}
 
 //sptr<CharFont> FontInfo::getLigture(wchar_t left, wchar_t right) const {
 //  const wchar_t* const item = _lig(left, right);
@@ -55,7 +54,8 @@ void FontInfo::setVariousId(
 }
 
 const Font* FontInfo::getFont() {
-  if (_font == nullptr) _font = Font::create(_path, Formula::PIXELS_PER_POINT);
+  // the font may be requested by several contexts concurrently
+  call_once(_fontLoaded, [this]() { _font = Font::create(_path, Formula::PIXELS_PER_POINT); });
   return _font;
 }
 
@@ -67,6 +67,8 @@ void FontInfo::__free() {
   for (auto f : _infos) {
     delete f;
   }
+  _infos.clear();
+  _names.clear();
 }
 
 #ifdef HAVE_LOG
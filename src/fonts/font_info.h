@@ -6,6 +6,8 @@
 #include "graphic/graphic.h"
 #include "utils/indexed_arr.h"
 
+#include <mutex>
+
 namespace tex {
 
 class FontSet;
@@ -17,6 +19,7 @@ private:
 
   const int _id;    // id of this font info
   const Font* _font;  // font of this info
+  std::once_flag _fontLoaded;
   const std::string _path;  // font file path
 
   IndexedArray<int, 5, 1> _extensions;   // extensions for big delimiter
@@ -121,14 +124,12 @@ public:
 
   const int* const getExtension(wchar_t ch) const;
 
-  // FIXME
-  // workaround for the MSVC's LNK2019 error
-  // it should be implemented in the font_info.cpp file
-  sptr<CharFont> getNextLarger(wchar_t ch) const {
-    const int* const item = _nextLargers((int) ch);
-    if (item == nullptr) return nullptr;
-    return sptrOf<CharFont>(item[1], item[2]);
-  }
+  /**
+   * Get the next larger version of the given character, the first element is
+   * the larger character and the second is its font id, return nullptr if not
+   * found.
+   */
+  const int* const getNextLarger(wchar_t ch) const;
 
   // FIXME
   // workaround for the MSVS's LNK2019 error
@@ -16,6 +16,10 @@ const int TeXFont::NO_FONT = -1;
 string* DefaultTeXFont::_defaultTextStyleMappings;
 map<string, vector<CharFont*>> DefaultTeXFont::_textStyleMappings;
 map<string, CharFont*> DefaultTeXFont::_symbolMappings;
+map<string, int> DefaultTeXFont::_symbolIds;
+vector<string> DefaultTeXFont::_symbolNames;
+vector<const CharFont*> DefaultTeXFont::_symbolsById;
+bool DefaultTeXFont::_symbolsInterned = false;
 map<string, float> DefaultTeXFont::_generalSettings;
 vector<UnicodeBlock> DefaultTeXFont::_loadedAlphabets;
 map<UnicodeBlock, AlphabetRegistration*> DefaultTeXFont::_registeredAlphabets;
@@ -40,6 +44,18 @@ const int DefaultTeXFont::BOT = 3;
 
 bool DefaultTeXFont::_magnificationEnable = true;
 
+float DefaultTeXFont::_styleParams[PARAM_COUNT][STYLE_COUNT];
+float DefaultTeXFont::_sizeFactors[STYLE_COUNT];
+int DefaultTeXFont::_muFontId;
+int DefaultTeXFont::_spaceFontId;
+
+/** names of the parameters in _parameters, in the order of TeXParam */
+static const char* const PARAM_NAMES[] = {
+  "num1", "num2", "num3", "denom1", "denom2", "sup1", "sup2", "sup3", "sub1", "sub2",
+  "supdrop", "subdrop", "axisheight", "defaultrulethickness",
+  "bigopspacing1", "bigopspacing2", "bigopspacing3", "bigopspacing4", "bigopspacing5",
+};
+
 TeXFont::~TeXFont() {}
 
 DefaultTeXFont::~DefaultTeXFont() {
@@ -67,6 +83,7 @@ void DefaultTeXFont::addTeXFontDescription(
   const auto x = parser.parseTextStyleMappings();
   _textStyleMappings.insert(x.begin(), x.end());
   parser.parseSymbolMappings(_symbolMappings);
+  __intern_symbols();
 }
 
 void DefaultTeXFont::addAlphabet(
@@ -88,9 +105,33 @@ void DefaultTeXFont::addAlphabet(
   }
 }
 
+void DefaultTeXFont::addAlphabet(
+  const FontSet& fonts,
+  __reg_symbols_func symbols,
+  const vector<UnicodeBlock>& alphabet) {
+  for (const auto& b : alphabet) {
+    if (indexOf(_loadedAlphabets, b) != -1) return;
+  }
+  const vector<FontReg>& regs = fonts.regs();
+  for (const auto& r : regs) {
+    if (FontInfo::__id(r.name) >= 0) throw ex_font_loaded("Font " + r.name + " is already loaded!");
+  }
+  TeXParser::_isLoading = true;
+  FontInfo::__register(fonts);
+  if (symbols != nullptr) symbols();
+  __intern_symbols();
+  for (const auto& b : alphabet) _loadedAlphabets.push_back(b);
+  TeXParser::_isLoading = false;
+}
+
 void DefaultTeXFont::addAlphabet(AlphabetRegistration* reg) {
   try {
-    addAlphabet(reg->getPackage(), reg->getUnicodeBlock(), reg->getTeXFontFile());
+    const FontSet* fonts = reg->getFontSet();
+    if (fonts != nullptr) {
+      addAlphabet(*fonts, reg->getSymbolsReg(), reg->getUnicodeBlock());
+    } else {
+      addAlphabet(reg->getPackage(), reg->getUnicodeBlock(), reg->getTeXFontFile());
+    }
   } catch (ex_font_loaded& e) {
   } catch (ex_alphabet_registration& e) {
 #ifdef HAVE_LOG
@@ -99,6 +140,46 @@ void DefaultTeXFont::addAlphabet(AlphabetRegistration* reg) {
   }
 }
 
+void DefaultTeXFont::loadRegisteredAlphabets() {
+  for (const auto& i : _registeredAlphabets) {
+    if (indexOf(_loadedAlphabets, i.first) == -1) addAlphabet(i.second);
+  }
+}
+
+const CharFont* DefaultTeXFont::findSymbolMapping(const string& symbolName) {
+  auto it = _symbolMappings.find(symbolName);
+  if (it == _symbolMappings.end()) return nullptr;
+  return it->second;
+}
+
+void DefaultTeXFont::__intern_symbols() {
+  for (const auto& i : _symbolMappings) {
+    auto it = _symbolIds.find(i.first);
+    if (it == _symbolIds.end()) {
+      it = _symbolIds.emplace(i.first, (int) _symbolNames.size()).first;
+      _symbolNames.push_back(i.first);
+      _symbolsById.push_back(nullptr);
+    }
+    _symbolsById[it->second] = i.second;
+  }
+  _symbolsInterned = true;
+}
+
+int DefaultTeXFont::symbolId(const string& symbolName) {
+  // may be called by the symbols that are constructed at the static
+  // initialization, before the table exists
+  if (!_symbolsInterned) return -1;
+  auto it = _symbolIds.find(symbolName);
+  if (it == _symbolIds.end() || _symbolsById[it->second] == nullptr) return -1;
+  return it->second;
+}
+
+const vector<CharFont*>* DefaultTeXFont::findTextStyleMapping(const string& textStyle) {
+  auto it = _textStyleMappings.find(textStyle);
+  if (it == _textStyleMappings.end()) return nullptr;
+  return &it->second;
+}
+
 void DefaultTeXFont::registerAlphabet(AlphabetRegistration* reg) {
   const vector<UnicodeBlock>& blocks = reg->getUnicodeBlock();
   for (size_t i = 0; i < blocks.size(); i++) {
@@ -146,10 +227,9 @@ Char DefaultTeXFont::getChar(
   wchar_t c,
   const string& textStyle,
   TexStyle style) {
-  // find first
-  auto i = _textStyleMappings.find(textStyle);
-  if (i == _textStyleMappings.end()) throw ex_text_style_mapping_not_found(textStyle);
-  return getChar(c, i->second, style);
+  const auto* mapping = findTextStyleMapping(textStyle);
+  if (mapping == nullptr) throw ex_text_style_mapping_not_found(textStyle);
+  return getChar(c, *mapping, style);
 }
 
 Char DefaultTeXFont::getChar(const CharFont& c, TexStyle style) {
@@ -197,19 +277,53 @@ Char DefaultTeXFont::getChar(const CharFont& c, TexStyle style) {
 
 Char DefaultTeXFont::getChar(
   const string& symbolName, TexStyle style) {
-  // find first
-  auto i = _symbolMappings.find(symbolName);
+  const CharFont* cf = findSymbolMapping(symbolName);
   // no symbol mapping found
-  if (i == _symbolMappings.end()) throw ex_symbol_mapping_not_found(symbolName);
-  return getChar(*(i->second), style);
+  if (cf == nullptr) throw ex_symbol_mapping_not_found(symbolName);
+  return getChar(*cf, style);
 }
 
-sptr<Metrics> DefaultTeXFont::getMetrics(const CharFont& cf, float size) {
+Char DefaultTeXFont::getChar(int symbolId, TexStyle style) {
+  if (symbolId < 0 || symbolId >= (int) _symbolsById.size()) {
+    throw ex_symbol_mapping_not_found("#" + tostring(symbolId));
+  }
+  const CharFont* cf = _symbolsById[symbolId];
+  if (cf == nullptr) throw ex_symbol_mapping_not_found(_symbolNames[symbolId]);
+  return getChar(*cf, style);
+}
+
+/** Entry of the glyph metrics cache */
+struct __cached_metrics {
+  int fontId = -1;
+  wchar_t chr = 0;
+  // the size factor (depends on the style and the scale of the font) and the
+  // point-to-pixel conversion the metrics were computed with
+  float size = 0, pixelsPerPoint = 0;
+  Metrics metrics;
+};
+
+/**
+ * Direct-mapped cache of the scaled glyph metrics, per thread so the contexts
+ * parsing concurrently don't need to synchronize
+ */
+static constexpr size_t METRICS_CACHE_SIZE = 512;
+static thread_local __cached_metrics metricsCache[METRICS_CACHE_SIZE];
+
+Metrics DefaultTeXFont::getMetrics(const CharFont& cf, float size) {
+  const float ppp = Formula::PIXELS_PER_POINT;
+  const size_t h = ((size_t) cf.fontId * 31 + (size_t) cf.chr) * 7 + (size_t) (size * 64);
+  __cached_metrics& e = metricsCache[h % METRICS_CACHE_SIZE];
+  if (e.fontId == cf.fontId && e.chr == cf.chr && e.size == size && e.pixelsPerPoint == ppp) {
+    return e.metrics;
+  }
   auto info = getInfo(cf.fontId);
   const float* m = info->getMetrics(cf.chr);
-  Metrics* met = new Metrics(
-    m[WIDTH], m[HEIGHT], m[DEPTH], m[IT], size * Formula::PIXELS_PER_POINT, size);
-  return sptr<Metrics>(met);
+  e.fontId = cf.fontId;
+  e.chr = cf.chr;
+  e.size = size;
+  e.pixelsPerPoint = ppp;
+  e.metrics = Metrics(m[WIDTH], m[HEIGHT], m[DEPTH], m[IT], size * ppp, size);
+  return e.metrics;
 }
 
 Extension* DefaultTeXFont::getExtension(const Char& c, TexStyle style) {
@@ -225,8 +339,7 @@ Extension* DefaultTeXFont::getExtension(const Char& c, TexStyle style) {
     if (ext[i] == NONE) {
       parts[i] = nullptr;
     } else {
-      auto m = getMetrics(CharFont(ext[i], fc), s);
-      parts[i] = new Char(ext[i], f, fc, m);
+      parts[i] = new Char(ext[i], f, fc, getMetrics(CharFont(ext[i], fc), s));
     }
   }
   return new Extension(parts[TOP], parts[MID], parts[REP], parts[BOT]);
@@ -249,19 +362,19 @@ sptr<CharFont> DefaultTeXFont::getLigature(const CharFont& left, const CharFont&
 }
 
 int DefaultTeXFont::getMuFontId() {
-  return _generalSettings[DefaultTeXFontParser::MUFONTID_ATTR];
+  return _muFontId;
 }
 
 Char DefaultTeXFont::getNextLarger(const Char& c, TexStyle style) {
   auto info = getInfo(c.getFontCode());
-  auto ch = info->getNextLarger(c.getChar());
-  auto newInfo = getInfo(ch->fontId);
-  return Char(ch->chr, newInfo->getFont(), ch->fontId, getMetrics(*ch, getSizeFactor(style)));
+  const int* const next = info->getNextLarger(c.getChar());
+  const CharFont ch(next[0], next[1]);
+  auto newInfo = getInfo(ch.fontId);
+  return Char(ch.chr, newInfo->getFont(), ch.fontId, getMetrics(ch, getSizeFactor(style)));
 }
 
 float DefaultTeXFont::getSpace(TexStyle style) {
-  int spaceFontId = _generalSettings[DefaultTeXFontParser::SPACEFONTID_ATTR];
-  auto info = getInfo(spaceFontId);
+  auto info = getInfo(_spaceFontId);
   return info->getSpace(getSizeFactor(style) * Formula::PIXELS_PER_POINT);
 }
 
@@ -271,6 +384,7 @@ void DefaultTeXFont::setMathSizes(float ds, float ts, float ss, float sss) {
   _generalSettings["scriptscriptfactor"] = abs(sss / ds);
   _generalSettings["textfactor"] = abs(ts / ds);
   TeXRender::_defaultSize = abs(ds);
+  __resolve_style_params();
 }
 
 void DefaultTeXFont::setMagnification(float mag) {
@@ -278,6 +392,25 @@ void DefaultTeXFont::setMagnification(float mag) {
   TeXRender::_magFactor = mag / 1000.f;
 }
 
+void DefaultTeXFont::__resolve_style_params() {
+  const float textFactor = _generalSettings["textfactor"];
+  const float scriptFactor = _generalSettings["scriptfactor"];
+  const float scriptScriptFactor = _generalSettings["scriptscriptfactor"];
+  for (int j = 0; j < STYLE_COUNT; j++) {
+    const auto style = static_cast<TexStyle>(j);
+    if (style < TexStyle::text) _sizeFactors[j] = 1;
+    else if (style < TexStyle::script) _sizeFactors[j] = textFactor;
+    else if (style < TexStyle::scriptScript) _sizeFactors[j] = scriptFactor;
+    else _sizeFactors[j] = scriptScriptFactor;
+  }
+  for (int i = 0; i < PARAM_COUNT; i++) {
+    const float param = getParameter(PARAM_NAMES[i]);
+    for (int j = 0; j < STYLE_COUNT; j++) _styleParams[i][j] = param * _sizeFactors[j];
+  }
+  _muFontId = _generalSettings[DefaultTeXFontParser::MUFONTID_ATTR];
+  _spaceFontId = _generalSettings[DefaultTeXFontParser::SPACEFONTID_ATTR];
+}
+
 void DefaultTeXFont::enableMagnification(bool b) {
   _magnificationEnable = b;
 }
@@ -289,8 +422,10 @@ void DefaultTeXFont::_init_() {
   _loadedAlphabets.push_back(UnicodeBlock::of('a'));
   FontInfo::__register(FontSetBuiltin());
   __default_general_settings();
+  __resolve_style_params();
   __default_text_style_mapping();
   __register_symbols_set(SymbolsSetBuiltin());
+  __intern_symbols();
 
 #ifdef HAVE_LOG
   log();
@@ -306,6 +441,8 @@ void DefaultTeXFont::_free_() {
     }
   }
   for (auto f : _symbolMappings) delete f.second;
+  fill(_symbolsById.begin(), _symbolsById.end(), nullptr);
+  _symbolsInterned = false;
   FontInfo::__free();
   // _registeredAlphabets :=> map<UnicodeBlock, AlphabetRegistration>
   // multi => one
@@ -317,6 +454,11 @@ void DefaultTeXFont::_free_() {
     }
     i.second = nullptr;
   }
+  // the tables are filled again by the next initialization
+  _textStyleMappings.clear();
+  _symbolMappings.clear();
+  _loadedAlphabets.clear();
+  _registeredAlphabets.clear();
 }
 
 #ifdef HAVE_LOG
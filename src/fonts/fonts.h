@@ -24,6 +24,30 @@ typedef struct {
 
 class SymbolsSet;
 
+/** Parameters used in the TeX algorithms, see DefaultTeXFont::_parameters */
+enum class TeXParam : i8 {
+  num1,
+  num2,
+  num3,
+  denom1,
+  denom2,
+  sup1,
+  sup2,
+  sup3,
+  sub1,
+  sub2,
+  supDrop,
+  subDrop,
+  axisHeight,
+  defaultRuleThickness,
+  bigOpSpacing1,
+  bigOpSpacing2,
+  bigOpSpacing3,
+  bigOpSpacing4,
+  bigOpSpacing5,
+  count
+};
+
 /**
  * The default implementation of the TeXFont-interface.
  */
@@ -33,15 +57,30 @@ private:
   static std::string* _defaultTextStyleMappings;
   static std::map<std::string, std::vector<CharFont*>> _textStyleMappings;
   static std::map<std::string, CharFont*> _symbolMappings;
+  // the interned symbol names, an id is never reused once assigned, so the ids
+  // stay valid even if the fonts are released and initialized again
+  static std::map<std::string, int> _symbolIds;
+  static std::vector<std::string> _symbolNames;
+  // the symbol mappings indexed by id, nullptr if the symbol has no mapping
+  static std::vector<const CharFont*> _symbolsById;
+  static bool _symbolsInterned;
   static std::map<std::string, float> _parameters;
   static std::map<std::string, float> _generalSettings;
   static bool _magnificationEnable;
 
+  static constexpr int STYLE_COUNT = 8;
+  static constexpr int PARAM_COUNT = static_cast<int>(TeXParam::count);
+  // the parameters multiplied by the size factor of each style, resolved once
+  // from _parameters and _generalSettings, indexed by [TeXParam][TexStyle]
+  static float _styleParams[PARAM_COUNT][STYLE_COUNT];
+  static float _sizeFactors[STYLE_COUNT];
+  static int _muFontId, _spaceFontId;
+
   float _factor, _size;
 
   Char getChar(wchar_t c, const std::vector<CharFont*>& cf, TexStyle style);
 
-  sptr<Metrics> getMetrics(const CharFont& cf, float size);
+  Metrics getMetrics(const CharFont& cf, float size);
 
   inline FontInfo* getInfo(int id) { return FontInfo::__get(id); }
 
@@ -49,6 +88,12 @@ private:
 
   static void __default_text_style_mapping();
 
+  /** Resolve the style dependent parameters, must be called after the general settings changed */
+  static void __resolve_style_params();
+
+  /** Assign ids to the symbol mappings, must be called after the symbol mappings changed */
+  static void __intern_symbols();
+
 public:
   static std::vector<UnicodeBlock> _loadedAlphabets;
   static std::map<UnicodeBlock, AlphabetRegistration*> _registeredAlphabets;
@@ -93,8 +138,40 @@ public:
     const std::vector<UnicodeBlock>& alphabet,
     const std::string& lang);
 
+  /**
+   * Add an alphabet compiled into the library, its fonts are registered from
+   * the given font set and its symbols by the given function, no resource file
+   * is parsed.
+   */
+  static void addAlphabet(
+    const FontSet& fonts,
+    __reg_symbols_func symbols,
+    const std::vector<UnicodeBlock>& alphabet);
+
   static void registerAlphabet(AlphabetRegistration* reg);
 
+  /**
+   * Load all the registered alphabets that have not been loaded yet. After
+   * this call the font tables are not modified anymore while parsing, thus
+   * they can be shared by parsers running concurrently.
+   */
+  static void loadRegisteredAlphabets();
+
+  /** Find the mapping of the given symbol name, return nullptr if not found. */
+  static const CharFont* findSymbolMapping(const std::string& symbolName);
+
+  /**
+   * Get the interned id of the given symbol name, the id can be passed to
+   * #getChar(int, TexStyle) to get the symbol without any lookup by name.
+   *
+   * @return the id of the symbol, or -1 if the symbol has no mapping or the
+   * fonts are not initialized yet
+   */
+  static int symbolId(const std::string& symbolName);
+
+  /** Find the mapping of the given text style, return nullptr if not found. */
+  static const std::vector<CharFont*>* findTextStyleMapping(const std::string& textStyle);
+
   inline static float getParameter(const std::string& name) {
     auto it = _parameters.find(name);
     if (it == _parameters.end()) return 0;
@@ -105,14 +182,12 @@ public:
    * Get the size factor of given style
    */
   inline static float getSizeFactor(TexStyle style) {
-    if (style < TexStyle::text) return 1;
-    if (style < TexStyle::script) return _generalSettings["textfactor"];
-    if (style < TexStyle::scriptScript) return _generalSettings["scriptfactor"];
-    return _generalSettings["scriptscriptfactor"];
+    return _sizeFactors[static_cast<int>(style)];
   }
 
-  inline float styleParam(const std::string& name, TexStyle style) {
-    return getParameter(name) * getSizeFactor(style) * Formula::PIXELS_PER_POINT;
+  inline static float styleParam(TeXParam param, TexStyle style) {
+    const int i = static_cast<int>(param), j = static_cast<int>(style);
+    return _styleParams[i][j] * Formula::PIXELS_PER_POINT;
   }
 
   /************************************ get char ************************************************/
@@ -128,6 +203,8 @@ public:
 
   Char getChar(const std::string& symbolName, TexStyle style) override;
 
+  Char getChar(int symbolId, TexStyle style) override;
+
   /*********************************** font information *****************************************/
 
   Extension* getExtension(const Char& c, TexStyle style) override;
@@ -142,44 +219,44 @@ public:
 
   inline float getScaleFactor() override { return _factor; }
 
-  inline float getAxisHeight(TexStyle style) override { return styleParam("axisheight", style); }
+  inline float getAxisHeight(TexStyle style) override { return styleParam(TeXParam::axisHeight, style); }
 
-  inline float getBigOpSpacing1(TexStyle style) override { return styleParam("bigopspacing1", style); }
+  inline float getBigOpSpacing1(TexStyle style) override { return styleParam(TeXParam::bigOpSpacing1, style); }
 
-  inline float getBigOpSpacing2(TexStyle style) override { return styleParam("bigopspacing2", style); }
+  inline float getBigOpSpacing2(TexStyle style) override { return styleParam(TeXParam::bigOpSpacing2, style); }
 
-  inline float getBigOpSpacing3(TexStyle style) override { return styleParam("bigopspacing3", style); }
+  inline float getBigOpSpacing3(TexStyle style) override { return styleParam(TeXParam::bigOpSpacing3, style); }
 
-  inline float getBigOpSpacing4(TexStyle style) override { return styleParam("bigopspacing4", style); }
+  inline float getBigOpSpacing4(TexStyle style) override { return styleParam(TeXParam::bigOpSpacing4, style); }
 
-  inline float getBigOpSpacing5(TexStyle style) override { return styleParam("bigopspacing5", style); }
+  inline float getBigOpSpacing5(TexStyle style) override { return styleParam(TeXParam::bigOpSpacing5, style); }
 
-  inline float getNum1(TexStyle style) override { return styleParam("num1", style); }
+  inline float getNum1(TexStyle style) override { return styleParam(TeXParam::num1, style); }
 
-  inline float getNum2(TexStyle style) override { return styleParam("num2", style); }
+  inline float getNum2(TexStyle style) override { return styleParam(TeXParam::num2, style); }
 
-  inline float getNum3(TexStyle style) override { return styleParam("num3", style); }
+  inline float getNum3(TexStyle style) override { return styleParam(TeXParam::num3, style); }
 
-  inline float getSub1(TexStyle style) override { return styleParam("sub1", style); }
+  inline float getSub1(TexStyle style) override { return styleParam(TeXParam::sub1, style); }
 
-  inline float getSub2(TexStyle style) override { return styleParam("sub2", style); }
+  inline float getSub2(TexStyle style) override { return styleParam(TeXParam::sub2, style); }
 
-  inline float getSubDrop(TexStyle style) override { return styleParam("subdrop", style); }
+  inline float getSubDrop(TexStyle style) override { return styleParam(TeXParam::subDrop, style); }
 
-  inline float getSup1(TexStyle style) override { return styleParam("sup1", style); }
+  inline float getSup1(TexStyle style) override { return styleParam(TeXParam::sup1, style); }
 
-  inline float getSup2(TexStyle style) override { return styleParam("sup2", style); }
+  inline float getSup2(TexStyle style) override { return styleParam(TeXParam::sup2, style); }
 
-  inline float getSup3(TexStyle style) override { return styleParam("sup3", style); }
+  inline float getSup3(TexStyle style) override { return styleParam(TeXParam::sup3, style); }
 
-  inline float getSupDrop(TexStyle style) override { return styleParam("supdrop", style); }
+  inline float getSupDrop(TexStyle style) override { return styleParam(TeXParam::supDrop, style); }
 
-  inline float getDenom1(TexStyle style) override { return styleParam("denom1", style); }
+  inline float getDenom1(TexStyle style) override { return styleParam(TeXParam::denom1, style); }
 
-  inline float getDenom2(TexStyle style) override { return styleParam("denom2", style); }
+  inline float getDenom2(TexStyle style) override { return styleParam(TeXParam::denom2, style); }
 
   inline float getDefaultRuleThickness(TexStyle style) override {
-    return styleParam("defaultrulethickness", style);
+    return styleParam(TeXParam::defaultRuleThickness, style);
   }
 
   inline float getQuad(TexStyle style, int fontCode) override {
@@ -68,6 +68,19 @@ public:
    */
   virtual Char getChar(const std::string& name, TexStyle style) = 0;
 
+  /**
+   * Get a Char-object for the symbol with the given interned id, this is the
+   * same as #getChar(name, style) but without the lookup by name
+   * @param symbolId
+   *      the id of the symbol, see DefaultTeXFont::symbolId
+   * @param style
+   *      the style in which the atom should be drawn
+   * @return a Char-object for this symbol with metric information
+   * @throw ex_symbol_mapping_not_found
+   *      if no symbol has the given id
+   */
+  virtual Char getChar(int symbolId, TexStyle style) = 0;
+
   /**
    * Get a Char-object specifying the given character in the default text style
    * with metric information depending on the given "style"
@@ -0,0 +1,310 @@
+#include "graphic/display_list.h"
+
+#include <cmath>
+
+using namespace std;
+using namespace tex;
+
+/************************************* DisplayList implementation ******************************/
+
+/** Get the product a * b of the given frames, that is b is applied first */
+static Frame multiply(const Frame& a, const Frame& b) {
+  return {
+    a.m00 * b.m00 + a.m01 * b.m10, a.m00 * b.m01 + a.m01 * b.m11,
+    a.m10 * b.m00 + a.m11 * b.m10, a.m10 * b.m01 + a.m11 * b.m11
+  };
+}
+
+static inline float det(const Frame& f) {
+  return f.m00 * f.m11 - f.m01 * f.m10;
+}
+
+/** Get the frame to concatenate to the frame 'from' to get the frame 'to' */
+static Frame relative(const Frame& from, const Frame& to) {
+  if (from.m01 == 0 && from.m10 == 0 && to.m01 == 0 && to.m10 == 0) {
+    return {to.m00 / from.m00, 0, 0, to.m11 / from.m11};
+  }
+  const float d = det(from);
+  const Frame inverse(from.m11 / d, -from.m01 / d, -from.m10 / d, from.m00 / d);
+  return multiply(inverse, to);
+}
+
+void DisplayList::applyFrame(Graphics2D& g2, const Frame& f) {
+  if (f.m01 == 0 && f.m10 == 0) {
+    if (f.m00 != 1 || f.m11 != 1) g2.scale(f.m00, f.m11);
+    return;
+  }
+  // decompose the frame into rotate(phi) * scale(s1, s2) * rotate(theta), the
+  // closed form of the singular value decomposition of a 2x2 matrix
+  const float e = (f.m00 + f.m11) / 2, g = (f.m10 + f.m01) / 2;
+  const float h = (f.m10 - f.m01) / 2, k = (f.m00 - f.m11) / 2;
+  const float q = hypot(e, h), r = hypot(k, g);
+  const float a1 = atan2(g, k), a2 = atan2(h, e);
+  g2.rotate((a2 + a1) / 2);
+  g2.scale(q + r, q - r);
+  g2.rotate((a2 - a1) / 2);
+}
+
+bool DisplayList::isCompatible(const Graphics2D& g2) const {
+  const Stroke& s = g2.getStroke();
+  return (
+    g2.getFont() == _initialFont
+    && g2.sx() == _initialSx
+    && g2.sy() == _initialSy
+    && s.lineWidth == _initialStroke.lineWidth
+    && s.miterLimit == _initialStroke.miterLimit
+    && s.cap == _initialStroke.cap
+    && s.join == _initialStroke.join
+  );
+}
+
+void DisplayList::draw(Graphics2D& g2, float x, float y) const {
+  // the frames are concatenated to the transformation of the context, the
+  // frame in effect is undone before the next one is applied; nullptr if no
+  // frame is applied yet
+  const Frame* current = nullptr;
+  // the items in a degenerated frame (it can not be undone) are invisible
+  bool visible = true;
+  for (const auto& item : _items) {
+    if (!visible && item.op != DisplayOp::frame
+        && item.op != DisplayOp::color
+        && item.op != DisplayOp::stroke
+        && item.op != DisplayOp::font) {
+      continue;
+    }
+    switch (item.op) {
+      case DisplayOp::frame: {
+        const Frame& f = _frames[item.index];
+        visible = det(f) != 0;
+        if (!visible) break;
+        if (current == nullptr) {
+          g2.translate(x, y);
+          applyFrame(g2, f);
+        } else if (*current != f) {
+          applyFrame(g2, relative(*current, f));
+        }
+        current = &f;
+      }
+        break;
+      case DisplayOp::color:
+        g2.setColor(item.index);
+        break;
+      case DisplayOp::stroke:
+        g2.setStroke(_strokes[item.index]);
+        break;
+      case DisplayOp::font:
+        g2.setFont(_fonts[item.index]);
+        break;
+      case DisplayOp::glyphs:
+        g2.drawGlyphs(&_chars[item.index], &_positions[item.index], item.count);
+        break;
+      case DisplayOp::text:
+        g2.drawText(_texts[item.index], _args[item.count], _args[item.count + 1]);
+        break;
+      case DisplayOp::line: {
+        const float* a = &_args[item.index];
+        g2.drawLine(a[0], a[1], a[2], a[3]);
+      }
+        break;
+      case DisplayOp::rect: {
+        const float* a = &_args[item.index];
+        g2.drawRect(a[0], a[1], a[2], a[3]);
+      }
+        break;
+      case DisplayOp::fillRect: {
+        const float* a = &_args[item.index];
+        g2.fillRect(a[0], a[1], a[2], a[3]);
+      }
+        break;
+      case DisplayOp::roundRect: {
+        const float* a = &_args[item.index];
+        g2.drawRoundRect(a[0], a[1], a[2], a[3], a[4], a[5]);
+      }
+        break;
+      case DisplayOp::fillRoundRect: {
+        const float* a = &_args[item.index];
+        g2.fillRoundRect(a[0], a[1], a[2], a[3], a[4], a[5]);
+      }
+        break;
+      case DisplayOp::layout:
+        g2.drawTextLayout(_layouts[item.index], _args[item.count], _args[item.count + 1]);
+        break;
+    }
+  }
+  // back to the transformation of the context on entry
+  if (current != nullptr) {
+    applyFrame(g2, relative(*current, Frame()));
+    g2.translate(-x, -y);
+  }
+}
+
+/************************************* DisplayListRecorder implementation **********************/
+
+DisplayListRecorder::DisplayListRecorder(color c, const Stroke& s, const Font* font, float sx, float sy)
+  : _list(sptrOf<DisplayList>()), _color(c), _stroke(s), _font(font),
+    _hasEmitted(false), _ox(0), _oy(0), _sx(sx), _sy(sy) {
+  _list->_initialStroke = s;
+  _list->_initialFont = font;
+  _list->_initialSx = sx;
+  _list->_initialSy = sy;
+}
+
+sptr<DisplayList> DisplayListRecorder::finish() {
+  return _list;
+}
+
+void DisplayListRecorder::emitFrame() {
+  if (_hasEmitted && _frame == _emitted) return;
+  _list->_items.push_back({DisplayOp::frame, (u32) _list->_frames.size(), 0});
+  _list->_frames.push_back(_frame);
+  _emitted = _frame;
+  _hasEmitted = true;
+}
+
+void DisplayListRecorder::emitShape(DisplayOp op, std::initializer_list<float> args) {
+  emitFrame();
+  auto& a = _list->_args;
+  _list->_items.push_back({op, (u32) a.size(), (u32) args.size()});
+  a.insert(a.end(), args);
+}
+
+void DisplayListRecorder::transform(float a, float b, float c, float d) {
+  const Frame& f = _frame;
+  _frame = Frame(
+    f.m00 * a + f.m01 * c, f.m00 * b + f.m01 * d,
+    f.m10 * a + f.m11 * c, f.m10 * b + f.m11 * d
+  );
+}
+
+void DisplayListRecorder::setColor(color c) {
+  _color = c;
+  _list->_items.push_back({DisplayOp::color, c, 0});
+}
+
+color DisplayListRecorder::getColor() const {
+  return _color;
+}
+
+void DisplayListRecorder::setStroke(const Stroke& s) {
+  _stroke = s;
+  _list->_items.push_back({DisplayOp::stroke, (u32) _list->_strokes.size(), 0});
+  _list->_strokes.push_back(s);
+}
+
+const Stroke& DisplayListRecorder::getStroke() const {
+  return _stroke;
+}
+
+void DisplayListRecorder::setStrokeWidth(float w) {
+  Stroke s = _stroke;
+  s.lineWidth = w;
+  setStroke(s);
+}
+
+const Font* DisplayListRecorder::getFont() const {
+  return _font;
+}
+
+void DisplayListRecorder::setFont(const Font* font) {
+  _font = font;
+  _list->_items.push_back({DisplayOp::font, (u32) _list->_fonts.size(), 0});
+  _list->_fonts.push_back(font);
+}
+
+void DisplayListRecorder::translate(float dx, float dy) {
+  _ox += dx;
+  _oy += dy;
+}
+
+void DisplayListRecorder::scale(float sx, float sy) {
+  transform(sx, 0, 0, sy);
+  _ox /= sx;
+  _oy /= sy;
+  _sx *= sx;
+  _sy *= sy;
+}
+
+void DisplayListRecorder::rotate(float angle) {
+  const float c = cos(angle), s = sin(angle);
+  transform(c, -s, s, c);
+  const float x = _ox, y = _oy;
+  _ox = c * x + s * y;
+  _oy = -s * x + c * y;
+}
+
+void DisplayListRecorder::rotate(float angle, float px, float py) {
+  translate(px, py);
+  rotate(angle);
+  translate(-px, -py);
+}
+
+void DisplayListRecorder::reset() {
+  _frame = Frame();
+  _ox = _oy = 0;
+  _sx = _sy = 1;
+}
+
+float DisplayListRecorder::sx() const {
+  return _sx;
+}
+
+float DisplayListRecorder::sy() const {
+  return _sy;
+}
+
+void DisplayListRecorder::drawChar(wchar_t c, float x, float y) {
+  const Point p(x, y);
+  drawGlyphs(&c, &p, 1);
+}
+
+void DisplayListRecorder::drawGlyphs(const wchar_t* chars, const Point* positions, int count) {
+  emitFrame();
+  auto& items = _list->_items;
+  // extend the current run if it is the last item
+  if (items.empty() || items.back().op != DisplayOp::glyphs) {
+    items.push_back({DisplayOp::glyphs, (u32) _list->_chars.size(), 0});
+  }
+  for (int i = 0; i < count; i++) {
+    _list->_chars.push_back(chars[i]);
+    _list->_positions.emplace_back(_ox + positions[i].x, _oy + positions[i].y);
+  }
+  items.back().count += count;
+}
+
+void DisplayListRecorder::drawText(const wstring& c, float x, float y) {
+  emitFrame();
+  auto& a = _list->_args;
+  _list->_items.push_back({DisplayOp::text, (u32) _list->_texts.size(), (u32) a.size()});
+  _list->_texts.push_back(c);
+  a.push_back(_ox + x);
+  a.push_back(_oy + y);
+}
+
+void DisplayListRecorder::drawLine(float x1, float y1, float x2, float y2) {
+  emitShape(DisplayOp::line, {_ox + x1, _oy + y1, _ox + x2, _oy + y2});
+}
+
+void DisplayListRecorder::drawRect(float x, float y, float w, float h) {
+  emitShape(DisplayOp::rect, {_ox + x, _oy + y, w, h});
+}
+
+void DisplayListRecorder::fillRect(float x, float y, float w, float h) {
+  emitShape(DisplayOp::fillRect, {_ox + x, _oy + y, w, h});
+}
+
+void DisplayListRecorder::drawRoundRect(float x, float y, float w, float h, float rx, float ry) {
+  emitShape(DisplayOp::roundRect, {_ox + x, _oy + y, w, h, rx, ry});
+}
+
+void DisplayListRecorder::fillRoundRect(float x, float y, float w, float h, float rx, float ry) {
+  emitShape(DisplayOp::fillRoundRect, {_ox + x, _oy + y, w, h, rx, ry});
+}
+
+void DisplayListRecorder::drawTextLayout(const sptr<TextLayout>& layout, float x, float y) {
+  emitFrame();
+  auto& a = _list->_args;
+  _list->_items.push_back({DisplayOp::layout, (u32) _list->_layouts.size(), (u32) a.size()});
+  _list->_layouts.push_back(layout);
+  a.push_back(_ox + x);
+  a.push_back(_oy + y);
+}
@@ -0,0 +1,197 @@
+#ifndef DISPLAY_LIST_H_INCLUDED
+#define DISPLAY_LIST_H_INCLUDED
+
+#include "graphic/graphic.h"
+
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+namespace tex {
+
+/** The linear part of a transformation, maps (x, y) to (m00 x + m01 y, m10 x + m11 y) */
+struct Frame {
+  float m00, m01, m10, m11;
+
+  Frame() : m00(1), m01(0), m10(0), m11(1) {}
+
+  Frame(float a, float b, float c, float d) : m00(a), m01(b), m10(c), m11(d) {}
+
+  inline bool operator==(const Frame& f) const {
+    return m00 == f.m00 && m01 == f.m01 && m10 == f.m10 && m11 == f.m11;
+  }
+
+  inline bool operator!=(const Frame& f) const { return !(*this == f); }
+};
+
+enum class DisplayOp : u8 {
+  // switch to the frame _frames[index]
+  frame,
+  // set the color to index
+  color,
+  // set the stroke to _strokes[index]
+  stroke,
+  // set the font to _fonts[index]
+  font,
+  // draw the characters _chars[index, index + count) at the same range of _positions
+  glyphs,
+  // draw the text _texts[index] at _args[count, count + 2)
+  text,
+  // the shapes with arguments _args[index, index + count)
+  line,
+  rect,
+  fillRect,
+  roundRect,
+  fillRoundRect,
+  // draw the text layout _layouts[index] at _args[count, count + 2)
+  layout
+};
+
+struct DisplayItem {
+  DisplayOp op;
+  u32 index;
+  u32 count;
+};
+
+/**
+ * A flat list of the drawing operations of a box tree. The transformations
+ * are folded into the coordinates: the operations are grouped by frames (the
+ * scaling and rotation in effect), and every coordinate is absolute in its
+ * frame, so replaying the list doesn't need to walk the tree nor to
+ * translate back and forth for every glyph.
+ */
+class DisplayList {
+private:
+  friend class DisplayListRecorder;
+
+  std::vector<DisplayItem> _items;
+  std::vector<Frame> _frames;
+  std::vector<wchar_t> _chars;
+  std::vector<Point> _positions;
+  std::vector<float> _args;
+  std::vector<Stroke> _strokes;
+  std::vector<const Font*> _fonts;
+  std::vector<std::wstring> _texts;
+  std::vector<sptr<TextLayout>> _layouts;
+  // the state of the context the list was recorded against
+  Stroke _initialStroke;
+  const Font* _initialFont;
+  // the boxes adjust the widths of the lines to the scale of the context
+  float _initialSx, _initialSy;
+
+  /** Concatenate the given frame to the transformation of the given context */
+  static void applyFrame(Graphics2D& g2, const Frame& f);
+
+public:
+  DisplayList() : _initialFont(nullptr), _initialSx(1), _initialSy(1) {}
+
+  no_copy_assign(DisplayList);
+
+  /**
+   * Test if this list can be replayed onto the given graphics context, that is
+   * the context has the same stroke, font and scale as the one this list was
+   * recorded against.
+   */
+  bool isCompatible(const Graphics2D& g2) const;
+
+  /**
+   * Replay this list onto the given graphics context, relative to the current
+   * transformation of the context, which is the same after.
+   *
+   * @param g2 the graphics context
+   * @param x the x offset (in pixel) to draw the list at
+   * @param y the y offset (in pixel) to draw the list at
+   */
+  void draw(Graphics2D& g2, float x, float y) const;
+};
+
+/**
+ * A graphics context that records the drawing operations into a DisplayList
+ * instead of drawing them.
+ */
+class DisplayListRecorder : public Graphics2D {
+private:
+  sptr<DisplayList> _list;
+  color _color;
+  Stroke _stroke;
+  const Font* _font;
+  // the current frame, the last emitted one and the origin in current frame
+  Frame _frame, _emitted;
+  bool _hasEmitted;
+  float _ox, _oy;
+  float _sx, _sy;
+
+  void emitFrame();
+
+  void emitShape(DisplayOp op, std::initializer_list<float> args);
+
+  /** Concatenate the given linear transformation to current frame. */
+  void transform(float a, float b, float c, float d);
+
+public:
+  /**
+   * Create a recorder starts with the given state
+   *
+   * @param c the current color
+   * @param s the current stroke
+   * @param font the current font
+   * @param sx the current scale in x direction
+   * @param sy the current scale in y direction
+   */
+  DisplayListRecorder(color c, const Stroke& s, const Font* font, float sx = 1, float sy = 1);
+
+  no_copy_assign(DisplayListRecorder);
+
+  /** Get the recorded list, the recorder should not be used after. */
+  sptr<DisplayList> finish();
+
+  void setColor(color c) override;
+
+  color getColor() const override;
+
+  void setStroke(const Stroke& s) override;
+
+  const Stroke& getStroke() const override;
+
+  void setStrokeWidth(float w) override;
+
+  const Font* getFont() const override;
+
+  void setFont(const Font* font) override;
+
+  void translate(float dx, float dy) override;
+
+  void scale(float sx, float sy) override;
+
+  void rotate(float angle) override;
+
+  void rotate(float angle, float px, float py) override;
+
+  void reset() override;
+
+  float sx() const override;
+
+  float sy() const override;
+
+  void drawChar(wchar_t c, float x, float y) override;
+
+  void drawGlyphs(const wchar_t* chars, const Point* positions, int count) override;
+
+  void drawText(const std::wstring& c, float x, float y) override;
+
+  void drawLine(float x1, float y1, float x2, float y2) override;
+
+  void drawRect(float x, float y, float w, float h) override;
+
+  void fillRect(float x, float y, float w, float h) override;
+
+  void drawRoundRect(float x, float y, float w, float h, float rx, float ry) override;
+
+  void fillRoundRect(float x, float y, float w, float h, float rx, float ry) override;
+
+  void drawTextLayout(const sptr<TextLayout>& layout, float x, float y) override;
+};
+
+}  // namespace tex
+
+#endif  // DISPLAY_LIST_H_INCLUDED
@@ -238,6 +238,31 @@ public:
    * @param ry radius in y-direction
    */
   virtual void fillRoundRect(float x, float y, float w, float h, float rx, float ry) = 0;
+
+  /**
+   * Draw a run of characters with the current font, the backends should map it
+   * to their native batched glyph drawing, the default implementation draws
+   * the characters one by one.
+   *
+   * @param chars the characters to draw
+   * @param positions the positions (baseline aligned) of the characters
+   * @param count the count of the characters
+   */
+  virtual void drawGlyphs(const wchar_t* chars, const Point* positions, int count) {
+    for (int i = 0; i < count; i++) drawChar(chars[i], positions[i].x, positions[i].y);
+  }
+
+  /**
+   * Draw text layout, the default implementation lets the layout draw itself
+   * onto this context
+   *
+   * @param layout the layout to draw
+   * @param x the x coordinate
+   * @param y the y coordinate, is baseline aligned
+   */
+  virtual void drawTextLayout(const sptr<TextLayout>& layout, float x, float y) {
+    layout->draw(*this, x, y);
+  }
 };
 
 }  // namespace tex
@@ -3,7 +3,13 @@
 #include "core/core.h"
 #include "core/formula.h"
 #include "core/macro.h"
+#include "core/parse_cache.h"
 #include "fonts/fonts.h"
+#include "utils/thread_pool.h"
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
 #if CLATEX_CXX17
 #include <filesystem>
 #endif
@@ -14,8 +20,13 @@ using namespace tex;
 string tex::RES_BASE = "res";
 static string CHECK_FILE = ".clatexmath-res_root";
 
-Formula* LaTeX::_formula = nullptr;
-TeXRenderBuilder* LaTeX::_builder = nullptr;
+LaTeXContext* LaTeX::_context = nullptr;
+
+// if the registered alphabets are loaded and the ids of the symbols they define
+// are resolved, reset by LaTeX::release so the contexts created after the next
+// LaTeX::init load them again
+static mutex alphabetsMutex;
+static bool alphabetsLoaded = false;
 
 string LaTeX::queryResourceLocation(string& custom_path) {
   queue<string> paths;
@@ -92,26 +103,31 @@ void LaTeX::init(string res_root_path) {
     }
   } catch (std::exception&) {
   }
-  if (_formula != nullptr) return;
+  if (_context != nullptr) return;
 
   NewCommandMacro::_init_();
   DefaultTeXFont::_init_();
   Formula::_init_();
   TextRenderingBox::_init_();
+  SymbolAtom::resolveIds();
 
-  _formula = new Formula();
-  _builder = new TeXRenderBuilder();
+  _context = new LaTeXContext();
 }
 
 void LaTeX::release() {
+  // the macros defined by the default context must be freed before the shared ones
+  if (_context != nullptr) delete _context;
+  _context = nullptr;
+  {
+    lock_guard<mutex> lock(alphabetsMutex);
+    alphabetsLoaded = false;
+  }
+
   DefaultTeXFont::_free_();
   Formula::_free_();
   MacroInfo::_free_();
   NewCommandMacro::_free_();
   TextRenderingBox::_free_();
-
-  if (_formula != nullptr) delete _formula;
-  if (_builder != nullptr) delete _builder;
 }
 
 const string& LaTeX::getResRootPath() {
@@ -122,20 +138,185 @@ void LaTeX::setDebug(bool debug) {
   Formula::setDEBUG(debug);
 }
 
+void LaTeX::setRetainAtoms(bool retain) {
+  _context->setRetainAtoms(retain);
+}
+
 TeXRender* LaTeX::parse(const wstring& latex, int width, float textSize, float lineSpace, color fg) {
+  return _context->parse(latex, width, textSize, lineSpace, fg);
+}
+
+vector<BatchResult> LaTeX::parseBatch(
+  const wstring* inputs,
+  size_t count,
+  const BatchOptions& options
+) {
+  vector<BatchResult> results(count);
+  ThreadPool pool(options.threads);
+  // the contexts are created lazily by the workers
+  vector<unique_ptr<LaTeXContext>> contexts(pool.size());
+  pool.forEach(count, [&](size_t i, size_t worker) {
+    auto& context = contexts[worker];
+    if (context == nullptr) {
+      context.reset(new LaTeXContext());
+      context->setUseArena(options.useArena);
+      if (options.dpi > 0) context->setDPITarget(options.dpi);
+    }
+    BatchResult& result = results[i];
+    bool failed = true;
+    try {
+      result.render = sptr<TeXRender>(context->parse(
+        inputs[i],
+        options.width,
+        options.textSize,
+        options.lineSpace,
+        options.foreground
+      ));
+      if (options.draw) options.draw(i, *result.render);
+      failed = false;
+    } catch (const std::exception& e) {
+      result.render = nullptr;
+      result.error = e.what();
+    } catch (...) {
+      result.render = nullptr;
+      result.error = "unknown error";
+    }
+    if (failed) {
+      // a failed formula may leave any state behind, the next one parses with
+      // a new context
+      context.reset();
+    } else {
+      context->clearMacros();
+    }
+  });
+  return results;
+}
+
+vector<BatchResult> LaTeX::parseBatch(const vector<wstring>& inputs, const BatchOptions& options) {
+  return parseBatch(inputs.data(), inputs.size(), options);
+}
+
+LaTeXContext::LaTeXContext()
+  : _pixelsPerPoint(0), _useArena(false), _retainAtoms(false), _memoize(false),
+    _optimalBreaking(false), _cache(nullptr) {
+  // Load the alphabets eagerly, so the shared font tables are never modified
+  // while the contexts are parsing, and resolve the ids of the symbols they define
+  {
+    lock_guard<mutex> lock(alphabetsMutex);
+    if (!alphabetsLoaded) {
+      DefaultTeXFont::loadRegisteredAlphabets();
+      SymbolAtom::resolveIds();
+      alphabetsLoaded = true;
+    }
+  }
+
+  _formula = new Formula();
+  _builder = new TeXRenderBuilder();
+  _macros = new MacroScope();
+}
+
+void LaTeXContext::setDPITarget(float dpi) {
+  _pixelsPerPoint = dpi / 72.f;
+}
+
+void LaTeXContext::setUseArena(bool useArena) {
+  _useArena = useArena;
+}
+
+void LaTeXContext::setRetainAtoms(bool retain) {
+  _retainAtoms = retain;
+}
+
+void LaTeXContext::setMemoize(bool memoize) {
+  _memoize = memoize;
+}
+
+void LaTeXContext::setOptimalBreaking(bool optimal) {
+  _optimalBreaking = optimal;
+}
+
+void LaTeXContext::setParallelCells(size_t cells, size_t threads) {
+  _parallelCells = ParallelCells(cells, threads);
+}
+
+void LaTeXContext::clearMacros() {
+  _macros->clear();
+}
+
+void LaTeXContext::setIncremental(bool incremental) {
+  if (incremental && _cache == nullptr) {
+    _cache = new ParseCache();
+  } else if (!incremental) {
+    delete _cache;
+    _cache = nullptr;
+  }
+  _source.clear();
+}
+
+TeXRender* LaTeXContext::reparse(
+  size_t offset, size_t removed, const wstring& inserted,
+  int width, float textSize, float lineSpace, color fg
+) {
+  offset = std::min(offset, _source.length());
+  removed = std::min(removed, _source.length() - offset);
+  _source.replace(offset, removed, inserted);
+  return parse(_source, width, textSize, lineSpace, fg);
+}
+
+TeXRender* LaTeXContext::parse(const wstring& latex, int width, float textSize, float lineSpace, color fg) {
+  if (_cache != nullptr) {
+    // the source is the whole formula, it defines its macros again
+    _macros->clear();
+    _source = latex;
+  }
+  // Install the state of this context on the current thread
+  MacroScopeActivation macros(_macros);
+  // the identical parts of the formula share their atoms, out of the
+  // incremental mode they are shared in this formula only
+  ParseCache formulaCache;
+  ParseCacheActivation cache(_cache != nullptr ? _cache : (_memoize ? &formulaCache : nullptr));
+  PixelsPerPointScope pixelsPerPoint(_pixelsPerPoint > 0 ? _pixelsPerPoint : Formula::PIXELS_PER_POINT);
+  // the objects allocated from the arena hold it, it goes away with the render
+  sptr<Arena> arena = _useArena ? std::make_shared<Arena>() : nullptr;
+  ArenaActivation activation(arena.get());
+
   bool lined = true;
   if (startswith(latex, L"$$") || startswith(latex, L"\\[")) {
     lined = false;
   }
   Alignment align = lined ? Alignment::left : Alignment::center;
-  _formula->setLaTeX(latex);
-  TeXRender* render =
-    _builder->setStyle(TexStyle::display)
-      .setTextSize(textSize)
-      .setWidth(UnitType::pixel, width, align)
-      .setIsMaxWidth(lined)
-      .setLineSpace(UnitType::pixel, lineSpace)
-      .setForeground(fg)
-      .build(*_formula);
+  TeXRender* render = nullptr;
+  try {
+    _formula->setLaTeX(latex);
+    render =
+      _builder->setStyle(TexStyle::display)
+        .setTextSize(textSize)
+        .setWidth(UnitType::pixel, width, align)
+        .setIsMaxWidth(lined)
+        .setLineSpace(UnitType::pixel, lineSpace)
+        .setForeground(fg)
+        .setRetainAtoms(_retainAtoms)
+        .setMemoize(_memoize)
+        .setOptimalBreaking(_optimalBreaking)
+        .setParallelCells(_parallelCells.cells, _parallelCells.threads)
+        .build(*_formula);
+  } catch (...) {
+    if (_cache != nullptr) _cache->rollback();
+    throw;
+  }
+
+  if (_cache != nullptr) _cache->commit();
+  if (arena != nullptr) {
+    // drop the atom tree so the arena is owned by the render only
+    _formula->_root = nullptr;
+    _formula->_middle.clear();
+  }
   return render;
 }
+
+LaTeXContext::~LaTeXContext() {
+  delete _formula;
+  delete _builder;
+  delete _macros;
+  delete _cache;
+}
@@ -6,18 +6,192 @@
 #include "graphic/graphic_basic.h"
 #include "render.h"
 
+#include <cstddef>
+#include <functional>
 #include <string>
 #include <queue>
 #include <sstream>
+#include <vector>
 
 namespace tex {
 
 class Formula;
+class MacroScope;
+class ParseCache;
+
+/**
+ * An independent context to parse and render TeX formatted strings. Every
+ * context owns its formula, render builder, target DPI and the macros defined
+ * while parsing (via \newcommand and so on); the font and symbol tables are
+ * loaded once by LaTeX::init and shared (read-only) by all the contexts. A
+ * context must not be used by several threads at the same time, but distinct
+ * contexts can work concurrently, e.g. one per worker thread.
+ *
+ * The contexts are owned by their creator, and they must be deleted before
+ * LaTeX::release frees the shared tables. LaTeX::parse uses the default
+ * context, created by LaTeX::init and deleted by LaTeX::release.
+ */
+class LaTeXContext {
+private:
+  Formula* _formula;
+  TeXRenderBuilder* _builder;
+  MacroScope* _macros;
+  // point-to-pixel conversion of this context, non-positive means use the
+  // one of the current thread (see Formula::setDPITarget)
+  float _pixelsPerPoint;
+  // if allocate the atoms and boxes of each formula from an arena
+  bool _useArena;
+  // if the renders retain their atom trees to relayout
+  bool _retainAtoms;
+  // if share the atoms and the boxes of the identical parts of a formula
+  bool _memoize;
+  // if break the lines with the total-fit algorithm
+  bool _optimalBreaking;
+  // the options of the parallel layout of the large matrices
+  ParallelCells _parallelCells;
+  // the atoms of the last parsed formula and its source, nullptr if not in
+  // incremental mode
+  ParseCache* _cache;
+  std::wstring _source;
+
+public:
+  /** Create a new context, LaTeX::init must have been called before. */
+  LaTeXContext();
+
+  no_copy_assign(LaTeXContext);
+
+  /**
+   * Set the DPI of target of this context
+   *
+   * @param dpi the target DPI
+   */
+  void setDPITarget(float dpi);
+
+  /**
+   * Set if allocate the atoms, boxes and environments of each parsed formula
+   * from a per-render arena, default is false. The arena is released in one
+   * shot when the returned TeXRender is destroyed, it saves lots of small
+   * allocations when rendering formulas in batch.
+   *
+   * Every object allocated from the arena holds a reference to it (see
+   * ArenaAllocator), so the objects still count their references to the
+   * arena atomically, and an object that outlives its render (e.g. an atom
+   * reused by the incremental mode) keeps the whole arena of that render
+   * alive.
+   */
+  void setUseArena(bool useArena);
+
+  /**
+   * Set if the parsed renders retain their atom trees, so they can be laid
+   * out with another width by TeXRender::relayout without parsing again,
+   * default is false.
+   */
+  void setRetainAtoms(bool retain);
+
+  /**
+   * Set if the identical parts of a formula (the same groups, or the same
+   * commands with the same arguments) are parsed and laid out once and shared,
+   * default is false. It fits the large generated formulas (e.g. the output
+   * of a computer algebra system, or a matrix of similar entries), see
+   * TeXRenderBuilder::setMemoize.
+   */
+  void setMemoize(bool memoize);
+
+  /**
+   * Set if the lines of the formulas wider than the given width are broken
+   * so they are as evenly full as possible, rather than filled one by one,
+   * default is false. See TeXRenderBuilder::setOptimalBreaking.
+   */
+  void setOptimalBreaking(bool optimal);
+
+  /**
+   * Set the minimum count of cells of a matrix to lay out its cells in
+   * parallel on threads shared by all the contexts, and the count of
+   * threads, default is 1024 cells on as many threads as the hardware
+   * supports. See TeXRenderBuilder::setParallelCells.
+   */
+  void setParallelCells(std::size_t cells, std::size_t threads = 0);
+
+  /** Forget all the macros defined by the formulas parsed by this context. */
+  void clearMacros();
+
+  /**
+   * Set if parse incrementally, default is false. It fits the live editors
+   * that parse the same (long) formula again after every edit: the atoms
+   * parsed from the groups (and the arguments) of the last formula are kept,
+   * and reused for the groups of the next one that are not touched by the
+   * edit, as long as the macros defined before them are the same. The
+   * formula is the whole source in this mode, the macros are forgotten before
+   * each parse, see reparse. Only the atoms are reused, the formula is laid
+   * out again, the boxes of the reused atoms are shared as well if the
+   * formulas are memoized, see setMemoize.
+   */
+  void setIncremental(bool incremental);
+
+  /**
+   * Apply an edit to the source of the last formula parsed in incremental
+   * mode and parse it again, see setIncremental. The edit is clamped to the
+   * source.
+   *
+   * @param offset the offset of the edit in the source
+   * @param removed the count of the characters removed from the offset
+   * @param inserted the text inserted at the offset
+   * @param width the width of the 2D graphics context
+   * @param textSize the text size
+   * @param lineSpace the line space
+   * @param fg the foreground color
+   */
+  TeXRender* reparse(
+    std::size_t offset, std::size_t removed, const std::wstring& inserted,
+    int width, float textSize, float lineSpace, color fg
+  );
+
+  /**
+   * Parse TeX formatted string to TeXRender with this context
+   *
+   * @param tex the TeX formatted string
+   * @param width the width of the 2D graphics context
+   * @param textSize the text size
+   * @param lineSpace the line space
+   * @param fg the foreground color
+   */
+  TeXRender* parse(const std::wstring& tex, int width, float textSize, float lineSpace, color fg);
+
+  ~LaTeXContext();
+};
+
+/** The options to render formulas in batch, see LaTeX::parseBatch */
+struct BatchOptions {
+  // the width of the 2D graphics context
+  int width = 720;
+  // the text size
+  float textSize = 20.f;
+  // the line space
+  float lineSpace = 20.f / 3.f;
+  // the foreground color
+  color foreground = BLACK;
+  // the target DPI, non-positive means the default one
+  float dpi = 0;
+  // if allocate the atoms and boxes of each formula from an arena
+  bool useArena = true;
+  // the count of threads, 0 means as many as the hardware supports
+  std::size_t threads = 0;
+  // called on the worker thread once the formula of the given index is
+  // parsed, e.g. to draw it, may be empty
+  std::function<void(std::size_t index, TeXRender& render)> draw;
+};
+
+/** The result of a formula rendered in batch */
+struct BatchResult {
+  // the render, nullptr if failed
+  sptr<TeXRender> render;
+  // the error message if failed
+  std::string error;
+};
 
 class LaTeX {
 private:
-  static Formula* _formula;
-  static TeXRenderBuilder* _builder;
+  static LaTeXContext* _context;
 
 protected:
   static std::string queryResourceLocation(std::string& custom_path);
@@ -41,7 +215,17 @@ public:
   static void setDebug(bool debug);
 
   /**
-   * Parse TeX formatted string to TeXRender
+   * Set if the renders parsed by LaTeX::parse retain their atom trees, see
+   * LaTeXContext::setRetainAtoms
+   */
+  static void setRetainAtoms(bool retain);
+
+  /**
+   * Parse TeX formatted string to TeXRender with the default context. The
+   * default context is owned by LaTeX, it is created by LaTeX::init and
+   * deleted by LaTeX::release, and like any context it must not be used by
+   * several threads at the same time: use a LaTeXContext per thread (or
+   * LaTeX::parseBatch) to parse concurrently.
    *
    * @param tex the TeX formatted string
    * @param width the width of the 2D graphics context
@@ -52,7 +236,37 @@ public:
   static TeXRender* parse(const std::wstring& tex, int width, float textSize, float lineSpace, color fg);
 
   /**
-   * Release the LaTeX context
+   * Parse, layout and draw (if BatchOptions::draw is given) a batch of TeX
+   * formatted strings on a pool of threads. Every worker thread has its own
+   * LaTeXContext, and the macros defined by a formula are forgotten after it,
+   * so the results do not depend on how the formulas are scheduled. A formula
+   * fails on its own, its error is reported in its result instead of aborting
+   * the batch, and the worker parses the next formulas with a new context.
+   * The graphics backend must support drawing from several threads if
+   * BatchOptions::draw is given.
+   *
+   * @param inputs the TeX formatted strings
+   * @param count the count of the strings
+   * @param options the options to render
+   * @return the results in the same order as the inputs
+   */
+  static std::vector<BatchResult> parseBatch(
+    const std::wstring* inputs,
+    std::size_t count,
+    const BatchOptions& options
+  );
+
+  /** @see parseBatch(const std::wstring*, std::size_t, const BatchOptions&) */
+  static std::vector<BatchResult> parseBatch(
+    const std::vector<std::wstring>& inputs,
+    const BatchOptions& options
+  );
+
+  /**
+   * Release the LaTeX context: delete the default context and free the shared
+   * tables, the contexts created by the user must be deleted before. LaTeX::init
+   * can be called again after, the contexts created then load the registered
+   * alphabets again.
    */
   static void release();
 };
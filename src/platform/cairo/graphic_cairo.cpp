@@ -295,6 +295,28 @@ void Graphics2D_cairo::drawText(const wstring& t, float x, float y) {
   _context->show_text(wide2utf8(t));
 }
 
+void Graphics2D_cairo::drawGlyphs(const wchar_t* chars, const Point* positions, int count) {
+  _context->set_font_face(_font->getCairoFontFace());
+  _context->set_font_size(_font->getSize());
+  // map the characters to glyph indices once for the whole run
+  vector<Cairo::Glyph> glyphs;
+  vector<Cairo::TextCluster> clusters;
+  Cairo::TextClusterFlags flags;
+  _context->get_scaled_font()->text_to_glyphs(
+    0, 0, wide2utf8(wstring(chars, count)), glyphs, clusters, flags
+  );
+  if (glyphs.size() != (size_t) count) {
+    // not one glyph per character
+    Graphics2D::drawGlyphs(chars, positions, count);
+    return;
+  }
+  for (int i = 0; i < count; i++) {
+    glyphs[i].x = positions[i].x;
+    glyphs[i].y = positions[i].y;
+  }
+  _context->show_glyphs(glyphs);
+}
+
 void Graphics2D_cairo::drawLine(float x1, float y1, float x2, float y2) {
   _context->move_to(x1, y1);
   _context->line_to(x2, y2);
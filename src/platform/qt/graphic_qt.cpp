@@ -12,6 +12,7 @@
 #include <QColor>
 #include <QFont>
 #include <QFontDatabase>
+#include <QGlyphRun>
 #include <QPainter>
 #include <QPen>
 #include <QPointF>
@@ -306,6 +307,29 @@ void Graphics2D_qt::drawText(const std::wstring& t, float x, float y) {
   _painter->drawText(QPointF(x, y), text);
 }
 
+void Graphics2D_qt::drawGlyphs(const wchar_t* chars, const Point* positions, int count) {
+  if (_rawFontOf != _font) {
+    // resolve the font against the paint device, as drawText does
+    _rawFont = QRawFont::fromFont(QFont(_font->getQFont(), _painter->device()));
+    _rawFontOf = _font;
+  }
+  QString text = wstring_to_QString(std::wstring(chars, count));
+  QVector<quint32> indexes = _rawFont.glyphIndexesForString(text);
+  if (indexes.size() != count) {
+    // not one glyph per character
+    Graphics2D::drawGlyphs(chars, positions, count);
+    return;
+  }
+  QVector<QPointF> points(count);
+  for (int i = 0; i < count; i++) points[i] = QPointF(positions[i].x, positions[i].y);
+
+  QGlyphRun run;
+  run.setRawFont(_rawFont);
+  run.setGlyphIndexes(indexes);
+  run.setPositions(points);
+  _painter->drawGlyphRun(QPointF(0, 0), run);
+}
+
 void Graphics2D_qt::drawLine(float x1, float y1, float x2, float y2) {
   _painter->drawLine(QPointF(x1, y1), QPointF(x2, y2));
 }
@@ -12,6 +12,7 @@
 #include <QFont>
 #include <QMap>
 #include <QPainter>
+#include <QRawFont>
 #include <QString>
 
 namespace tex {
@@ -78,6 +79,9 @@ private:
   Stroke _stroke;
   const Font_qt* _font;
   float _sx, _sy;
+  // the raw font of the last font used to draw glyph runs
+  const Font_qt* _rawFontOf = nullptr;
+  QRawFont _rawFont;
 
   void setPen();
   QBrush getQBrush() const;
@@ -119,6 +123,8 @@ public:
 
   virtual void drawText(const std::wstring& t, float x, float y) override;
 
+  virtual void drawGlyphs(const wchar_t* chars, const Point* positions, int count) override;
+
   virtual void drawLine(float x, float y1, float x2, float y2) override;
 
   virtual void drawRect(float x, float y, float w, float h) override;
@@ -258,6 +258,24 @@ void Graphics2D_skia::drawText(const wstring &t, float x, float y) {
   _canvas->drawString(str.c_str(), x, y, _font->getSkFont(), _paint);
 }
 
+void Graphics2D_skia::drawGlyphs(const wchar_t *chars, const Point *positions, int count) {
+  const SkFont font = _font->getSkFont();
+  SkTextBlobBuilder builder;
+  const auto &run = builder.allocRunPos(font, count);
+  for (int i = 0; i < count; i++) {
+    run.glyphs[i] = font.unicharToGlyph((SkUnichar) chars[i]);
+    if (run.glyphs[i] == 0) {
+      // no glyph for the character, draw it as text like drawChar does
+      Graphics2D::drawGlyphs(chars, positions, count);
+      return;
+    }
+    run.pos[2 * i] = positions[i].x;
+    run.pos[2 * i + 1] = positions[i].y;
+  }
+  _paint.setStyle(SkPaint::kFill_Style);
+  _canvas->drawTextBlob(builder.make(), 0, 0, _paint);
+}
+
 void Graphics2D_skia::drawLine(float x1, float y1, float x2, float y2) {
   _paint.setStyle(SkPaint::kStroke_Style);
   _canvas->drawLine(x1, y1, x2, y2, _paint);
@@ -9,6 +9,7 @@
 #include "graphic/graphic.h"
 #include <core/SkFont.h>
 #include <core/SkCanvas.h>
+#include <core/SkTextBlob.h>
 #include <map>
 #include <QtCore/QString>
 
@@ -125,6 +126,8 @@ public:
 
   virtual void drawText(const std::wstring &t, float x, float y) override;
 
+  virtual void drawGlyphs(const wchar_t *chars, const Point *positions, int count) override;
+
   virtual void drawLine(float x, float y1, float x2, float y2) override;
 
   virtual void drawRect(float x, float y, float w, float h) override;
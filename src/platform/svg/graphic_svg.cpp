@@ -0,0 +1,801 @@
+#include "config.h"
+
+#if defined(BUILD_SVG) && !defined(MEM_CHECK)
+
+#include "platform/svg/graphic_svg.h"
+#include "utils/arena.h"
+#include "utils/exceptions.h"
+#include "utils/utf.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+using namespace tex;
+using namespace std;
+
+namespace tex {
+
+/**
+ * The glyph outlines of a TrueType font file. Only the tables required to
+ * draw the glyphs are read: head, maxp, hhea, hmtx, cmap (format 4), loca and
+ * glyf. The loaded files are shared by all the fonts created from them.
+ */
+class GlyphOutlines {
+private:
+  struct OutlinePoint {
+    float x, y;
+    bool on;
+  };
+
+  using Contour = vector<OutlinePoint>;
+
+  static mutex _mutex;
+  static map<string, sptr<const GlyphOutlines>> _loaded;
+  static u32 _nextId;
+
+  const u32 _id;
+  vector<u8> _data;
+  u32 _glyf = 0, _loca = 0, _hmtx = 0, _cmap = 0;
+  u16 _unitsPerEm = 1000, _numGlyphs = 0, _numHMetrics = 0;
+  bool _longLoca = false;
+
+  inline u8 u8At(u32 i) const { return i < _data.size() ? _data[i] : 0; }
+
+  inline u16 u16At(u32 i) const { return (u16) ((u8At(i) << 8) | u8At(i + 1)); }
+
+  inline i16 i16At(u32 i) const { return (i16) u16At(i); }
+
+  inline u32 u32At(u32 i) const { return ((u32) u16At(i) << 16) | u16At(i + 2); }
+
+  inline float f2dot14At(u32 i) const { return i16At(i) / 16384.f; }
+
+  /** Find the offset of the table with the given tag, 0 if not found. */
+  u32 table(const char* tag) const;
+
+  /**
+   * Collect the contours of the given glyph, the points are transformed by
+   * (x, y) -> (m[0] x + m[2] y + m[4], m[1] x + m[3] y + m[5]).
+   */
+  void contours(u32 glyph, const float* m, vector<Contour>& out, int depth) const;
+
+  static void appendNumber(string& d, float v);
+
+  static void appendContour(string& d, const Contour& c);
+
+public:
+  GlyphOutlines(u32 id, vector<u8>&& data);
+
+  no_copy_assign(GlyphOutlines);
+
+  /** Load the outlines from the given TrueType file, the result is cached. */
+  static sptr<const GlyphOutlines> load(const string& file);
+
+  /** The unique id of the loaded file. */
+  inline u32 id() const { return _id; }
+
+  inline u16 unitsPerEm() const { return _unitsPerEm; }
+
+  /** Get the glyph index of the given character, 0 (the missing glyph) if not mapped. */
+  u32 glyphOf(wchar_t c) const;
+
+  /** Get the advance width (in font unit) of the given glyph. */
+  u16 advanceOf(u32 glyph) const;
+
+  /**
+   * Get the SVG path data of the given glyph in font unit, the y axis points
+   * downward as SVG's. Return false if the glyph has no outline.
+   */
+  bool pathOf(u32 glyph, string& d) const;
+};
+
+}  // namespace tex
+
+/************************************* GlyphOutlines implementation ****************************/
+
+mutex GlyphOutlines::_mutex;
+map<string, sptr<const GlyphOutlines>> GlyphOutlines::_loaded;
+u32 GlyphOutlines::_nextId = 0;
+
+GlyphOutlines::GlyphOutlines(u32 id, vector<u8>&& data) : _id(id), _data(std::move(data)) {
+  const u32 head = table("head");
+  const u32 maxp = table("maxp");
+  const u32 hhea = table("hhea");
+  _hmtx = table("hmtx");
+  _loca = table("loca");
+  _glyf = table("glyf");
+  if (head == 0 || maxp == 0 || _loca == 0 || _glyf == 0) {
+    throw ex_font_loaded("not a TrueType font with glyph outlines");
+  }
+  _unitsPerEm = u16At(head + 18);
+  if (_unitsPerEm == 0) _unitsPerEm = 1000;
+  _longLoca = i16At(head + 50) != 0;
+  _numGlyphs = u16At(maxp + 4);
+  if (hhea != 0) _numHMetrics = u16At(hhea + 34);
+  // prefer the Windows Unicode BMP subtable, then the Unicode one
+  const u32 cmap = table("cmap");
+  if (cmap == 0) return;
+  const u16 count = u16At(cmap + 2);
+  for (u16 i = 0; i < count; i++) {
+    const u32 rec = cmap + 4 + i * 8;
+    const u16 platform = u16At(rec), encoding = u16At(rec + 2);
+    const u32 sub = cmap + u32At(rec + 4);
+    if (u16At(sub) != 4) continue;
+    if (platform == 3 && encoding == 1) {
+      _cmap = sub;
+      break;
+    }
+    if (platform == 0 && _cmap == 0) _cmap = sub;
+  }
+}
+
+u32 GlyphOutlines::table(const char* tag) const {
+  const u16 count = u16At(4);
+  for (u16 i = 0; i < count; i++) {
+    const u32 rec = 12 + i * 16;
+    if (rec + 16 > _data.size()) break;
+    if (memcmp(&_data[rec], tag, 4) == 0) return u32At(rec + 8);
+  }
+  return 0;
+}
+
+sptr<const GlyphOutlines> GlyphOutlines::load(const string& file) {
+  lock_guard<mutex> lock(_mutex);
+  auto it = _loaded.find(file);
+  if (it != _loaded.end()) return it->second;
+  ifstream in(file, ios::binary);
+  if (!in) throw ex_font_loaded("cannot open the font file: " + file);
+  vector<u8> data((istreambuf_iterator<char>(in)), istreambuf_iterator<char>());
+  // the outlines are shared by all the renders, the font may be loaded while
+  // laying out a formula, they must not hold the arena of that render
+  ArenaSuspension suspension;
+  sptr<const GlyphOutlines> outlines;
+  try {
+    outlines = sptrOf<GlyphOutlines>(_nextId++, std::move(data));
+  } catch (const ex_font_loaded& e) {
+    throw ex_font_loaded(file + ": " + e.what());
+  }
+  _loaded[file] = outlines;
+  return outlines;
+}
+
+u32 GlyphOutlines::glyphOf(wchar_t c) const {
+  if (_cmap == 0 || (u32) c > 0xffff) return 0;
+  const u16 ch = (u16) c;
+  const u16 segCount = u16At(_cmap + 6) / 2;
+  const u32 ends = _cmap + 14;
+  const u32 starts = ends + segCount * 2 + 2;
+  const u32 deltas = starts + segCount * 2;
+  const u32 offsets = deltas + segCount * 2;
+  // binary search the first segment whose end code >= ch
+  u32 lo = 0, hi = segCount;
+  while (lo < hi) {
+    const u32 mid = (lo + hi) / 2;
+    if (u16At(ends + mid * 2) < ch) lo = mid + 1;
+    else hi = mid;
+  }
+  if (lo == segCount) return 0;
+  const u16 start = u16At(starts + lo * 2);
+  if (ch < start) return 0;
+  const u16 delta = u16At(deltas + lo * 2);
+  const u32 ro = offsets + lo * 2;
+  const u16 rangeOffset = u16At(ro);
+  if (rangeOffset == 0) return (u16) (ch + delta);
+  const u16 g = u16At(ro + rangeOffset + (ch - start) * 2);
+  return g == 0 ? 0 : (u16) (g + delta);
+}
+
+u16 GlyphOutlines::advanceOf(u32 glyph) const {
+  if (_hmtx == 0 || _numHMetrics == 0) return _unitsPerEm / 2;
+  const u32 i = glyph < _numHMetrics ? glyph : _numHMetrics - 1;
+  return u16At(_hmtx + i * 4);
+}
+
+void GlyphOutlines::contours(u32 glyph, const float* m, vector<Contour>& out, int depth) const {
+  if (glyph >= _numGlyphs || depth > 8) return;
+  u32 begin, end;
+  if (_longLoca) {
+    begin = u32At(_loca + glyph * 4);
+    end = u32At(_loca + glyph * 4 + 4);
+  } else {
+    begin = u16At(_loca + glyph * 2) * 2u;
+    end = u16At(_loca + glyph * 2 + 2) * 2u;
+  }
+  // empty glyph, e.g. space
+  if (end <= begin) return;
+  const u32 g = _glyf + begin;
+  const i16 n = i16At(g);
+
+  if (n < 0) {
+    // composite glyph, made of transformed components
+    u32 p = g + 10;
+    u16 flags;
+    do {
+      flags = u16At(p);
+      const u16 component = u16At(p + 2);
+      p += 4;
+      float dx, dy;
+      if (flags & 0x0001) {
+        dx = i16At(p);
+        dy = i16At(p + 2);
+        p += 4;
+      } else {
+        dx = (i8) u8At(p);
+        dy = (i8) u8At(p + 1);
+        p += 2;
+      }
+      // the point matching is not supported, place the component at origin
+      if (!(flags & 0x0002)) dx = dy = 0;
+      float a = 1, b = 0, c = 0, d = 1;
+      if (flags & 0x0008) {
+        a = d = f2dot14At(p);
+        p += 2;
+      } else if (flags & 0x0040) {
+        a = f2dot14At(p);
+        d = f2dot14At(p + 2);
+        p += 4;
+      } else if (flags & 0x0080) {
+        a = f2dot14At(p);
+        b = f2dot14At(p + 2);
+        c = f2dot14At(p + 4);
+        d = f2dot14At(p + 6);
+        p += 8;
+      }
+      const float cm[] = {
+        m[0] * a + m[2] * b, m[1] * a + m[3] * b,
+        m[0] * c + m[2] * d, m[1] * c + m[3] * d,
+        m[0] * dx + m[2] * dy + m[4], m[1] * dx + m[3] * dy + m[5],
+      };
+      contours(component, cm, out, depth + 1);
+    } while (flags & 0x0020);
+    return;
+  }
+
+  // simple glyph
+  const u32 endPts = g + 10;
+  if (n == 0) return;
+  const u32 count = u16At(endPts + (n - 1) * 2) + 1u;
+  u32 p = endPts + n * 2;
+  p += 2 + u16At(p);
+  // the flags, may repeat
+  vector<u8> flags(count);
+  for (u32 i = 0; i < count;) {
+    const u8 f = u8At(p++);
+    flags[i++] = f;
+    if (f & 0x08) {
+      for (u8 r = u8At(p++); r > 0 && i < count; r--) flags[i++] = f;
+    }
+  }
+  // the coordinates, stored as deltas
+  vector<i16> xs(count), ys(count);
+  i16 v = 0;
+  for (u32 i = 0; i < count; i++) {
+    const u8 f = flags[i];
+    if (f & 0x02) {
+      const u8 dv = u8At(p++);
+      v += (f & 0x10) ? dv : -dv;
+    } else if (!(f & 0x10)) {
+      v += i16At(p);
+      p += 2;
+    }
+    xs[i] = v;
+  }
+  v = 0;
+  for (u32 i = 0; i < count; i++) {
+    const u8 f = flags[i];
+    if (f & 0x04) {
+      const u8 dv = u8At(p++);
+      v += (f & 0x20) ? dv : -dv;
+    } else if (!(f & 0x20)) {
+      v += i16At(p);
+      p += 2;
+    }
+    ys[i] = v;
+  }
+  u32 first = 0;
+  for (i16 k = 0; k < n; k++) {
+    const u32 last = u16At(endPts + k * 2);
+    if (last < first || last >= count) break;
+    Contour c;
+    c.reserve(last - first + 1);
+    for (u32 i = first; i <= last; i++) {
+      const float x = xs[i], y = ys[i];
+      c.push_back({m[0] * x + m[2] * y + m[4], m[1] * x + m[3] * y + m[5], (flags[i] & 0x01) != 0});
+    }
+    out.push_back(std::move(c));
+    first = last + 1;
+  }
+}
+
+static int formatNumber(char* buf, float v) {
+  // keep more digits for the small values, e.g. the scales of the glyphs
+  const float a = std::abs(v);
+  if (a < 5e-7f) v = 0;
+  int n = snprintf(buf, 32, a < 1 ? "%.6f" : "%.3f", v);
+  while (buf[n - 1] == '0') n--;
+  if (buf[n - 1] == '.') n--;
+  buf[n] = '\0';
+  return n;
+}
+
+void GlyphOutlines::appendNumber(string& d, float v) {
+  char buf[32];
+  d.append(buf, formatNumber(buf, v));
+}
+
+void GlyphOutlines::appendContour(string& d, const Contour& c) {
+  const int n = (int) c.size();
+  if (n == 0) return;
+  const auto point = [&](char cmd, const OutlinePoint& p) {
+    d += cmd;
+    appendNumber(d, p.x);
+    d += ' ';
+    // flip the y axis
+    appendNumber(d, -p.y);
+  };
+  const auto mid = [](const OutlinePoint& p, const OutlinePoint& q) {
+    return OutlinePoint{(p.x + q.x) / 2, (p.y + q.y) / 2, true};
+  };
+  // start from the first on-curve point, or the middle of the last and the
+  // first point if all of them are off-curve
+  int from = -1;
+  for (int i = 0; i < n; i++) {
+    if (c[i].on) {
+      from = i;
+      break;
+    }
+  }
+  OutlinePoint start;
+  if (from >= 0) {
+    start = c[from];
+  } else {
+    start = mid(c[n - 1], c[0]);
+    from = n - 1;
+  }
+  point('M', start);
+  bool pending = false;
+  OutlinePoint ctrl{};
+  for (int k = 1; k <= n; k++) {
+    const OutlinePoint& p = c[(from + k) % n];
+    if (p.on) {
+      if (pending) {
+        point('Q', ctrl);
+        point(' ', p);
+        pending = false;
+      } else if (k < n) {
+        point('L', p);
+      }
+    } else {
+      if (pending) {
+        // 2 consecutive off-curve points imply an on-curve point in between
+        point('Q', ctrl);
+        point(' ', mid(ctrl, p));
+      }
+      ctrl = p;
+      pending = true;
+    }
+  }
+  if (pending) {
+    point('Q', ctrl);
+    point(' ', start);
+  }
+  d += 'Z';
+}
+
+bool GlyphOutlines::pathOf(u32 glyph, string& d) const {
+  static const float identity[] = {1, 0, 0, 1, 0, 0};
+  vector<Contour> cs;
+  contours(glyph, identity, cs, 0);
+  if (cs.empty()) return false;
+  for (const auto& c : cs) appendContour(d, c);
+  return true;
+}
+
+/************************************* Font_svg implementation *********************************/
+
+Font_svg::Font_svg(string family, int style, float size)
+  : _style(style), _size(size), _family(std::move(family)) {}
+
+Font_svg::Font_svg(const string& file, float size) : Font_svg("", PLAIN, size) {
+  _outlines = GlyphOutlines::load(file);
+  // the file name works as the family name since we never look fonts up by family
+  const auto slash = file.find_last_of("/\\");
+  const auto dot = file.find_last_of('.');
+  const auto begin = slash == string::npos ? 0 : slash + 1;
+  _family = file.substr(begin, dot == string::npos || dot < begin ? string::npos : dot - begin);
+}
+
+const string& Font_svg::getFamily() const {
+  return _family;
+}
+
+int Font_svg::getStyle() const {
+  return _style;
+}
+
+const sptr<const GlyphOutlines>& Font_svg::getOutlines() const {
+  return _outlines;
+}
+
+float Font_svg::getSize() const {
+  return _size;
+}
+
+sptr<Font> Font_svg::deriveFont(int style) const {
+  auto f = sptrOf<Font_svg>(_family, style, _size);
+  f->_outlines = _outlines;
+  return f;
+}
+
+bool Font_svg::operator==(const Font& ft) const {
+  const auto& f = static_cast<const Font_svg&>(ft);
+  return _size == f._size && _style == f._style && _family == f._family && _outlines == f._outlines;
+}
+
+bool Font_svg::operator!=(const Font& f) const {
+  return !(*this == f);
+}
+
+Font* Font::create(const string& file, float size) {
+  return new Font_svg(file, size);
+}
+
+sptr<Font> Font::_create(const string& name, int style, float size) {
+  return sptrOf<Font_svg>(name, style, size);
+}
+
+/************************************* TextLayout_svg implementation ***************************/
+
+TextLayout_svg::TextLayout_svg(const wstring& src, const sptr<Font_svg>& font)
+  : _text(src), _font(font) {}
+
+void TextLayout_svg::getBounds(Rect& r) {
+  // no metrics of the system fonts, take the average proportions of a sans-serif font
+  const float size = _font->getSize();
+  r.x = 0;
+  r.y = -0.8f * size;
+  r.w = 0.55f * size * _text.length();
+  r.h = size;
+}
+
+void TextLayout_svg::draw(Graphics2D& g2, float x, float y) {
+  const Font* old = g2.getFont();
+  g2.setFont(_font.get());
+  g2.drawText(_text, x, y);
+  g2.setFont(old);
+}
+
+sptr<TextLayout> TextLayout::create(const wstring& src, const sptr<Font>& font) {
+  sptr<Font_svg> f = static_pointer_cast<Font_svg>(font);
+  return sptrOf<TextLayout_svg>(src, f);
+}
+
+/************************************* Graphics2D_svg implementation ***************************/
+
+Font_svg Graphics2D_svg::_default_font("SansSerif", PLAIN, 20.f);
+
+Graphics2D_svg::Graphics2D_svg(ostream& os, float width, float height)
+  : _os(os), _color(BLACK), _font(&_default_font), _sx(1.f), _sy(1.f),
+    _a(1), _b(0), _c(0), _d(1), _e(0), _f(0), _finished(false) {
+  _os << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+      << "<svg xmlns=\"http://www.w3.org/2000/svg\""
+      << " xmlns:xlink=\"http://www.w3.org/1999/xlink\" width=\"";
+  writeNumber(width);
+  _os << "\" height=\"";
+  writeNumber(height);
+  _os << "\" viewBox=\"0 0 ";
+  writeNumber(width);
+  _os << ' ';
+  writeNumber(height);
+  _os << "\">\n";
+}
+
+void Graphics2D_svg::finish() {
+  if (_finished) return;
+  _os << "</svg>\n";
+  _os.flush();
+  _finished = true;
+}
+
+Graphics2D_svg::~Graphics2D_svg() {
+  finish();
+}
+
+void Graphics2D_svg::transform(float a, float b, float c, float d, float e, float f) {
+  const float na = _a * a + _c * b, nb = _b * a + _d * b;
+  const float nc = _a * c + _c * d, nd = _b * c + _d * d;
+  _e += _a * e + _c * f;
+  _f += _b * e + _d * f;
+  _a = na, _b = nb, _c = nc, _d = nd;
+}
+
+void Graphics2D_svg::writeEscaped(const string& str) {
+  for (char c : str) {
+    switch (c) {
+      case '&':
+        _os << "&amp;";
+        break;
+      case '<':
+        _os << "&lt;";
+        break;
+      case '>':
+        _os << "&gt;";
+        break;
+      case '"':
+        _os << "&quot;";
+        break;
+      default:
+        _os << c;
+        break;
+    }
+  }
+}
+
+void Graphics2D_svg::writeNumber(float v) {
+  char buf[32];
+  _os.write(buf, formatNumber(buf, v));
+}
+
+void Graphics2D_svg::writeMatrix(float a, float b, float c, float d, float e, float f) {
+  _os << " transform=\"";
+  if (a == 1 && b == 0 && c == 0 && d == 1) {
+    _os << "translate(";
+    writeNumber(e);
+    _os << ' ';
+    writeNumber(f);
+  } else {
+    _os << "matrix(";
+    for (float v : {a, b, c, d, e}) {
+      writeNumber(v);
+      _os << ' ';
+    }
+    writeNumber(f);
+  }
+  _os << ")\"";
+}
+
+void Graphics2D_svg::writePaint(const char* attr, color c) {
+  char buf[8];
+  snprintf(buf, sizeof(buf), "#%02x%02x%02x", color_r(c), color_g(c), color_b(c));
+  _os << ' ' << attr << "=\"" << buf << '"';
+  const u32 a = color_a(c);
+  if (a != 0xff) {
+    _os << ' ' << attr << "-opacity=\"";
+    writeNumber(a / 255.f);
+    _os << '"';
+  }
+}
+
+void Graphics2D_svg::writeStroke() {
+  _os << " fill=\"none\"";
+  writePaint("stroke", _color);
+  _os << " stroke-width=\"";
+  writeNumber(_stroke.lineWidth);
+  _os << '"';
+  switch (_stroke.cap) {
+    case CAP_ROUND:
+      _os << " stroke-linecap=\"round\"";
+      break;
+    case CAP_SQUARE:
+      _os << " stroke-linecap=\"square\"";
+      break;
+    default:
+      break;
+  }
+  switch (_stroke.join) {
+    case JOIN_BEVEL:
+      _os << " stroke-linejoin=\"bevel\"";
+      break;
+    case JOIN_ROUND:
+      _os << " stroke-linejoin=\"round\"";
+      break;
+    default:
+      break;
+  }
+  if (_stroke.join == JOIN_MITER && _stroke.miterLimit >= 1 && _stroke.miterLimit != 4) {
+    _os << " stroke-miterlimit=\"";
+    writeNumber(_stroke.miterLimit);
+    _os << '"';
+  }
+}
+
+bool Graphics2D_svg::defineGlyph(const GlyphOutlines& outlines, u32 glyph) {
+  const std::uint64_t key = ((std::uint64_t) outlines.id() << 32) | glyph;
+  if (_defined.find(key) != _defined.end()) return true;
+  string d;
+  if (!outlines.pathOf(glyph, d)) return false;
+  _os << "<defs><path id=\"g" << outlines.id() << '_' << glyph << "\" d=\"" << d << "\"/></defs>\n";
+  _defined.insert(key);
+  return true;
+}
+
+void Graphics2D_svg::setColor(color c) {
+  _color = c;
+}
+
+color Graphics2D_svg::getColor() const {
+  return _color;
+}
+
+void Graphics2D_svg::setStroke(const Stroke& s) {
+  _stroke = s;
+}
+
+const Stroke& Graphics2D_svg::getStroke() const {
+  return _stroke;
+}
+
+void Graphics2D_svg::setStrokeWidth(float w) {
+  _stroke.lineWidth = w;
+}
+
+const Font* Graphics2D_svg::getFont() const {
+  return _font;
+}
+
+void Graphics2D_svg::setFont(const Font* font) {
+  _font = static_cast<const Font_svg*>(font);
+}
+
+void Graphics2D_svg::translate(float dx, float dy) {
+  transform(1, 0, 0, 1, dx, dy);
+}
+
+void Graphics2D_svg::scale(float sx, float sy) {
+  _sx *= sx;
+  _sy *= sy;
+  transform(sx, 0, 0, sy, 0, 0);
+}
+
+void Graphics2D_svg::rotate(float angle) {
+  const float c = cos(angle), s = sin(angle);
+  transform(c, s, -s, c, 0, 0);
+}
+
+void Graphics2D_svg::rotate(float angle, float px, float py) {
+  translate(px, py);
+  rotate(angle);
+  translate(-px, -py);
+}
+
+void Graphics2D_svg::reset() {
+  _a = _d = 1;
+  _b = _c = _e = _f = 0;
+  _sx = _sy = 1.f;
+}
+
+float Graphics2D_svg::sx() const {
+  return _sx;
+}
+
+float Graphics2D_svg::sy() const {
+  return _sy;
+}
+
+void Graphics2D_svg::drawChar(wchar_t c, float x, float y) {
+  const Point p(x, y);
+  drawGlyphs(&c, &p, 1);
+}
+
+void Graphics2D_svg::drawText(const wstring& t, float x, float y) {
+  const auto& outlines = _font->getOutlines();
+  if (outlines != nullptr) {
+    // lay the glyphs out along their advances
+    const float k = _font->getSize() / outlines->unitsPerEm();
+    vector<Point> positions;
+    positions.reserve(t.length());
+    for (wchar_t c : t) {
+      positions.emplace_back(x, y);
+      x += outlines->advanceOf(outlines->glyphOf(c)) * k;
+    }
+    drawGlyphs(t.c_str(), positions.data(), (int) t.length());
+    return;
+  }
+  _os << "<text x=\"";
+  writeNumber(x);
+  _os << "\" y=\"";
+  writeNumber(y);
+  _os << "\" font-family=\"";
+  writeEscaped(_font->getFamily());
+  _os << "\" font-size=\"";
+  writeNumber(_font->getSize());
+  _os << '"';
+  if (_font->getStyle() & BOLD) _os << " font-weight=\"bold\"";
+  if (_font->getStyle() & ITALIC) _os << " font-style=\"italic\"";
+  writeMatrix(_a, _b, _c, _d, _e, _f);
+  writePaint("fill", _color);
+  _os << " xml:space=\"preserve\">";
+  writeEscaped(wide2utf8(t));
+  _os << "</text>\n";
+}
+
+void Graphics2D_svg::drawGlyphs(const wchar_t* chars, const Point* positions, int count) {
+  const auto& outlines = _font->getOutlines();
+  if (outlines == nullptr) {
+    Graphics2D::drawGlyphs(chars, positions, count);
+    return;
+  }
+  // define the glyphs used for the first time before the group
+  vector<u32> glyphs(count);
+  for (int i = 0; i < count; i++) {
+    const u32 g = outlines->glyphOf(chars[i]);
+    glyphs[i] = defineGlyph(*outlines, g) ? g : ~0u;
+  }
+  _os << "<g";
+  writePaint("fill", _color);
+  _os << ">\n";
+  const float k = _font->getSize() / outlines->unitsPerEm();
+  for (int i = 0; i < count; i++) {
+    if (glyphs[i] == ~0u) continue;
+    const float x = positions[i].x, y = positions[i].y;
+    _os << "<use xlink:href=\"#g" << outlines->id() << '_' << glyphs[i] << '"';
+    writeMatrix(_a * k, _b * k, _c * k, _d * k, _a * x + _c * y + _e, _b * x + _d * y + _f);
+    _os << "/>\n";
+  }
+  _os << "</g>\n";
+}
+
+void Graphics2D_svg::drawLine(float x1, float y1, float x2, float y2) {
+  _os << "<path d=\"M";
+  writeNumber(x1);
+  _os << ' ';
+  writeNumber(y1);
+  _os << 'L';
+  writeNumber(x2);
+  _os << ' ';
+  writeNumber(y2);
+  _os << '"';
+  writeMatrix(_a, _b, _c, _d, _e, _f);
+  writeStroke();
+  _os << "/>\n";
+}
+
+void Graphics2D_svg::writeRect(float x, float y, float w, float h, float rx, float ry, bool fill) {
+  _os << "<rect x=\"";
+  writeNumber(x);
+  _os << "\" y=\"";
+  writeNumber(y);
+  _os << "\" width=\"";
+  writeNumber(w);
+  _os << "\" height=\"";
+  writeNumber(h);
+  _os << '"';
+  if (rx > 0 || ry > 0) {
+    _os << " rx=\"";
+    writeNumber(rx);
+    _os << "\" ry=\"";
+    writeNumber(ry);
+    _os << '"';
+  }
+  writeMatrix(_a, _b, _c, _d, _e, _f);
+  if (fill) {
+    writePaint("fill", _color);
+  } else {
+    writeStroke();
+  }
+  _os << "/>\n";
+}
+
+void Graphics2D_svg::drawRect(float x, float y, float w, float h) {
+  writeRect(x, y, w, h, 0, 0, false);
+}
+
+void Graphics2D_svg::fillRect(float x, float y, float w, float h) {
+  writeRect(x, y, w, h, 0, 0, true);
+}
+
+void Graphics2D_svg::drawRoundRect(float x, float y, float w, float h, float rx, float ry) {
+  writeRect(x, y, w, h, rx, ry, false);
+}
+
+void Graphics2D_svg::fillRoundRect(float x, float y, float w, float h, float rx, float ry) {
+  writeRect(x, y, w, h, rx, ry, true);
+}
+
+#endif
@@ -0,0 +1,176 @@
+#include "config.h"
+
+#if defined(BUILD_SVG) && !defined(MEM_CHECK)
+
+#ifndef GRAPHIC_SVG_H_INCLUDED
+#define GRAPHIC_SVG_H_INCLUDED
+
+#include "graphic/graphic.h"
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <unordered_set>
+
+namespace tex {
+
+class GlyphOutlines;
+
+class Font_svg : public Font {
+private:
+  int _style;
+  float _size;
+  std::string _family;
+  // the outlines of the font file, nullptr if this font is only a named font
+  sptr<const GlyphOutlines> _outlines;
+
+public:
+  explicit Font_svg(std::string family = "", int style = PLAIN, float size = 1.f);
+
+  Font_svg(const std::string& file, float size);
+
+  const std::string& getFamily() const;
+
+  int getStyle() const;
+
+  const sptr<const GlyphOutlines>& getOutlines() const;
+
+  float getSize() const override;
+
+  sptr<Font> deriveFont(int style) const override;
+
+  bool operator==(const Font& f) const override;
+
+  bool operator!=(const Font& f) const override;
+
+  ~Font_svg() override = default;
+};
+
+/**************************************************************************************************/
+
+/**
+ * Layout of text in a font that has no outlines. The bounds are estimated from
+ * the font size since there is no shaping engine, the text itself is emitted as
+ * a SVG text element and left to the viewer to render.
+ */
+class TextLayout_svg : public TextLayout {
+private:
+  std::wstring _text;
+  sptr<Font_svg> _font;
+
+public:
+  TextLayout_svg(const std::wstring& src, const sptr<Font_svg>& font);
+
+  void getBounds(Rect& r) override;
+
+  void draw(Graphics2D& g2, float x, float y) override;
+};
+
+/**************************************************************************************************/
+
+/**
+ * A graphics context that streams SVG to an output stream, it has no
+ * dependencies other than the standard library. The outlines of the glyphs are
+ * read from the TrueType font files directly, every glyph is emitted once as a
+ * path in a defs element and referenced by use elements after.
+ */
+class Graphics2D_svg : public Graphics2D {
+private:
+  static Font_svg _default_font;
+
+  std::ostream& _os;
+  color _color;
+  Stroke _stroke;
+  const Font_svg* _font;
+  float _sx, _sy;
+  // the current transformation, maps (x, y) to (a x + c y + e, b x + d y + f)
+  float _a, _b, _c, _d, _e, _f;
+  // the glyphs (font id << 32 | glyph index) have been defined
+  std::unordered_set<std::uint64_t> _defined;
+  bool _finished;
+
+  void transform(float a, float b, float c, float d, float e, float f);
+
+  /** Write the given UTF-8 string escaped for a text content or an attribute value */
+  void writeEscaped(const std::string& str);
+
+  void writeNumber(float v);
+
+  void writeMatrix(float a, float b, float c, float d, float e, float f);
+
+  void writePaint(const char* attr, color c);
+
+  void writeStroke();
+
+  void writeRect(float x, float y, float w, float h, float rx, float ry, bool fill);
+
+  /** Define the glyph if it has not been, return false if the glyph has no outline. */
+  bool defineGlyph(const GlyphOutlines& outlines, u32 glyph);
+
+public:
+  /**
+   * Create a graphics context writes a SVG document to the given stream, the
+   * header is written immediately.
+   *
+   * @param os the stream to write to, must outlive this context
+   * @param width the width (in pixel) of the document
+   * @param height the height (in pixel) of the document
+   */
+  Graphics2D_svg(std::ostream& os, float width, float height);
+
+  no_copy_assign(Graphics2D_svg);
+
+  /** Close the document, nothing can be drawn after. */
+  void finish();
+
+  void setColor(color c) override;
+
+  color getColor() const override;
+
+  void setStroke(const Stroke& s) override;
+
+  const Stroke& getStroke() const override;
+
+  void setStrokeWidth(float w) override;
+
+  const Font* getFont() const override;
+
+  void setFont(const Font* font) override;
+
+  void translate(float dx, float dy) override;
+
+  void scale(float sx, float sy) override;
+
+  void rotate(float angle) override;
+
+  void rotate(float angle, float px, float py) override;
+
+  void reset() override;
+
+  float sx() const override;
+
+  float sy() const override;
+
+  void drawChar(wchar_t c, float x, float y) override;
+
+  void drawText(const std::wstring& t, float x, float y) override;
+
+  void drawGlyphs(const wchar_t* chars, const Point* positions, int count) override;
+
+  void drawLine(float x1, float y1, float x2, float y2) override;
+
+  void drawRect(float x, float y, float w, float h) override;
+
+  void fillRect(float x, float y, float w, float h) override;
+
+  void drawRoundRect(float x, float y, float w, float h, float rx, float ry) override;
+
+  void fillRoundRect(float x, float y, float w, float h, float rx, float ry) override;
+
+  ~Graphics2D_svg();
+};
+
+}  // namespace tex
+
+#endif  // GRAPHIC_SVG_H_INCLUDED
+#endif  // BUILD_SVG && !MEM_CHECK
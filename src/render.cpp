@@ -3,6 +3,7 @@
 #include "atom/atom.h"
 #include "core/core.h"
 #include "core/formula.h"
+#include "core/layout_cache.h"
 
 using namespace std;
 using namespace tex;
@@ -12,7 +13,6 @@ float TeXRender::_defaultSize = -1;
 float TeXRender::_magFactor = 0;
 
 TeXRender::TeXRender(const sptr<Box>& box, float textSize, bool trueValues) {
-  _box = box;
   if (_defaultSize != -1) _textSize = _defaultSize;
   if (_magFactor != 0) {
     _textSize = textSize * std::abs(_magFactor);
@@ -20,10 +20,15 @@ TeXRender::TeXRender(const sptr<Box>& box, float textSize, bool trueValues) {
     _textSize = textSize;
   }
   if (!trueValues) _insets += (int) (0.18f * textSize);
+  setBox(box);
+}
+
+void TeXRender::setBox(const sptr<Box>& box) {
+  _box = box;
   if (Box::DEBUG) {
     const auto group = wrap(box);
     _box = group;
-    BoxFilter filter = [](auto b) {
+    BoxFilter filter = [](const sptr<Box>& b) {
       return dynamic_cast<CharBox*>(b.get()) != nullptr;
     };
     buildDebug(nullptr, group, std::move(filter));
@@ -99,10 +104,12 @@ float TeXRender::getBaseline() const {
 
 void TeXRender::setTextSize(float textSize) {
   _textSize = textSize;
+  _displayList = nullptr;
 }
 
 void TeXRender::setForeground(color fg) {
   _fg = fg;
+  _displayList = nullptr;
 }
 
 Insets TeXRender::getInsets() {
@@ -112,6 +119,7 @@ Insets TeXRender::getInsets() {
 void TeXRender::setInsets(const Insets& insets, bool trueval) {
   _insets = insets;
   if (!trueval) _insets += (int) (0.18f * _textSize);
+  _displayList = nullptr;
 }
 
 void TeXRender::setWidth(int width, Alignment align) {
@@ -120,6 +128,7 @@ void TeXRender::setWidth(int width, Alignment align) {
   // only care if new width larger than old
   if (diff > 0) {
     _box = sptrOf<HBox>(_box, (float) width, align);
+    _displayList = nullptr;
   }
 }
 
@@ -129,20 +138,41 @@ void TeXRender::setHeight(int height, Alignment align) {
   // only care if new height larger than old
   if (diff > 0) {
     _box = sptrOf<VBox>(_box, diff, align);
+    _displayList = nullptr;
   }
 }
 
+bool TeXRender::isRelayoutable() const {
+  return _root != nullptr;
+}
+
+void TeXRender::relayout(int width, float lineSpace) {
+  if (_root == nullptr) {
+    throw ex_invalid_state("The atom tree is not retained, cannot relayout!");
+  }
+  // the builder keeps the size the formula was built with, _textSize is
+  // already magnified by _magFactor
+  TeXRenderBuilder& b = *_builder;
+  b.setWidth(UnitType::pixel, width, b._align)
+    .setLineSpace(UnitType::pixel, lineSpace);
+  // lay out with the point-to-pixel conversion the formula was built with
+  PixelsPerPointScope pixelsPerPoint(_pixelsPerPoint);
+  setBox(b.createBox(_root));
+  _displayList = nullptr;
+}
+
 void TeXRender::draw(Graphics2D& g2, int x, int y) {
   color old = g2.getColor();
-  g2.scale(_textSize, _textSize);
-  if (!isTransparent(_fg)) {
-    g2.setColor(_fg);
-  } else {
-    g2.setColor(_defaultcolor);
+  const color fg = isTransparent(_fg) ? _defaultcolor : _fg;
+  if (_displayList == nullptr || !_displayList->isCompatible(g2)) {
+    // record the formula box once, the repaints replay the flat list
+    DisplayListRecorder recorder(fg, g2.getStroke(), g2.getFont(), g2.sx(), g2.sy());
+    recorder.scale(_textSize, _textSize);
+    _box->draw(recorder, _insets.left / _textSize, _insets.top / _textSize + _box->_height);
+    _displayList = recorder.finish();
   }
-
-  // draw formula box
-  _box->draw(g2, (x + _insets.left) / _textSize, (y + _insets.top) / _textSize + _box->_height);
+  g2.setColor(fg);
+  _displayList->draw(g2, x, y);
 
   // restore
   g2.reset();
@@ -171,41 +201,53 @@ TeXRender* TeXRenderBuilder::build(const sptr<Atom>& fc) {
     throw ex_invalid_state("A size is required, call function setSize before build.");
   }
 
+  auto* render = new TeXRender(createBox(f), _textSize, _trueValues);
+  if (!isTransparent(_fg)) render->setForeground(_fg);
+  if (_retainAtoms) {
+    render->_root = f;
+    render->_builder = sptrOf<TeXRenderBuilder>(*this);
+    render->_pixelsPerPoint = Formula::PIXELS_PER_POINT;
+  }
+  return render;
+}
+
+sptr<Box> TeXRenderBuilder::createBox(const sptr<Atom>& f) {
   DefaultTeXFont* font = (
     _type == -1
     ? new DefaultTeXFont(_textSize)
     : createFont(_textSize, _type)
   );
   sptr<TeXFont> tf(font);
-  Environment* env;
+  std::unique_ptr<Environment> env;
   if (_widthUnit != UnitType::none && _textWidth != 0) {
-    env = new Environment(_style, tf, _widthUnit, _textWidth);
+    env.reset(new Environment(_style, tf, _widthUnit, _textWidth));
   } else {
-    env = new Environment(_style, tf);
+    env.reset(new Environment(_style, tf));
   }
 
   if (_lineSpaceUnit != UnitType::none) {
     env->setInterline(_lineSpaceUnit, _lineSpace);
   }
 
-  auto box = f->createBox(*env);
-  TeXRender* render;
+  // the debug mode modifies the boxes in place, they can not be shared
+  LayoutCache cache;
+  sptr<Box> box;
+  {
+    LayoutCacheActivation activation(_memoize && !Box::DEBUG ? &cache : nullptr);
+    ParallelCellsScope parallel(_parallelCells);
+    box = f->createBox(*env);
+  }
   if (_widthUnit != UnitType::none && _textWidth != 0) {
-    HBox* hb;
     if (_lineSpaceUnit != UnitType::none && _lineSpace != 0) {
       float space = _lineSpace * SpaceAtom::getFactor(_lineSpaceUnit, *env);
-      auto split = BoxSplitter::split(box, env->getTextWidth(), space);
-      hb = new HBox(split, _isMaxWidth ? split->_width : env->getTextWidth(), _align);
+      auto split = _optimalBreaking
+                     ? BoxSplitter::splitOptimal(box, env->getTextWidth(), space)
+                     : BoxSplitter::split(box, env->getTextWidth(), space);
+      box = sptrOf<HBox>(split, _isMaxWidth ? split->_width : env->getTextWidth(), _align);
     } else {
-      hb = new HBox(box, _isMaxWidth ? box->_width : env->getTextWidth(), _align);
+      box = sptrOf<HBox>(box, _isMaxWidth ? box->_width : env->getTextWidth(), _align);
     }
-    render = new TeXRender(sptr<Box>(hb), _textSize, _trueValues);
-  } else {
-    render = new TeXRender(box, _textSize, _trueValues);
   }
 
-  if (!isTransparent(_fg)) render->setForeground(_fg);
-
-  delete env;
-  return render;
+  return box;
 }
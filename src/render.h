@@ -5,7 +5,9 @@
 
 #include "utils/enums.h"
 #include "box/box.h"
+#include "core/render_state.h"
 #include "graphic/graphic.h"
+#include "graphic/display_list.h"
 
 namespace tex {
 
@@ -17,16 +19,30 @@ class Box;
 
 class Atom;
 
+class TeXRenderBuilder;
+
 using BoxFilter = std::function<bool(const sptr<Box>&)>;
 
 class TeXRender {
 private:
+  friend class TeXRenderBuilder;
+
   static const color _defaultcolor;
 
   sptr<Box> _box;
   float _textSize;
   color _fg = black;
   Insets _insets;
+  // the flattened drawing operations of the box, compiled on the first draw
+  sptr<DisplayList> _displayList;
+  // the atom tree and the settings it was laid out with, retained to relayout
+  // the formula, nullptr if not retained
+  sptr<Atom> _root;
+  sptr<TeXRenderBuilder> _builder;
+  float _pixelsPerPoint = 0;
+
+  /** Set the box to render, wrap it with the debug boxes if Box::DEBUG is on */
+  void setBox(const sptr<Box>& box);
 
   void buildDebug(
     const sptr<BoxGroup>& parent,
@@ -64,20 +80,42 @@ public:
 
   void setHeight(int height, Alignment align);
 
+  /** Test if this render retains its atom tree, so it can be laid out again */
+  bool isRelayoutable() const;
+
+  /**
+   * Lay the retained atom tree out again with the given width and line space,
+   * without parsing the formula again. The text size, alignment, style and
+   * colors are kept, the insets are kept as well. The render must have been built with
+   * TeXRenderBuilder::setRetainAtoms(true).
+   *
+   * @param width the new width (in pixel) of the 2D graphics context
+   * @param lineSpace the new line space (in pixel)
+   * @throw ex_invalid_state if the atom tree is not retained
+   */
+  void relayout(int width, float lineSpace);
+
   void draw(Graphics2D& g2, int x, int y);
 };
 
 class TeXRenderBuilder {
 private:
+  friend class TeXRender;
+
   TexStyle _style = TexStyle::display;
   int _type = -1;
   UnitType _widthUnit = UnitType::none;
   UnitType _lineSpaceUnit = UnitType::none;
   float _textSize = 0, _textWidth = 0, _lineSpace = 0;
-  bool _trueValues = false, _isMaxWidth = false;
+  bool _trueValues = false, _isMaxWidth = false, _retainAtoms = false, _memoize = false;
+  bool _optimalBreaking = false;
+  ParallelCells _parallelCells;
   color _fg = black;
   Alignment _align = Alignment::none;
 
+  /** Create the box of the given atom, wrapped into a HBox if a width was specified */
+  sptr<Box> createBox(const sptr<Atom>& f);
+
 public:
   // TODO declaration conflict with TypefaceStyle defined in graphic/graphic.h
   enum TeXFontStyle {
@@ -167,6 +205,50 @@ public:
     return *this;
   }
 
+  /**
+   * Set if the built render retains the atom tree, so it can be laid out with
+   * another width by TeXRender::relayout, default is false.
+   */
+  inline TeXRenderBuilder& setRetainAtoms(bool retain) {
+    _retainAtoms = retain;
+    return *this;
+  }
+
+  /**
+   * Set if the atoms that appear several times in the formula are laid out
+   * once and share their box, default is false. It saves time and memory for
+   * the large formulas with many identical parts (e.g. the generated ones),
+   * see LayoutCache.
+   */
+  inline TeXRenderBuilder& setMemoize(bool memoize) {
+    _memoize = memoize;
+    return *this;
+  }
+
+  /**
+   * Set if the lines are broken with the total-fit algorithm of Knuth and
+   * Plass rather than filled one by one, default is false. It is slower, but
+   * the lines of a long formula are more evenly full, see
+   * BoxSplitter::splitOptimal.
+   */
+  inline TeXRenderBuilder& setOptimalBreaking(bool optimal) {
+    _optimalBreaking = optimal;
+    return *this;
+  }
+
+  /**
+   * Set the minimum count of cells of a matrix to lay out its cells in
+   * parallel, default is 1024, 0 to always lay them out on the calling thread.
+   *
+   * @param cells the minimum count of cells
+   * @param threads the count of threads to lay out the cells, 0 means as many
+   * as the hardware supports
+   */
+  inline TeXRenderBuilder& setParallelCells(std::size_t cells, std::size_t threads = 0) {
+    _parallelCells = ParallelCells(cells, threads);
+    return *this;
+  }
+
   TeXRender* build(const sptr<Atom>& f);
 
   TeXRender* build(Formula& f);
@@ -0,0 +1,72 @@
+#ifndef ALPHABET_DEF_RES_H_INCLUDED
+#define ALPHABET_DEF_RES_H_INCLUDED
+
+#include "atom/atom_char.h"
+#include "core/formula.h"
+#include "fonts/font_info.h"
+#include "fonts/fonts.h"
+#include "fonts/symbol_reg.h"
+
+#define __len(x) ((int)(sizeof(x) / sizeof((x)[0])))
+
+/**
+ * Define the symbols and the mappings of an alphabet, they are registered once
+ * the fonts of the alphabet are registered. The definitions are generated from
+ * the XML description of the alphabet by prebuilt/alphabet_def.py.
+ */
+#define DEF_ALPHABET(name) \
+  void __symbols_reg(name)() {
+#define END_DEF_ALPHABET }
+
+/**
+ * Define the symbol mappings of this alphabet.
+ *
+ * There 3 components for each item:
+ *
+ *      [font-name, code, symbol-name]
+ *
+ * The font is given by its name, the ids of the fonts of an alphabet are known
+ * only once it is loaded.
+ */
+#define SYMBOLS_START \
+  {                   \
+    const tex::__symbol_component x[] = {
+#define SYMBOLS_END                                 \
+  }                                                 \
+  ;                                                 \
+  tex::DefaultTeXFont::__push_symbols(x, __len(x)); \
+  }
+
+#define E(font, code, name) \
+  {tex::FontInfo::__id(#font), code, name},
+
+#define ord   tex::AtomType::ordinary
+#define rel   tex::AtomType::relation
+#define acc   tex::AtomType::accent
+#define bin   tex::AtomType::binaryOperator
+#define op    tex::AtomType::bigOperator
+#define open  tex::AtomType::opening
+#define close tex::AtomType::closing
+#define punct tex::AtomType::punctuation
+
+/** Define a symbol with the given type */
+#define sym(type, name) \
+  tex::SymbolAtom::_symbols[name] = tex::sptrOf<tex::SymbolAtom>(name, type, false);
+
+/** Define a delimiter with the given type */
+#define del(type, name) \
+  tex::SymbolAtom::_symbols[name] = tex::sptrOf<tex::SymbolAtom>(name, type, true);
+
+/** Map a character to a symbol */
+#define C(code, symbol) \
+  tex::Formula::_symbolMappings[code] = symbol;
+
+/** Map a character to a formula */
+#define F(code, formula) \
+  tex::Formula::_symbolFormulaMappings[code] = formula;
+
+/** Map a character to a symbol in text mode */
+#define T(code, text) \
+  tex::Formula::_symbolTextMappings[code] = text;
+
+#endif
@@ -0,0 +1,528 @@
+#include "res/font_def.res.h"
+
+DEF_FONT(fcmbpg, greek/fcmbpg.ttf, 205)
+
+xHeight(0.451) quad(1) space(0.319)
+
+ss(fcsbpg) tt(fctrpg) it(fcmbipg)
+
+METRICS_START
+32, 0.319, 0.0, 0, 0,
+168, 0.255, 0.645, 0, 0.061,
+884, 0.224, 0.712, 0, 0,
+885, 0.224, 0.007, 0.216, 0,
+890, 0.128, -0.053, 0.241, 0,
+900, 0.192, 0.712, 0, 0,
+901, 0.319, 0.711, 0, 0.031,
+903, 0.319, 0.445, 0, 0,
+912, 0.287, 0.711, 0.007, 0.028,
+913, 0.869, 0.7, 0, 0,
+914, 0.818, 0.688, 0, 0,
+915, 0.691, 0.681, 0, 0,
+916, 0.958, 0.699, 0, 0,
+917, 0.755, 0.681, 0, 0,
+918, 0.703, 0.687, 0, 0,
+919, 0.9, 0.687, 0, 0,
+920, 0.894, 0.699, 0.011, 0,
+921, 0.436, 0.687, 0, 0,
+922, 0.901, 0.687, 0, 0,
+923, 0.805, 0.7, 0, 0,
+924, 1.091, 0.688, 0, 0,
+925, 0.9, 0.687, 0, 0,
+926, 0.766, 0.676, 0, 0,
+927, 0.864, 0.699, 0.011, 0,
+928, 0.9, 0.681, 0, 0,
+929, 0.786, 0.688, 0, 0,
+931, 0.83, 0.687, 0, 0,
+932, 0.8, 0.676, 0, 0,
+933, 0.894, 0.699, 0, 0,
+934, 0.83, 0.687, 0, 0,
+935, 0.869, 0.687, 0, 0,
+936, 0.894, 0.687, 0, 0,
+937, 0.83, 0.698, 0, 0,
+938, 0.436, 0.893, 0, 0,
+939, 0.894, 0.892, 0, 0,
+940, 0.575, 0.711, 0.006, 0.029,
+941, 0.495, 0.711, 0.01, 0,
+942, 0.575, 0.712, 0.26, 0,
+943, 0.287, 0.711, 0.007, 0,
+944, 0.575, 0.712, 0.006, 0,
+945, 0.575, 0.452, 0.006, 0.029,
+946, 0.575, 0.701, 0.269, 0,
+947, 0.639, 0.452, 0.2, 0,
+948, 0.543, 0.704, 0.006, 0,
+949, 0.495, 0.456, 0.01, 0,
+950, 0.543, 0.707, 0.207, 0,
+951, 0.575, 0.456, 0.26, 0,
+952, 0.519, 0.706, 0.012, 0,
+953, 0.287, 0.452, 0.007, 0,
+954, 0.607, 0.457, 0.011, 0,
+955, 0.575, 0.698, 0.005, 0,
+956, 0.622, 0.457, 0.257, 0,
+957, 0.543, 0.452, 0.005, 0,
+958, 0.543, 0.707, 0.206, 0,
+959, 0.607, 0.452, 0.006, 0,
+960, 0.591, 0.446, 0.021, 0,
+961, 0.543, 0.452, 0.256, 0,
+962, 0.511, 0.451, 0.125, 0,
+963, 0.655, 0.446, 0.006, 0,
+964, 0.527, 0.446, 0.006, 0,
+965, 0.575, 0.468, 0.006, 0,
+966, 0.671, 0.462, 0.268, 0,
+967, 0.639, 0.452, 0.256, 0,
+968, 0.671, 0.711, 0.268, 0,
+969, 0.766, 0.457, 0.006, 0,
+970, 0.287, 0.641, 0.007, 0.054,
+971, 0.575, 0.641, 0.006, 0,
+972, 0.607, 0.711, 0.006, 0,
+973, 0.575, 0.712, 0.006, 0,
+974, 0.766, 0.712, 0.006, 0,
+977, 0.655, 0.701, 0.006, 0,
+984, 0.575, 0.693, 0.003, 0,
+985, 0.575, 0.64, 0.094, 0,
+986, 0.894, 0.677, 0, 0,
+987, 0.575, 0.457, 0.024, 0,
+988, 0.723, 0.681, 0, 0,
+989, 0.575, 0.446, 0.265, 0,
+991, 0.447, 0.618, 0.144, 0,
+992, 0.881, 0.706, 0, 0,
+993, 0.83, 0.696, 0.01, 0,
+7936, 0.575, 0.696, 0.006, 0.029,
+7937, 0.575, 0.696, 0.006, 0.029,
+7938, 0.575, 0.711, 0.006, 0.029,
+7939, 0.575, 0.711, 0.006, 0.029,
+7940, 0.575, 0.711, 0.006, 0.029,
+7941, 0.575, 0.711, 0.006, 0.029,
+7942, 0.575, 0.696, 0.006, 0.029,
+7943, 0.575, 0.696, 0.006, 0.029,
+7952, 0.495, 0.696, 0.01, 0,
+7953, 0.495, 0.696, 0.01, 0,
+7954, 0.495, 0.711, 0.01, 0,
+7955, 0.495, 0.711, 0.01, 0,
+7956, 0.495, 0.711, 0.01, 0,
+7957, 0.495, 0.711, 0.01, 0,
+7968, 0.575, 0.696, 0.26, 0,
+7969, 0.575, 0.696, 0.26, 0,
+7970, 0.575, 0.712, 0.26, 0,
+7971, 0.575, 0.712, 0.26, 0,
+7972, 0.575, 0.712, 0.26, 0,
+7973, 0.575, 0.712, 0.26, 0,
+7974, 0.575, 0.696, 0.26, 0,
+7975, 0.575, 0.696, 0.26, 0,
+7984, 0.287, 0.696, 0.007, 0,
+7985, 0.287, 0.696, 0.007, 0,
+7986, 0.287, 0.711, 0.007, 0,
+7987, 0.287, 0.711, 0.007, 0,
+7988, 0.287, 0.711, 0.007, 0.001,
+7989, 0.287, 0.711, 0.007, 0.001,
+7990, 0.287, 0.696, 0.007, 0.029,
+7991, 0.287, 0.696, 0.007, 0.029,
+8000, 0.607, 0.696, 0.006, 0,
+8001, 0.607, 0.696, 0.006, 0,
+8002, 0.607, 0.711, 0.006, 0,
+8003, 0.607, 0.711, 0.006, 0,
+8004, 0.607, 0.711, 0.006, 0,
+8005, 0.607, 0.711, 0.006, 0,
+8016, 0.575, 0.696, 0.006, 0,
+8017, 0.575, 0.696, 0.006, 0,
+8018, 0.575, 0.712, 0.006, 0,
+8019, 0.575, 0.712, 0.006, 0,
+8020, 0.575, 0.712, 0.006, 0,
+8021, 0.575, 0.712, 0.006, 0,
+8022, 0.575, 0.696, 0.006, 0,
+8023, 0.575, 0.696, 0.006, 0,
+8032, 0.766, 0.696, 0.006, 0,
+8033, 0.766, 0.696, 0.006, 0,
+8034, 0.766, 0.712, 0.006, 0,
+8035, 0.766, 0.712, 0.006, 0,
+8036, 0.766, 0.712, 0.006, 0,
+8037, 0.766, 0.712, 0.006, 0,
+8038, 0.766, 0.696, 0.006, 0,
+8039, 0.766, 0.696, 0.006, 0,
+8048, 0.575, 0.711, 0.006, 0.029,
+8050, 0.495, 0.711, 0.01, 0,
+8052, 0.575, 0.712, 0.26, 0,
+8054, 0.287, 0.711, 0.007, 0,
+8056, 0.607, 0.711, 0.006, 0,
+8058, 0.575, 0.712, 0.006, 0,
+8060, 0.766, 0.712, 0.006, 0,
+8064, 0.575, 0.696, 0.241, 0.029,
+8065, 0.575, 0.696, 0.241, 0.029,
+8066, 0.575, 0.711, 0.241, 0.029,
+8067, 0.575, 0.711, 0.241, 0.029,
+8068, 0.575, 0.711, 0.241, 0.029,
+8069, 0.575, 0.711, 0.241, 0.029,
+8070, 0.575, 0.696, 0.241, 0.029,
+8071, 0.575, 0.696, 0.241, 0.029,
+8080, 0.575, 0.696, 0.26, 0,
+8081, 0.575, 0.696, 0.26, 0,
+8082, 0.575, 0.712, 0.26, 0,
+8083, 0.575, 0.712, 0.26, 0,
+8084, 0.575, 0.712, 0.26, 0,
+8085, 0.575, 0.712, 0.26, 0,
+8086, 0.575, 0.696, 0.26, 0,
+8087, 0.575, 0.696, 0.26, 0,
+8096, 0.766, 0.696, 0.241, 0,
+8097, 0.766, 0.696, 0.241, 0,
+8098, 0.766, 0.712, 0.241, 0,
+8099, 0.766, 0.712, 0.241, 0,
+8100, 0.766, 0.712, 0.241, 0,
+8101, 0.766, 0.712, 0.241, 0,
+8102, 0.766, 0.696, 0.241, 0,
+8103, 0.766, 0.696, 0.241, 0,
+8114, 0.575, 0.711, 0.241, 0.029,
+8115, 0.575, 0.452, 0.241, 0.029,
+8116, 0.575, 0.711, 0.241, 0.029,
+8118, 0.575, 0.641, 0.006, 0.029,
+8119, 0.575, 0.641, 0.241, 0.029,
+8124, 0.869, 0.7, 0.241, 0,
+8126, 0.255, 0.157, 0.155, 0,
+8127, 0.255, 0.696, 0, 0,
+8128, 0.383, 0.641, 0, 0,
+8129, 0.511, 0.696, 0, 0,
+8130, 0.575, 0.712, 0.26, 0,
+8131, 0.575, 0.456, 0.26, 0,
+8132, 0.575, 0.712, 0.26, 0,
+8134, 0.575, 0.641, 0.26, 0,
+8135, 0.575, 0.641, 0.26, 0,
+8140, 0.9, 0.687, 0.241, 0,
+8141, 0.319, 0.711, 0, 0,
+8142, 0.319, 0.711, 0, 0.004,
+8143, 0.383, 0.696, 0, 0,
+8146, 0.287, 0.711, 0.007, 0.028,
+8150, 0.287, 0.641, 0.007, 0.029,
+8151, 0.287, 0.696, 0.007, 0.029,
+8157, 0.319, 0.711, 0, 0,
+8158, 0.319, 0.711, 0, 0.004,
+8159, 0.383, 0.696, 0, 0,
+8162, 0.575, 0.712, 0.006, 0,
+8164, 0.543, 0.696, 0.256, 0,
+8165, 0.543, 0.696, 0.256, 0,
+8166, 0.575, 0.641, 0.006, 0,
+8167, 0.575, 0.696, 0.006, 0,
+8173, 0.319, 0.711, 0, 0.031,
+8175, 0.192, 0.712, 0, 0,
+8178, 0.766, 0.712, 0.241, 0,
+8179, 0.766, 0.457, 0.241, 0,
+8180, 0.766, 0.712, 0.241, 0,
+8182, 0.766, 0.641, 0.006, 0,
+8183, 0.766, 0.641, 0.241, 0,
+8188, 0.83, 0.698, 0.241, 0,
+8190, 0.255, 0.696, 0, 0,
+8217, 0.319, 0.696, 0, 0,
+9001, 0.447, 0.751, 0.251, 0,
+9002, 0.447, 0.751, 0.251, 0
+METRICS_END
+
+KERNS_START
+900, 913, -0.128,
+900, 927, -0.064,
+900, 937, -0.032,
+900, 8124, -0.128,
+900, 8188, -0.032,
+912, 947, -0.032,
+912, 951, -0.019,
+912, 952, -0.019,
+912, 957, -0.064,
+912, 959, -0.032,
+912, 962, -0.032,
+912, 963, -0.032,
+912, 964, -0.032,
+912, 967, -0.032,
+912, 977, -0.019,
+913, 920, -0.096,
+913, 927, -0.096,
+913, 932, -0.096,
+913, 933, -0.16,
+913, 934, -0.096,
+913, 936, -0.141,
+913, 939, -0.16,
+915, 913, -0.153,
+915, 916, -0.128,
+915, 923, -0.141,
+915, 8124, -0.153,
+916, 927, -0.038,
+916, 933, -0.16,
+916, 939, -0.16,
+920, 913, -0.096,
+920, 8124, -0.096,
+922, 927, -0.096,
+923, 927, -0.038,
+923, 933, -0.115,
+923, 939, -0.115,
+925, 913, -0.096,
+925, 8124, -0.096,
+927, 913, -0.096,
+927, 931, -0.064,
+927, 8124, -0.096,
+929, 913, -0.192,
+929, 8124, -0.192,
+931, 913, -0.032,
+931, 8124, -0.032,
+932, 913, -0.096,
+932, 8124, -0.096,
+933, 913, -0.16,
+933, 916, -0.16,
+933, 923, -0.16,
+933, 8124, -0.16,
+934, 913, -0.096,
+934, 8124, -0.096,
+936, 913, -0.141,
+936, 8124, -0.141,
+939, 913, -0.16,
+939, 916, -0.16,
+939, 923, -0.16,
+939, 8124, -0.16,
+943, 947, -0.032,
+943, 951, -0.019,
+943, 952, -0.031,
+943, 957, -0.064,
+943, 959, -0.032,
+943, 962, -0.032,
+943, 963, -0.032,
+943, 964, -0.032,
+943, 967, -0.032,
+943, 977, -0.019,
+953, 947, -0.032,
+953, 951, -0.019,
+953, 952, -0.031,
+953, 957, -0.064,
+953, 959, -0.032,
+953, 962, -0.032,
+953, 963, -0.032,
+953, 964, -0.032,
+953, 967, -0.032,
+953, 977, -0.019,
+959, 947, -0.032,
+959, 955, -0.032,
+959, 957, -0.026,
+959, 964, -0.026,
+959, 967, -0.032,
+964, 940, -0.032,
+964, 945, -0.032,
+964, 959, -0.032,
+964, 969, -0.032,
+964, 972, -0.032,
+964, 974, -0.032,
+964, 7936, -0.032,
+964, 7937, -0.032,
+964, 7940, -0.032,
+964, 7941, -0.032,
+964, 7942, -0.032,
+964, 7943, -0.032,
+964, 8000, -0.032,
+964, 8001, -0.032,
+964, 8004, -0.032,
+964, 8005, -0.032,
+964, 8032, -0.032,
+964, 8033, -0.032,
+964, 8036, -0.032,
+964, 8037, -0.032,
+964, 8038, -0.032,
+964, 8039, -0.032,
+964, 8048, -0.032,
+964, 8056, -0.032,
+964, 8060, -0.032,
+964, 8064, -0.032,
+964, 8065, -0.032,
+964, 8068, -0.032,
+964, 8069, -0.032,
+964, 8070, -0.032,
+964, 8071, -0.032,
+964, 8096, -0.032,
+964, 8097, -0.032,
+964, 8100, -0.032,
+964, 8101, -0.032,
+964, 8102, -0.032,
+964, 8103, -0.032,
+964, 8114, -0.032,
+964, 8116, -0.032,
+964, 8118, -0.032,
+964, 8119, -0.032,
+964, 8178, -0.032,
+964, 8180, -0.032,
+964, 8182, -0.032,
+964, 8183, -0.032,
+970, 947, -0.032,
+970, 951, -0.019,
+970, 952, -0.019,
+970, 957, -0.064,
+970, 959, -0.032,
+970, 962, -0.032,
+970, 963, -0.032,
+970, 964, -0.032,
+970, 967, -0.032,
+970, 977, -0.019,
+972, 947, -0.032,
+972, 955, -0.032,
+972, 957, -0.026,
+972, 964, -0.026,
+972, 967, -0.032,
+7984, 947, -0.032,
+7984, 951, -0.019,
+7984, 952, -0.031,
+7984, 957, -0.064,
+7984, 959, -0.032,
+7984, 962, -0.032,
+7984, 963, -0.032,
+7984, 964, -0.032,
+7984, 967, -0.032,
+7984, 977, -0.019,
+7985, 947, -0.032,
+7985, 951, -0.019,
+7985, 952, -0.031,
+7985, 957, -0.064,
+7985, 959, -0.032,
+7985, 962, -0.032,
+7985, 963, -0.032,
+7985, 964, -0.032,
+7985, 967, -0.032,
+7985, 977, -0.019,
+7988, 947, -0.032,
+7988, 951, -0.019,
+7988, 952, -0.019,
+7988, 957, -0.064,
+7988, 959, -0.032,
+7988, 962, -0.032,
+7988, 963, -0.032,
+7988, 964, -0.032,
+7988, 967, -0.032,
+7988, 977, -0.019,
+7989, 947, -0.032,
+7989, 951, -0.019,
+7989, 952, -0.019,
+7989, 957, -0.064,
+7989, 959, -0.032,
+7989, 962, -0.032,
+7989, 963, -0.032,
+7989, 964, -0.032,
+7989, 967, -0.032,
+7989, 977, -0.019,
+7990, 947, -0.032,
+7990, 951, -0.019,
+7990, 952, -0.019,
+7990, 957, -0.064,
+7990, 959, -0.032,
+7990, 962, -0.032,
+7990, 963, -0.032,
+7990, 964, -0.032,
+7990, 967, -0.032,
+7990, 977, -0.019,
+7991, 947, -0.032,
+7991, 951, -0.019,
+7991, 952, -0.019,
+7991, 957, -0.064,
+7991, 959, -0.032,
+7991, 962, -0.032,
+7991, 963, -0.032,
+7991, 964, -0.032,
+7991, 967, -0.032,
+7991, 977, -0.019,
+8000, 947, -0.032,
+8000, 955, -0.032,
+8000, 957, -0.026,
+8000, 964, -0.026,
+8000, 967, -0.032,
+8001, 947, -0.032,
+8001, 955, -0.032,
+8001, 957, -0.026,
+8001, 964, -0.026,
+8001, 967, -0.032,
+8004, 947, -0.032,
+8004, 955, -0.032,
+8004, 957, -0.026,
+8004, 964, -0.026,
+8004, 967, -0.032,
+8005, 947, -0.032,
+8005, 955, -0.032,
+8005, 957, -0.026,
+8005, 964, -0.026,
+8005, 967, -0.032,
+8054, 947, -0.032,
+8054, 951, -0.019,
+8054, 952, -0.019,
+8054, 957, -0.064,
+8054, 959, -0.032,
+8054, 962, -0.032,
+8054, 963, -0.032,
+8054, 964, -0.032,
+8054, 967, -0.032,
+8054, 977, -0.019,
+8056, 947, -0.032,
+8056, 955, -0.032,
+8056, 957, -0.026,
+8056, 964, -0.026,
+8056, 967, -0.032,
+8124, 920, -0.096,
+8124, 927, -0.096,
+8124, 932, -0.096,
+8124, 933, -0.16,
+8124, 934, -0.096,
+8124, 936, -0.141,
+8124, 939, -0.16,
+8127, 913, -0.16,
+8127, 927, -0.064,
+8127, 937, -0.032,
+8127, 8124, -0.16,
+8127, 8188, -0.032,
+8128, 913, -0.128,
+8128, 8124, -0.128,
+8141, 913, -0.096,
+8141, 927, -0.032,
+8141, 8124, -0.096,
+8142, 913, -0.096,
+8142, 927, -0.032,
+8142, 8124, -0.096,
+8143, 913, -0.128,
+8143, 8124, -0.128,
+8146, 947, -0.032,
+8146, 951, -0.019,
+8146, 952, -0.031,
+8146, 957, -0.064,
+8146, 959, -0.032,
+8146, 962, -0.032,
+8146, 963, -0.032,
+8146, 964, -0.032,
+8146, 967, -0.032,
+8146, 977, -0.019,
+8150, 947, -0.032,
+8150, 951, -0.019,
+8150, 952, -0.019,
+8150, 957, -0.064,
+8150, 959, -0.032,
+8150, 962, -0.032,
+8150, 963, -0.032,
+8150, 964, -0.032,
+8150, 967, -0.032,
+8150, 977, -0.019,
+8151, 947, -0.032,
+8151, 951, -0.019,
+8151, 952, -0.019,
+8151, 957, -0.064,
+8151, 959, -0.032,
+8151, 962, -0.032,
+8151, 963, -0.032,
+8151, 964, -0.032,
+8151, 967, -0.032,
+8151, 977, -0.019,
+8157, 913, -0.096,
+8157, 927, -0.032,
+8157, 8124, -0.096,
+8158, 913, -0.096,
+8158, 927, -0.032,
+8158, 8124, -0.096,
+8159, 913, -0.128,
+8159, 8124, -0.128,
+8175, 913, -0.128,
+8175, 927, -0.064,
+8175, 937, -0.032,
+8175, 8124, -0.128,
+8175, 8188, -0.032,
+8190, 913, -0.192,
+8190, 927, -0.064,
+8190, 937, -0.032,
+8190, 8124, -0.192,
+8190, 8188, -0.032
+KERNS_END
+
+END
@@ -0,0 +1,2024 @@
+#include "res/font_def.res.h"
+
+DEF_FONT(fcmripg, greek/fcmripg.ttf, 204)
+
+xHeight(0.441) quad(1) space(0.307)
+
+roman(fcmrpg) bold(fcmbipg) ss(fcsropg) tt(fctrpg)
+
+METRICS_START
+32, 0.307, 0.0, 0, 0,
+168, 0.222, 0.609, 0, 0.192,
+884, 0.194, 0.702, 0, 0.145,
+885, 0.194, 0.003, 0.216, 0,
+890, 0.111, -0.043, 0.211, 0.009,
+900, 0.167, 0.702, 0, 0.152,
+901, 0.278, 0.702, 0, 0.155,
+903, 0.278, 0.431, 0, 0.017,
+912, 0.25, 0.702, 0.011, 0.13,
+913, 0.75, 0.717, 0, 0,
+914, 0.708, 0.685, 0, 0.058,
+915, 0.625, 0.681, 0, 0.111,
+916, 0.833, 0.718, 0, 0,
+917, 0.68, 0.681, 0, 0.098,
+918, 0.611, 0.685, 0, 0.124,
+919, 0.75, 0.684, 0, 0.148,
+920, 0.778, 0.706, 0.022, 0.049,
+921, 0.361, 0.684, 0, 0.154,
+922, 0.778, 0.684, 0, 0.126,
+923, 0.694, 0.717, 0, 0,
+924, 0.916, 0.684, 0, 0.144,
+925, 0.75, 0.684, 0, 0.148,
+926, 0.667, 0.678, 0, 0.125,
+927, 0.778, 0.706, 0.022, 0.049,
+928, 0.75, 0.681, 0, 0.148,
+929, 0.68, 0.685, 0, 0.083,
+931, 0.722, 0.685, 0, 0.099,
+932, 0.722, 0.678, 0, 0.125,
+933, 0.694, 0.684, 0, 0.172,
+934, 0.722, 0.684, 0, 0.041,
+935, 0.75, 0.684, 0, 0.117,
+936, 0.778, 0.685, 0, 0.089,
+937, 0.722, 0.706, 0, 0.074,
+938, 0.361, 0.834, 0, 0.171,
+939, 0.694, 0.833, 0, 0.172,
+940, 0.555, 0.702, 0.011, 0,
+941, 0.389, 0.702, 0.011, 0.067,
+942, 0.517, 0.702, 0.214, 0.035,
+943, 0.25, 0.702, 0.011, 0.097,
+944, 0.5, 0.729, 0.011, 0.045,
+945, 0.555, 0.443, 0.011, 0,
+946, 0.444, 0.707, 0.212, 0.093,
+947, 0.5, 0.447, 0.217, 0.067,
+948, 0.467, 0.707, 0.01, 0.033,
+949, 0.389, 0.442, 0.011, 0.052,
+950, 0.417, 0.696, 0.156, 0.082,
+951, 0.517, 0.443, 0.214, 0.035,
+952, 0.514, 0.707, 0.011, 0.065,
+953, 0.25, 0.431, 0.011, 0.002,
+954, 0.528, 0.447, 0.011, 0.053,
+955, 0.45, 0.707, 0.011, 0.011,
+956, 0.5, 0.432, 0.222, 0.002,
+957, 0.417, 0.442, 0.02, 0.068,
+958, 0.417, 0.696, 0.155, 0.036,
+959, 0.472, 0.443, 0.011, 0.025,
+960, 0.569, 0.434, 0.011, 0.068,
+961, 0.472, 0.442, 0.212, 0.028,
+962, 0.417, 0.443, 0.13, 0.048,
+963, 0.5, 0.451, 0.011, 0.081,
+964, 0.458, 0.454, 0.011, 0.075,
+965, 0.517, 0.443, 0.011, 0.024,
+966, 0.583, 0.443, 0.223, 0.037,
+967, 0.472, 0.442, 0.223, 0.031,
+968, 0.555, 0.444, 0.226, 0.045,
+969, 0.667, 0.432, 0.011, 0.019,
+970, 0.25, 0.637, 0.011, 0.147,
+971, 0.5, 0.637, 0.011, 0.06,
+972, 0.472, 0.702, 0.011, 0.027,
+973, 0.5, 0.702, 0.011, 0.041,
+974, 0.667, 0.702, 0.011, 0.019,
+984, 0.5, 0.695, 0.001, 0.103,
+985, 0.5, 0.443, 0.217, 0.011,
+986, 0.778, 0.679, 0, 0.125,
+987, 0.5, 0.496, 0.106, 0.086,
+988, 0.653, 0.681, 0, 0.111,
+989, 0.5, 0.695, 0, 0.146,
+991, 0.389, 0.695, 0.211, 0.046,
+992, 0.766, 0.695, 0, 0,
+993, 0.722, 0.706, 0.029, 0,
+7936, 0.555, 0.696, 0.011, 0,
+7937, 0.555, 0.696, 0.011, 0,
+7938, 0.555, 0.702, 0.011, 0,
+7939, 0.555, 0.702, 0.011, 0,
+7940, 0.555, 0.702, 0.011, 0.012,
+7941, 0.555, 0.702, 0.011, 0.012,
+7942, 0.555, 0.723, 0.011, 0.055,
+7943, 0.555, 0.723, 0.011, 0.055,
+7952, 0.389, 0.696, 0.011, 0.052,
+7953, 0.389, 0.696, 0.011, 0.052,
+7954, 0.389, 0.702, 0.011, 0.073,
+7955, 0.389, 0.702, 0.011, 0.073,
+7956, 0.389, 0.702, 0.011, 0.117,
+7957, 0.389, 0.702, 0.011, 0.117,
+7968, 0.517, 0.696, 0.214, 0.035,
+7969, 0.517, 0.696, 0.214, 0.035,
+7970, 0.517, 0.702, 0.214, 0.035,
+7971, 0.517, 0.702, 0.214, 0.035,
+7972, 0.517, 0.702, 0.214, 0.041,
+7973, 0.517, 0.702, 0.214, 0.041,
+7974, 0.517, 0.723, 0.214, 0.085,
+7975, 0.517, 0.723, 0.214, 0.085,
+7984, 0.25, 0.696, 0.011, 0.107,
+7985, 0.25, 0.696, 0.011, 0.065,
+7986, 0.25, 0.702, 0.011, 0.102,
+7987, 0.25, 0.702, 0.011, 0.102,
+7988, 0.25, 0.702, 0.011, 0.148,
+7989, 0.25, 0.702, 0.011, 0.148,
+7990, 0.25, 0.723, 0.011, 0.191,
+7991, 0.25, 0.723, 0.011, 0.191,
+8000, 0.472, 0.696, 0.011, 0.05,
+8001, 0.472, 0.696, 0.011, 0.025,
+8002, 0.472, 0.702, 0.011, 0.031,
+8003, 0.472, 0.702, 0.011, 0.031,
+8004, 0.472, 0.701, 0.011, 0.077,
+8005, 0.472, 0.701, 0.011, 0.077,
+8016, 0.5, 0.696, 0.011, 0.041,
+8017, 0.5, 0.696, 0.011, 0.041,
+8018, 0.5, 0.702, 0.011, 0.041,
+8019, 0.5, 0.702, 0.011, 0.041,
+8020, 0.5, 0.702, 0.011, 0.059,
+8021, 0.5, 0.702, 0.011, 0.059,
+8022, 0.5, 0.723, 0.011, 0.103,
+8023, 0.5, 0.723, 0.011, 0.103,
+8032, 0.667, 0.696, 0.011, 0.019,
+8033, 0.667, 0.696, 0.011, 0.019,
+8034, 0.667, 0.702, 0.011, 0.019,
+8035, 0.667, 0.702, 0.011, 0.019,
+8036, 0.667, 0.702, 0.011, 0.019,
+8037, 0.667, 0.702, 0.011, 0.019,
+8038, 0.667, 0.724, 0.011, 0.05,
+8039, 0.667, 0.724, 0.011, 0.05,
+8048, 0.555, 0.702, 0.011, 0,
+8050, 0.389, 0.702, 0.011, 0.052,
+8052, 0.517, 0.702, 0.214, 0.035,
+8054, 0.25, 0.702, 0.011, 0.007,
+8056, 0.472, 0.702, 0.011, 0.025,
+8058, 0.5, 0.702, 0.011, 0.041,
+8060, 0.667, 0.702, 0.011, 0.019,
+8064, 0.555, 0.696, 0.211, 0,
+8065, 0.555, 0.696, 0.211, 0,
+8066, 0.555, 0.702, 0.211, 0,
+8067, 0.555, 0.702, 0.211, 0,
+8068, 0.555, 0.702, 0.211, 0.012,
+8069, 0.555, 0.702, 0.211, 0.012,
+8070, 0.555, 0.723, 0.211, 0.055,
+8071, 0.555, 0.723, 0.211, 0.055,
+8080, 0.517, 0.696, 0.214, 0.035,
+8081, 0.517, 0.696, 0.214, 0.035,
+8082, 0.517, 0.702, 0.214, 0.035,
+8083, 0.517, 0.702, 0.214, 0.035,
+8084, 0.517, 0.702, 0.214, 0.041,
+8085, 0.517, 0.702, 0.214, 0.041,
+8086, 0.517, 0.723, 0.214, 0.085,
+8087, 0.517, 0.723, 0.214, 0.085,
+8096, 0.667, 0.696, 0.211, 0.019,
+8097, 0.667, 0.696, 0.211, 0.019,
+8098, 0.667, 0.702, 0.211, 0.019,
+8099, 0.667, 0.702, 0.211, 0.019,
+8100, 0.667, 0.702, 0.211, 0.019,
+8101, 0.667, 0.702, 0.211, 0.019,
+8102, 0.667, 0.724, 0.211, 0.05,
+8103, 0.667, 0.724, 0.211, 0.05,
+8114, 0.555, 0.702, 0.211, 0,
+8115, 0.555, 0.443, 0.211, 0,
+8116, 0.555, 0.702, 0.211, 0,
+8118, 0.555, 0.615, 0.011, 0.026,
+8119, 0.555, 0.615, 0.211, 0.026,
+8124, 0.75, 0.717, 0.211, 0,
+8126, 0.222, 0.158, 0.156, 0.012,
+8127, 0.222, 0.696, 0, 0.175,
+8128, 0.333, 0.615, 0, 0.16,
+8129, 0.444, 0.723, 0, 0.134,
+8130, 0.517, 0.702, 0.214, 0.035,
+8131, 0.517, 0.443, 0.214, 0.035,
+8132, 0.517, 0.702, 0.214, 0.035,
+8134, 0.517, 0.616, 0.214, 0.056,
+8135, 0.517, 0.616, 0.214, 0.056,
+8140, 0.75, 0.684, 0.211, 0.148,
+8141, 0.278, 0.702, 0, 0.128,
+8142, 0.278, 0.701, 0, 0.174,
+8143, 0.333, 0.723, 0, 0.189,
+8146, 0.25, 0.702, 0.011, 0.13,
+8150, 0.25, 0.615, 0.011, 0.162,
+8151, 0.25, 0.723, 0.011, 0.191,
+8157, 0.278, 0.702, 0, 0.128,
+8158, 0.278, 0.701, 0, 0.174,
+8159, 0.333, 0.723, 0, 0.189,
+8162, 0.5, 0.729, 0.011, 0.045,
+8164, 0.472, 0.696, 0.212, 0.05,
+8165, 0.472, 0.696, 0.212, 0.028,
+8166, 0.5, 0.616, 0.011, 0.074,
+8167, 0.5, 0.723, 0.011, 0.103,
+8173, 0.278, 0.702, 0, 0.155,
+8175, 0.167, 0.702, 0, 0.116,
+8178, 0.667, 0.702, 0.211, 0.019,
+8179, 0.667, 0.432, 0.211, 0.019,
+8180, 0.667, 0.702, 0.211, 0.019,
+8182, 0.667, 0.615, 0.011, 0.021,
+8183, 0.667, 0.615, 0.211, 0.021,
+8188, 0.722, 0.706, 0.211, 0.074,
+8190, 0.222, 0.696, 0, 0.105,
+8217, 0.278, 0.695, 0, 0.093,
+9001, 0.409, 0.751, 0.249, 0.106,
+9002, 0.409, 0.751, 0.249, 0
+METRICS_END
+
+KERNS_START
+900, 913, -0.111,
+900, 927, -0.056,
+900, 937, -0.028,
+900, 8124, -0.111,
+900, 8188, -0.028,
+912, 947, -0.069,
+912, 951, -0.017,
+912, 952, -0.033,
+912, 954, -0.056,
+912, 957, -0.056,
+912, 959, -0.028,
+912, 962, -0.028,
+912, 963, -0.028,
+912, 964, -0.083,
+912, 967, -0.056,
+912, 972, -0.028,
+912, 993, -0.167,
+912, 8000, -0.028,
+912, 8001, -0.028,
+912, 8004, -0.028,
+912, 8005, -0.028,
+912, 8056, -0.028,
+913, 920, -0.083,
+913, 927, -0.083,
+913, 932, -0.083,
+913, 933, -0.139,
+913, 934, -0.083,
+913, 936, -0.122,
+913, 939, -0.139,
+913, 957, -0.097,
+915, 913, -0.133,
+915, 916, -0.111,
+915, 923, -0.122,
+915, 8124, -0.133,
+916, 927, -0.033,
+916, 933, -0.139,
+916, 939, -0.139,
+920, 913, -0.083,
+920, 933, -0.083,
+920, 939, -0.083,
+920, 8124, -0.083,
+922, 927, -0.083,
+923, 927, -0.033,
+923, 933, -0.1,
+923, 939, -0.1,
+925, 913, -0.083,
+925, 8124, -0.083,
+927, 913, -0.083,
+927, 931, -0.056,
+927, 8124, -0.083,
+929, 913, -0.167,
+929, 8124, -0.167,
+931, 913, -0.028,
+931, 8124, -0.028,
+932, 913, -0.083,
+932, 8124, -0.083,
+933, 913, -0.139,
+933, 916, -0.139,
+933, 923, -0.139,
+933, 8124, -0.139,
+934, 913, -0.083,
+934, 8124, -0.083,
+936, 913, -0.122,
+936, 8124, -0.122,
+939, 913, -0.139,
+939, 916, -0.139,
+939, 923, -0.139,
+939, 8124, -0.139,
+940, 947, -0.083,
+940, 952, -0.083,
+940, 957, -0.083,
+940, 959, -0.028,
+940, 960, -0.044,
+940, 964, -0.083,
+940, 965, -0.083,
+940, 967, -0.083,
+940, 968, -0.028,
+940, 972, -0.028,
+940, 973, -0.083,
+940, 8056, -0.028,
+940, 8058, -0.083,
+941, 940, -0.028,
+941, 945, -0.028,
+941, 948, -0.028,
+941, 963, -0.028,
+941, 965, -0.028,
+941, 967, -0.008,
+941, 973, -0.028,
+941, 993, -0.167,
+941, 8048, -0.028,
+941, 8058, -0.028,
+941, 8114, -0.028,
+941, 8115, -0.028,
+941, 8116, -0.028,
+941, 8118, -0.028,
+941, 8119, -0.028,
+941, 8166, -0.028,
+942, 957, -0.028,
+942, 965, -0.028,
+942, 973, -0.028,
+942, 8058, -0.028,
+942, 8166, -0.028,
+943, 947, -0.069,
+943, 951, -0.017,
+943, 952, -0.033,
+943, 954, -0.056,
+943, 957, -0.056,
+943, 959, -0.028,
+943, 962, -0.028,
+943, 963, -0.028,
+943, 964, -0.083,
+943, 967, -0.056,
+943, 972, -0.028,
+943, 993, -0.167,
+943, 8000, -0.028,
+943, 8001, -0.028,
+943, 8004, -0.028,
+943, 8005, -0.028,
+943, 8056, -0.028,
+944, 952, -0.028,
+944, 956, -0.011,
+944, 957, -0.039,
+944, 967, -0.028,
+944, 968, 0.028,
+944, 993, -0.167,
+945, 947, -0.083,
+945, 952, -0.083,
+945, 957, -0.094,
+945, 959, -0.028,
+945, 960, -0.044,
+945, 964, -0.083,
+945, 965, -0.083,
+945, 967, -0.083,
+945, 968, -0.028,
+945, 972, -0.028,
+945, 973, -0.083,
+945, 993, -0.222,
+945, 8016, -0.083,
+945, 8018, -0.083,
+945, 8020, -0.083,
+945, 8021, -0.083,
+945, 8022, -0.083,
+945, 8023, -0.083,
+945, 8056, -0.028,
+945, 8058, -0.083,
+945, 8166, -0.083,
+946, 941, 0.028,
+946, 943, 0.028,
+946, 949, 0.028,
+946, 953, 0.028,
+946, 959, 0.028,
+946, 964, 0.028,
+946, 966, 0.028,
+946, 967, -0.028,
+946, 968, 0.056,
+946, 972, 0.028,
+946, 993, -0.056,
+946, 8050, 0.028,
+946, 8054, 0.028,
+946, 8056, 0.028,
+946, 8150, 0.028,
+947, 967, 0.017,
+947, 993, -0.167,
+948, 940, -0.028,
+948, 945, -0.028,
+948, 947, -0.083,
+948, 956, -0.044,
+948, 957, -0.039,
+948, 960, -0.028,
+948, 965, -0.028,
+948, 967, -0.017,
+948, 973, -0.028,
+948, 993, -0.167,
+948, 8048, -0.028,
+948, 8058, -0.028,
+948, 8114, -0.028,
+948, 8115, -0.028,
+948, 8116, -0.028,
+948, 8118, -0.028,
+948, 8119, -0.028,
+948, 8166, -0.028,
+949, 940, -0.028,
+949, 945, -0.028,
+949, 948, -0.028,
+949, 963, -0.028,
+949, 965, -0.028,
+949, 967, -0.008,
+949, 973, -0.028,
+949, 993, -0.167,
+949, 8048, -0.028,
+949, 8058, -0.028,
+949, 8114, -0.028,
+949, 8115, -0.028,
+949, 8116, -0.028,
+949, 8118, -0.028,
+949, 8119, -0.028,
+949, 8166, -0.028,
+950, 940, -0.083,
+950, 941, -0.083,
+950, 942, -0.083,
+950, 945, -0.083,
+950, 947, -0.111,
+950, 948, -0.056,
+950, 949, -0.083,
+950, 951, -0.083,
+950, 952, -0.056,
+950, 956, -0.056,
+950, 957, -0.089,
+950, 959, -0.083,
+950, 960, -0.083,
+950, 963, -0.083,
+950, 964, -0.083,
+950, 965, -0.083,
+950, 966, -0.083,
+950, 967, -0.083,
+950, 968, -0.028,
+950, 969, -0.083,
+950, 972, -0.083,
+950, 973, -0.083,
+950, 974, -0.083,
+950, 993, -0.056,
+950, 8048, -0.083,
+950, 8050, -0.083,
+950, 8052, -0.083,
+950, 8056, -0.083,
+950, 8058, -0.083,
+950, 8060, -0.083,
+950, 8114, -0.083,
+950, 8115, -0.083,
+950, 8116, -0.083,
+950, 8118, -0.083,
+950, 8119, -0.083,
+950, 8130, -0.083,
+950, 8131, -0.083,
+950, 8132, -0.083,
+950, 8134, -0.083,
+950, 8135, -0.083,
+950, 8166, -0.083,
+950, 8178, -0.083,
+950, 8179, -0.083,
+950, 8180, -0.083,
+950, 8182, -0.083,
+950, 8183, -0.083,
+951, 957, -0.028,
+951, 965, -0.028,
+951, 973, -0.028,
+951, 993, -0.167,
+951, 8058, -0.028,
+951, 8166, -0.028,
+952, 941, 0.028,
+952, 943, 0.028,
+952, 949, 0.028,
+952, 953, 0.028,
+952, 968, 0.028,
+952, 993, -0.056,
+952, 8050, 0.028,
+952, 8054, 0.028,
+952, 8150, 0.028,
+953, 947, -0.069,
+953, 951, -0.017,
+953, 952, -0.033,
+953, 954, -0.056,
+953, 957, -0.056,
+953, 959, -0.028,
+953, 962, -0.028,
+953, 963, -0.028,
+953, 964, -0.083,
+953, 967, -0.056,
+953, 972, -0.028,
+953, 993, -0.167,
+953, 8000, -0.028,
+953, 8001, -0.028,
+953, 8004, -0.028,
+953, 8005, -0.028,
+953, 8056, -0.028,
+954, 946, 0.028,
+954, 957, -0.028,
+954, 993, -0.167,
+955, 940, -0.014,
+955, 945, -0.014,
+955, 947, -0.139,
+955, 952, -0.044,
+955, 956, 0.014,
+955, 957, -0.083,
+955, 963, -0.028,
+955, 964, -0.028,
+955, 965, -0.056,
+955, 967, -0.056,
+955, 973, -0.056,
+955, 993, -0.167,
+955, 8048, -0.014,
+955, 8058, -0.056,
+955, 8114, -0.014,
+955, 8115, -0.014,
+955, 8116, -0.014,
+955, 8118, -0.014,
+955, 8119, -0.014,
+955, 8166, -0.056,
+956, 940, -0.056,
+956, 945, -0.056,
+956, 947, -0.083,
+956, 950, -0.028,
+956, 952, -0.061,
+956, 957, -0.083,
+956, 959, -0.028,
+956, 960, -0.028,
+956, 963, -0.028,
+956, 965, -0.056,
+956, 966, -0.028,
+956, 967, -0.058,
+956, 969, -0.028,
+956, 972, -0.028,
+956, 973, -0.056,
+956, 974, -0.028,
+956, 993, -0.222,
+956, 8048, -0.056,
+956, 8056, -0.028,
+956, 8058, -0.056,
+956, 8060, -0.028,
+956, 8114, -0.056,
+956, 8115, -0.056,
+956, 8116, -0.056,
+956, 8118, -0.056,
+956, 8119, -0.056,
+956, 8166, -0.056,
+956, 8178, -0.028,
+956, 8179, -0.028,
+956, 8180, -0.028,
+956, 8182, -0.028,
+956, 8183, -0.028,
+957, 940, -0.022,
+957, 945, -0.022,
+957, 955, -0.044,
+957, 957, -0.028,
+957, 959, -0.028,
+957, 961, -0.006,
+957, 969, 0.008,
+957, 972, -0.028,
+957, 974, 0.008,
+957, 993, -0.167,
+957, 8048, -0.022,
+957, 8056, -0.028,
+957, 8060, 0.008,
+957, 8114, -0.022,
+957, 8115, -0.022,
+957, 8116, -0.022,
+957, 8118, -0.022,
+957, 8119, -0.022,
+957, 8178, 0.008,
+957, 8179, 0.008,
+957, 8180, 0.008,
+957, 8182, 0.008,
+957, 8183, 0.008,
+958, 940, -0.028,
+958, 941, -0.056,
+958, 945, -0.028,
+958, 947, -0.039,
+958, 949, -0.056,
+958, 959, -0.056,
+958, 963, -0.056,
+958, 964, -0.028,
+958, 965, -0.028,
+958, 966, -0.039,
+958, 967, -0.028,
+958, 972, -0.056,
+958, 973, -0.028,
+958, 993, -0.056,
+958, 8048, -0.028,
+958, 8050, -0.056,
+958, 8056, -0.056,
+958, 8058, -0.028,
+958, 8114, -0.028,
+958, 8115, -0.028,
+958, 8116, -0.028,
+958, 8118, -0.028,
+958, 8119, -0.028,
+958, 8166, -0.028,
+959, 947, -0.028,
+959, 955, -0.028,
+959, 956, -0.011,
+959, 957, -0.039,
+959, 964, -0.033,
+959, 965, -0.056,
+959, 967, -0.028,
+959, 973, -0.056,
+959, 993, -0.167,
+959, 8058, -0.056,
+959, 8166, -0.056,
+960, 943, 0.028,
+960, 953, 0.028,
+960, 954, 0.028,
+960, 959, -0.056,
+960, 968, 0.028,
+960, 972, -0.056,
+960, 993, -0.167,
+960, 8054, 0.028,
+960, 8056, -0.056,
+960, 8150, 0.028,
+961, 943, 0.028,
+961, 947, -0.056,
+961, 950, 0.028,
+961, 953, 0.028,
+961, 957, -0.05,
+961, 959, 0.028,
+961, 963, 0.028,
+961, 967, -0.011,
+961, 968, 0.017,
+961, 972, 0.028,
+961, 993, -0.167,
+961, 8054, 0.028,
+961, 8056, 0.028,
+961, 8150, 0.028,
+963, 940, -0.044,
+963, 945, -0.044,
+963, 959, -0.028,
+963, 961, -0.028,
+963, 969, -0.028,
+963, 972, -0.028,
+963, 974, -0.028,
+963, 993, -0.167,
+963, 8048, -0.044,
+963, 8056, -0.028,
+963, 8060, -0.028,
+963, 8114, -0.044,
+963, 8115, -0.044,
+963, 8116, -0.044,
+963, 8118, -0.044,
+963, 8119, -0.044,
+963, 8164, -0.028,
+963, 8165, -0.028,
+963, 8178, -0.028,
+963, 8179, -0.028,
+963, 8180, -0.028,
+963, 8182, -0.028,
+963, 8183, -0.028,
+964, 940, -0.028,
+964, 941, -0.028,
+964, 945, -0.028,
+964, 949, -0.028,
+964, 959, -0.028,
+964, 967, -0.028,
+964, 969, -0.028,
+964, 972, -0.028,
+964, 974, -0.028,
+964, 993, -0.167,
+964, 8048, -0.028,
+964, 8050, -0.028,
+964, 8056, -0.028,
+964, 8060, -0.028,
+964, 8114, -0.028,
+964, 8115, -0.028,
+964, 8116, -0.028,
+964, 8118, -0.028,
+964, 8119, -0.028,
+964, 8178, -0.028,
+964, 8179, -0.028,
+964, 8180, -0.028,
+964, 8182, -0.028,
+964, 8183, -0.028,
+965, 952, -0.028,
+965, 956, -0.011,
+965, 957, -0.039,
+965, 967, -0.028,
+965, 968, 0.028,
+965, 993, -0.167,
+966, 942, -0.028,
+966, 947, -0.056,
+966, 951, -0.028,
+966, 956, -0.039,
+966, 957, -0.039,
+966, 964, -0.028,
+966, 965, -0.056,
+966, 967, -0.011,
+966, 973, -0.056,
+966, 993, -0.167,
+966, 8052, -0.028,
+966, 8058, -0.056,
+966, 8130, -0.028,
+966, 8131, -0.028,
+966, 8132, -0.028,
+966, 8134, -0.056,
+966, 8135, -0.056,
+966, 8166, -0.056,
+967, 940, -0.067,
+967, 941, -0.028,
+967, 942, -0.058,
+967, 943, -0.028,
+967, 945, -0.067,
+967, 947, -0.044,
+967, 948, -0.067,
+967, 949, -0.028,
+967, 951, -0.058,
+967, 952, -0.056,
+967, 953, -0.028,
+967, 954, -0.056,
+967, 955, -0.067,
+967, 957, -0.083,
+967, 958, -0.044,
+967, 959, -0.083,
+967, 960, -0.044,
+967, 961, -0.044,
+967, 963, -0.039,
+967, 964, -0.044,
+967, 965, -0.044,
+967, 966, -0.083,
+967, 968, -0.028,
+967, 969, -0.067,
+967, 972, -0.083,
+967, 973, -0.044,
+967, 974, -0.067,
+967, 993, -0.167,
+967, 8048, -0.067,
+967, 8050, -0.028,
+967, 8052, -0.058,
+967, 8054, -0.028,
+967, 8056, -0.083,
+967, 8058, -0.044,
+967, 8060, -0.067,
+967, 8114, -0.067,
+967, 8115, -0.067,
+967, 8116, -0.067,
+967, 8118, -0.067,
+967, 8119, -0.067,
+967, 8130, -0.058,
+967, 8131, -0.058,
+967, 8132, -0.058,
+967, 8134, -0.058,
+967, 8135, -0.058,
+967, 8150, -0.028,
+967, 8166, -0.044,
+967, 8178, -0.067,
+967, 8179, -0.067,
+967, 8180, -0.067,
+967, 8182, -0.067,
+967, 8183, -0.067,
+968, 947, -0.039,
+968, 965, -0.056,
+968, 967, -0.006,
+968, 973, -0.056,
+968, 993, -0.167,
+968, 8058, -0.056,
+968, 8166, -0.056,
+969, 941, 0.028,
+969, 947, -0.111,
+969, 949, 0.028,
+969, 956, -0.028,
+969, 957, -0.028,
+969, 958, 0.028,
+969, 964, -0.047,
+969, 965, -0.028,
+969, 967, -0.028,
+969, 973, -0.028,
+969, 993, -0.167,
+969, 8050, 0.028,
+969, 8058, -0.028,
+969, 8166, -0.028,
+970, 947, -0.069,
+970, 951, -0.017,
+970, 952, -0.033,
+970, 954, -0.056,
+970, 957, -0.056,
+970, 959, -0.028,
+970, 962, -0.028,
+970, 963, -0.028,
+970, 964, -0.083,
+970, 967, -0.056,
+970, 972, -0.028,
+970, 993, -0.167,
+970, 8000, -0.028,
+970, 8001, -0.028,
+970, 8004, -0.028,
+970, 8005, -0.028,
+970, 8056, -0.028,
+971, 952, -0.028,
+971, 956, -0.011,
+971, 957, -0.039,
+971, 967, -0.028,
+971, 968, 0.028,
+971, 993, -0.167,
+972, 947, -0.028,
+972, 955, -0.028,
+972, 956, -0.011,
+972, 957, -0.039,
+972, 964, -0.033,
+972, 965, -0.056,
+972, 967, -0.028,
+972, 973, -0.056,
+972, 993, -0.167,
+972, 8058, -0.056,
+972, 8166, -0.056,
+973, 952, -0.028,
+973, 956, -0.011,
+973, 957, -0.039,
+973, 967, -0.028,
+973, 968, 0.028,
+973, 993, -0.167,
+974, 941, 0.028,
+974, 947, -0.111,
+974, 949, 0.028,
+974, 956, -0.028,
+974, 957, -0.028,
+974, 958, 0.028,
+974, 964, -0.047,
+974, 965, -0.028,
+974, 967, -0.028,
+974, 973, -0.028,
+974, 8050, 0.028,
+974, 8058, -0.028,
+974, 8166, -0.028,
+985, 993, -0.222,
+987, 993, -0.167,
+991, 993, -0.167,
+993, 993, -0.167,
+7936, 947, -0.083,
+7936, 952, -0.083,
+7936, 957, -0.083,
+7936, 959, -0.028,
+7936, 960, -0.044,
+7936, 964, -0.083,
+7936, 965, -0.083,
+7936, 967, -0.083,
+7936, 968, -0.028,
+7936, 972, -0.028,
+7936, 973, -0.083,
+7936, 8056, -0.028,
+7936, 8058, -0.083,
+7937, 947, -0.083,
+7937, 952, -0.083,
+7937, 957, -0.083,
+7937, 959, -0.028,
+7937, 960, -0.044,
+7937, 964, -0.083,
+7937, 965, -0.083,
+7937, 967, -0.083,
+7937, 968, -0.028,
+7937, 972, -0.028,
+7937, 973, -0.083,
+7937, 8056, -0.028,
+7937, 8058, -0.083,
+7938, 947, -0.083,
+7938, 952, -0.083,
+7938, 957, -0.083,
+7938, 959, -0.028,
+7938, 960, -0.044,
+7938, 964, -0.083,
+7938, 965, -0.083,
+7938, 967, -0.083,
+7938, 968, -0.028,
+7938, 972, -0.028,
+7938, 973, -0.083,
+7938, 8056, -0.028,
+7938, 8058, -0.083,
+7939, 947, -0.083,
+7939, 952, -0.083,
+7939, 957, -0.083,
+7939, 959, -0.028,
+7939, 960, -0.044,
+7939, 964, -0.083,
+7939, 965, -0.083,
+7939, 967, -0.083,
+7939, 968, -0.028,
+7939, 972, -0.028,
+7939, 973, -0.083,
+7939, 8056, -0.028,
+7939, 8058, -0.083,
+7940, 947, -0.083,
+7940, 952, -0.083,
+7940, 957, -0.083,
+7940, 959, -0.028,
+7940, 960, -0.044,
+7940, 964, -0.083,
+7940, 965, -0.083,
+7940, 967, -0.083,
+7940, 968, -0.028,
+7940, 972, -0.028,
+7940, 973, -0.083,
+7940, 8056, -0.028,
+7940, 8058, -0.083,
+7941, 947, -0.083,
+7941, 952, -0.083,
+7941, 957, -0.044,
+7941, 959, -0.028,
+7941, 960, -0.044,
+7941, 964, -0.083,
+7941, 965, -0.083,
+7941, 967, -0.083,
+7941, 968, -0.028,
+7941, 972, -0.028,
+7941, 973, -0.083,
+7941, 8056, -0.028,
+7941, 8058, -0.083,
+7942, 947, -0.083,
+7942, 952, -0.083,
+7942, 957, -0.083,
+7942, 959, -0.028,
+7942, 960, -0.044,
+7942, 964, -0.083,
+7942, 965, -0.083,
+7942, 967, -0.083,
+7942, 968, -0.028,
+7942, 972, -0.028,
+7942, 973, -0.083,
+7942, 8056, -0.028,
+7942, 8058, -0.083,
+7943, 947, -0.083,
+7943, 952, -0.083,
+7943, 957, -0.083,
+7943, 959, -0.028,
+7943, 960, -0.044,
+7943, 964, -0.083,
+7943, 965, -0.083,
+7943, 967, -0.083,
+7943, 968, -0.028,
+7943, 972, -0.028,
+7943, 973, -0.083,
+7943, 8056, -0.028,
+7943, 8058, -0.083,
+7952, 940, -0.028,
+7952, 945, -0.028,
+7952, 948, -0.028,
+7952, 963, -0.028,
+7952, 965, -0.028,
+7952, 967, -0.008,
+7952, 973, -0.028,
+7952, 993, -0.167,
+7952, 8048, -0.028,
+7952, 8058, -0.028,
+7952, 8114, -0.028,
+7952, 8115, -0.028,
+7952, 8116, -0.028,
+7952, 8118, -0.028,
+7952, 8119, -0.028,
+7952, 8166, -0.028,
+7953, 940, -0.028,
+7953, 945, -0.028,
+7953, 948, -0.028,
+7953, 963, -0.028,
+7953, 965, -0.028,
+7953, 967, -0.008,
+7953, 973, -0.028,
+7953, 993, -0.167,
+7953, 8048, -0.028,
+7953, 8058, -0.028,
+7953, 8114, -0.028,
+7953, 8115, -0.028,
+7953, 8116, -0.028,
+7953, 8118, -0.028,
+7953, 8119, -0.028,
+7953, 8166, -0.028,
+7954, 940, -0.028,
+7954, 945, -0.028,
+7954, 948, -0.028,
+7954, 963, -0.028,
+7954, 965, -0.028,
+7954, 967, -0.008,
+7954, 973, -0.028,
+7954, 993, -0.167,
+7954, 8048, -0.028,
+7954, 8058, -0.028,
+7954, 8114, -0.028,
+7954, 8115, -0.028,
+7954, 8116, -0.028,
+7954, 8118, -0.028,
+7954, 8119, -0.028,
+7954, 8166, -0.028,
+7955, 940, -0.028,
+7955, 945, -0.028,
+7955, 948, -0.028,
+7955, 963, -0.028,
+7955, 965, -0.028,
+7955, 967, -0.008,
+7955, 973, -0.028,
+7955, 993, -0.167,
+7955, 8048, -0.028,
+7955, 8058, -0.028,
+7955, 8114, -0.028,
+7955, 8115, -0.028,
+7955, 8116, -0.028,
+7955, 8118, -0.028,
+7955, 8119, -0.028,
+7955, 8166, -0.028,
+7956, 940, -0.028,
+7956, 945, -0.028,
+7956, 948, -0.028,
+7956, 963, -0.028,
+7956, 965, -0.028,
+7956, 967, -0.008,
+7956, 973, -0.028,
+7956, 993, -0.167,
+7956, 8048, -0.028,
+7956, 8058, -0.028,
+7956, 8114, -0.028,
+7956, 8115, -0.028,
+7956, 8116, -0.028,
+7956, 8118, -0.028,
+7956, 8119, -0.028,
+7956, 8166, -0.028,
+7957, 940, -0.028,
+7957, 945, -0.028,
+7957, 948, -0.028,
+7957, 963, -0.028,
+7957, 965, -0.028,
+7957, 967, -0.008,
+7957, 973, -0.028,
+7957, 993, -0.167,
+7957, 8048, -0.028,
+7957, 8058, -0.028,
+7957, 8114, -0.028,
+7957, 8115, -0.028,
+7957, 8116, -0.028,
+7957, 8118, -0.028,
+7957, 8119, -0.028,
+7957, 8166, -0.028,
+7968, 957, -0.028,
+7968, 965, -0.028,
+7968, 973, -0.028,
+7968, 8058, -0.028,
+7968, 8166, -0.028,
+7969, 957, -0.028,
+7969, 965, -0.028,
+7969, 973, -0.028,
+7969, 8058, -0.028,
+7969, 8166, -0.028,
+7970, 957, -0.028,
+7970, 965, -0.028,
+7970, 973, -0.028,
+7970, 8058, -0.028,
+7970, 8166, -0.028,
+7971, 957, -0.028,
+7971, 965, -0.028,
+7971, 973, -0.028,
+7971, 8058, -0.028,
+7971, 8166, -0.028,
+7972, 957, -0.028,
+7972, 965, -0.028,
+7972, 973, -0.028,
+7972, 8058, -0.028,
+7972, 8166, -0.028,
+7973, 957, -0.028,
+7973, 965, -0.028,
+7973, 973, -0.028,
+7973, 8058, -0.028,
+7973, 8166, -0.028,
+7974, 957, -0.028,
+7974, 965, -0.028,
+7974, 973, -0.028,
+7974, 8058, -0.028,
+7974, 8166, -0.028,
+7975, 957, -0.028,
+7975, 965, -0.028,
+7975, 973, -0.028,
+7975, 8058, -0.028,
+7975, 8166, -0.028,
+7984, 947, -0.069,
+7984, 951, -0.017,
+7984, 952, -0.033,
+7984, 954, -0.056,
+7984, 957, -0.056,
+7984, 959, -0.028,
+7984, 962, -0.028,
+7984, 963, -0.028,
+7984, 964, -0.083,
+7984, 967, -0.056,
+7984, 972, -0.028,
+7984, 993, -0.167,
+7984, 8000, -0.028,
+7984, 8001, -0.028,
+7984, 8004, -0.028,
+7984, 8005, -0.028,
+7984, 8056, -0.028,
+7985, 947, -0.069,
+7985, 951, -0.017,
+7985, 952, -0.033,
+7985, 954, -0.056,
+7985, 957, -0.056,
+7985, 959, -0.028,
+7985, 962, -0.028,
+7985, 963, -0.028,
+7985, 964, -0.083,
+7985, 967, -0.056,
+7985, 972, -0.028,
+7985, 993, -0.167,
+7985, 8000, -0.028,
+7985, 8001, -0.028,
+7985, 8004, -0.028,
+7985, 8005, -0.028,
+7985, 8056, -0.028,
+7988, 947, -0.069,
+7988, 951, -0.017,
+7988, 952, -0.033,
+7988, 954, -0.056,
+7988, 957, -0.056,
+7988, 959, -0.028,
+7988, 962, -0.028,
+7988, 963, -0.028,
+7988, 964, -0.083,
+7988, 967, -0.056,
+7988, 972, -0.028,
+7988, 993, -0.167,
+7988, 8000, -0.028,
+7988, 8001, -0.028,
+7988, 8004, -0.028,
+7988, 8005, -0.028,
+7988, 8056, -0.028,
+7989, 947, -0.069,
+7989, 951, -0.017,
+7989, 952, -0.033,
+7989, 954, -0.056,
+7989, 957, -0.056,
+7989, 959, -0.028,
+7989, 962, -0.028,
+7989, 963, -0.028,
+7989, 964, -0.083,
+7989, 967, -0.056,
+7989, 972, -0.028,
+7989, 993, -0.167,
+7989, 8000, -0.028,
+7989, 8001, -0.028,
+7989, 8004, -0.028,
+7989, 8005, -0.028,
+7989, 8056, -0.028,
+7990, 947, -0.069,
+7990, 951, -0.017,
+7990, 952, -0.033,
+7990, 954, -0.056,
+7990, 957, -0.056,
+7990, 959, -0.028,
+7990, 962, -0.028,
+7990, 963, -0.028,
+7990, 964, -0.083,
+7990, 967, -0.056,
+7990, 972, -0.028,
+7990, 993, -0.167,
+7990, 8000, -0.028,
+7990, 8001, -0.028,
+7990, 8004, -0.028,
+7990, 8005, -0.028,
+7990, 8056, -0.028,
+7991, 947, -0.069,
+7991, 951, -0.017,
+7991, 952, -0.033,
+7991, 954, -0.056,
+7991, 957, -0.056,
+7991, 959, -0.028,
+7991, 962, -0.028,
+7991, 963, -0.028,
+7991, 964, -0.083,
+7991, 967, -0.056,
+7991, 972, -0.028,
+7991, 993, -0.167,
+7991, 8000, -0.028,
+7991, 8001, -0.028,
+7991, 8004, -0.028,
+7991, 8005, -0.028,
+7991, 8056, -0.028,
+8000, 947, -0.028,
+8000, 955, -0.028,
+8000, 956, -0.011,
+8000, 957, -0.039,
+8000, 964, -0.033,
+8000, 965, -0.056,
+8000, 967, -0.028,
+8000, 973, -0.056,
+8000, 993, -0.167,
+8000, 8058, -0.056,
+8000, 8166, -0.056,
+8001, 947, -0.028,
+8001, 955, -0.028,
+8001, 956, -0.011,
+8001, 957, -0.039,
+8001, 964, -0.033,
+8001, 965, -0.056,
+8001, 967, -0.028,
+8001, 973, -0.056,
+8001, 993, -0.167,
+8001, 8058, -0.056,
+8001, 8166, -0.056,
+8002, 947, -0.028,
+8002, 955, -0.028,
+8002, 956, -0.011,
+8002, 957, -0.039,
+8002, 964, -0.033,
+8002, 965, -0.056,
+8002, 967, -0.028,
+8002, 973, -0.056,
+8002, 993, -0.167,
+8002, 8058, -0.056,
+8002, 8166, -0.056,
+8003, 947, -0.028,
+8003, 955, -0.028,
+8003, 956, -0.011,
+8003, 957, -0.039,
+8003, 964, -0.033,
+8003, 965, -0.056,
+8003, 967, -0.028,
+8003, 973, -0.056,
+8003, 993, -0.167,
+8003, 8058, -0.056,
+8003, 8166, -0.056,
+8004, 947, -0.028,
+8004, 955, -0.028,
+8004, 956, -0.011,
+8004, 957, -0.039,
+8004, 964, -0.033,
+8004, 965, -0.056,
+8004, 967, -0.028,
+8004, 973, -0.056,
+8004, 993, -0.167,
+8004, 8058, -0.056,
+8004, 8166, -0.056,
+8005, 947, -0.028,
+8005, 955, -0.028,
+8005, 956, -0.011,
+8005, 957, -0.039,
+8005, 964, -0.033,
+8005, 965, -0.056,
+8005, 967, -0.028,
+8005, 973, -0.056,
+8005, 993, -0.167,
+8005, 8058, -0.056,
+8005, 8166, -0.056,
+8016, 952, -0.028,
+8016, 956, -0.011,
+8016, 957, -0.039,
+8016, 967, -0.028,
+8016, 968, 0.028,
+8016, 993, -0.167,
+8017, 952, -0.028,
+8017, 956, -0.011,
+8017, 957, -0.039,
+8017, 967, -0.028,
+8017, 968, 0.028,
+8017, 993, -0.167,
+8018, 952, -0.028,
+8018, 956, -0.011,
+8018, 957, -0.039,
+8018, 967, -0.028,
+8018, 968, 0.028,
+8018, 993, -0.167,
+8019, 952, -0.028,
+8019, 956, -0.011,
+8019, 957, -0.039,
+8019, 967, -0.028,
+8019, 968, 0.028,
+8019, 993, -0.167,
+8020, 952, -0.028,
+8020, 956, -0.011,
+8020, 957, -0.039,
+8020, 967, -0.028,
+8020, 968, 0.028,
+8020, 993, -0.167,
+8021, 952, -0.028,
+8021, 956, -0.011,
+8021, 957, -0.039,
+8021, 967, -0.028,
+8021, 968, 0.028,
+8021, 993, -0.167,
+8022, 952, -0.028,
+8022, 956, -0.011,
+8022, 957, -0.039,
+8022, 967, -0.028,
+8022, 968, 0.028,
+8022, 993, -0.167,
+8023, 952, -0.028,
+8023, 956, -0.011,
+8023, 957, -0.039,
+8023, 967, -0.028,
+8023, 968, 0.028,
+8023, 993, -0.167,
+8032, 941, 0.028,
+8032, 947, -0.111,
+8032, 949, 0.028,
+8032, 956, -0.028,
+8032, 957, -0.028,
+8032, 958, 0.028,
+8032, 964, -0.047,
+8032, 965, -0.028,
+8032, 967, -0.028,
+8032, 973, -0.028,
+8032, 8050, 0.028,
+8032, 8058, -0.028,
+8032, 8166, -0.028,
+8033, 941, 0.028,
+8033, 947, -0.111,
+8033, 949, 0.028,
+8033, 956, -0.028,
+8033, 957, -0.028,
+8033, 958, 0.028,
+8033, 964, -0.047,
+8033, 965, -0.028,
+8033, 967, -0.028,
+8033, 973, -0.028,
+8033, 8050, 0.028,
+8033, 8058, -0.028,
+8033, 8166, -0.028,
+8034, 941, 0.028,
+8034, 947, -0.111,
+8034, 949, 0.028,
+8034, 956, -0.028,
+8034, 957, -0.028,
+8034, 958, 0.028,
+8034, 964, -0.047,
+8034, 965, -0.028,
+8034, 967, -0.028,
+8034, 973, -0.028,
+8034, 8050, 0.028,
+8034, 8058, -0.028,
+8034, 8166, -0.028,
+8035, 941, 0.028,
+8035, 947, -0.111,
+8035, 949, 0.028,
+8035, 956, -0.028,
+8035, 957, -0.028,
+8035, 958, 0.028,
+8035, 964, -0.047,
+8035, 965, -0.028,
+8035, 967, -0.028,
+8035, 973, -0.028,
+8035, 8050, 0.028,
+8035, 8058, -0.028,
+8035, 8166, -0.028,
+8036, 941, 0.028,
+8036, 947, -0.111,
+8036, 949, 0.028,
+8036, 956, -0.028,
+8036, 957, -0.028,
+8036, 958, 0.028,
+8036, 964, -0.047,
+8036, 965, -0.028,
+8036, 967, -0.028,
+8036, 973, -0.028,
+8036, 8050, 0.028,
+8036, 8058, -0.028,
+8036, 8166, -0.028,
+8037, 941, 0.028,
+8037, 947, -0.111,
+8037, 949, 0.028,
+8037, 956, -0.028,
+8037, 957, -0.028,
+8037, 958, 0.028,
+8037, 964, -0.047,
+8037, 965, -0.028,
+8037, 967, -0.028,
+8037, 973, -0.028,
+8037, 8050, 0.028,
+8037, 8058, -0.028,
+8037, 8166, -0.028,
+8038, 941, 0.028,
+8038, 947, -0.111,
+8038, 949, 0.028,
+8038, 956, -0.028,
+8038, 957, -0.028,
+8038, 958, 0.028,
+8038, 964, -0.047,
+8038, 965, -0.028,
+8038, 967, -0.028,
+8038, 973, -0.028,
+8038, 8050, 0.028,
+8038, 8058, -0.028,
+8038, 8166, -0.028,
+8039, 941, 0.028,
+8039, 947, -0.111,
+8039, 949, 0.028,
+8039, 956, -0.028,
+8039, 957, -0.028,
+8039, 958, 0.028,
+8039, 964, -0.047,
+8039, 965, -0.028,
+8039, 967, -0.028,
+8039, 973, -0.028,
+8039, 8050, 0.028,
+8039, 8058, -0.028,
+8039, 8166, -0.028,
+8048, 947, -0.083,
+8048, 952, -0.083,
+8048, 957, -0.083,
+8048, 959, -0.028,
+8048, 960, -0.044,
+8048, 964, -0.083,
+8048, 965, -0.083,
+8048, 967, -0.083,
+8048, 968, -0.028,
+8048, 972, -0.028,
+8048, 973, -0.083,
+8048, 8056, -0.028,
+8048, 8058, -0.083,
+8050, 940, -0.028,
+8050, 945, -0.028,
+8050, 948, -0.028,
+8050, 963, -0.028,
+8050, 965, -0.028,
+8050, 967, -0.008,
+8050, 973, -0.028,
+8050, 993, -0.167,
+8050, 8048, -0.028,
+8050, 8058, -0.028,
+8050, 8114, -0.028,
+8050, 8115, -0.028,
+8050, 8116, -0.028,
+8050, 8118, -0.028,
+8050, 8119, -0.028,
+8050, 8166, -0.028,
+8052, 957, -0.028,
+8052, 965, -0.028,
+8052, 973, -0.028,
+8052, 8058, -0.028,
+8052, 8166, -0.028,
+8054, 947, -0.069,
+8054, 951, -0.017,
+8054, 952, -0.033,
+8054, 954, -0.056,
+8054, 957, -0.056,
+8054, 959, -0.028,
+8054, 962, -0.028,
+8054, 963, -0.028,
+8054, 964, -0.083,
+8054, 967, -0.056,
+8054, 972, -0.028,
+8054, 993, -0.167,
+8054, 8000, -0.028,
+8054, 8001, -0.028,
+8054, 8004, -0.028,
+8054, 8005, -0.028,
+8054, 8056, -0.028,
+8056, 947, -0.028,
+8056, 955, -0.028,
+8056, 956, -0.011,
+8056, 957, -0.039,
+8056, 964, -0.033,
+8056, 965, -0.056,
+8056, 967, -0.028,
+8056, 973, -0.056,
+8056, 993, -0.167,
+8056, 8058, -0.056,
+8056, 8166, -0.056,
+8058, 952, -0.028,
+8058, 956, -0.011,
+8058, 957, -0.039,
+8058, 967, -0.028,
+8058, 968, 0.028,
+8058, 993, -0.167,
+8060, 941, 0.028,
+8060, 947, -0.111,
+8060, 949, 0.028,
+8060, 956, -0.028,
+8060, 957, -0.028,
+8060, 958, 0.028,
+8060, 964, -0.047,
+8060, 965, -0.028,
+8060, 967, -0.028,
+8060, 973, -0.028,
+8060, 8050, 0.028,
+8060, 8058, -0.028,
+8060, 8166, -0.028,
+8064, 947, -0.083,
+8064, 952, -0.083,
+8064, 957, -0.083,
+8064, 959, -0.028,
+8064, 960, -0.044,
+8064, 964, -0.083,
+8064, 965, -0.083,
+8064, 967, -0.083,
+8064, 968, -0.028,
+8064, 972, -0.028,
+8064, 973, -0.083,
+8064, 8056, -0.028,
+8064, 8058, -0.083,
+8065, 947, -0.083,
+8065, 952, -0.083,
+8065, 957, -0.083,
+8065, 959, -0.028,
+8065, 960, -0.044,
+8065, 964, -0.083,
+8065, 965, -0.083,
+8065, 967, -0.083,
+8065, 968, -0.028,
+8065, 972, -0.028,
+8065, 973, -0.083,
+8065, 8056, -0.028,
+8065, 8058, -0.083,
+8066, 947, -0.083,
+8066, 952, -0.083,
+8066, 957, -0.083,
+8066, 959, -0.028,
+8066, 960, -0.044,
+8066, 964, -0.083,
+8066, 965, -0.083,
+8066, 967, -0.083,
+8066, 968, -0.028,
+8066, 972, -0.028,
+8066, 973, -0.083,
+8066, 8056, -0.028,
+8066, 8058, -0.083,
+8067, 947, -0.083,
+8067, 952, -0.083,
+8067, 957, -0.083,
+8067, 959, -0.028,
+8067, 960, -0.044,
+8067, 964, -0.083,
+8067, 965, -0.083,
+8067, 967, -0.083,
+8067, 968, -0.028,
+8067, 972, -0.028,
+8067, 973, -0.083,
+8067, 8056, -0.028,
+8067, 8058, -0.083,
+8068, 947, -0.083,
+8068, 952, -0.083,
+8068, 957, -0.083,
+8068, 959, -0.028,
+8068, 960, -0.044,
+8068, 964, -0.083,
+8068, 965, -0.083,
+8068, 967, -0.083,
+8068, 968, -0.028,
+8068, 972, -0.028,
+8068, 973, -0.083,
+8068, 8056, -0.028,
+8068, 8058, -0.083,
+8069, 947, -0.083,
+8069, 952, -0.083,
+8069, 957, -0.044,
+8069, 959, -0.028,
+8069, 960, -0.044,
+8069, 964, -0.083,
+8069, 965, -0.083,
+8069, 967, -0.083,
+8069, 968, -0.028,
+8069, 972, -0.028,
+8069, 973, -0.083,
+8069, 8056, -0.028,
+8069, 8058, -0.083,
+8070, 947, -0.083,
+8070, 952, -0.083,
+8070, 957, -0.083,
+8070, 959, -0.028,
+8070, 960, -0.044,
+8070, 964, -0.083,
+8070, 965, -0.083,
+8070, 967, -0.083,
+8070, 968, -0.028,
+8070, 972, -0.028,
+8070, 973, -0.083,
+8070, 8056, -0.028,
+8070, 8058, -0.083,
+8071, 947, -0.083,
+8071, 952, -0.083,
+8071, 957, -0.083,
+8071, 959, -0.028,
+8071, 960, -0.044,
+8071, 964, -0.083,
+8071, 965, -0.083,
+8071, 967, -0.083,
+8071, 968, -0.028,
+8071, 972, -0.028,
+8071, 973, -0.083,
+8071, 8056, -0.028,
+8071, 8058, -0.083,
+8080, 957, -0.028,
+8080, 965, -0.028,
+8080, 973, -0.028,
+8080, 8058, -0.028,
+8080, 8166, -0.028,
+8081, 957, -0.028,
+8081, 965, -0.028,
+8081, 973, -0.028,
+8081, 8058, -0.028,
+8081, 8166, -0.028,
+8082, 957, -0.028,
+8082, 965, -0.028,
+8082, 973, -0.028,
+8082, 8058, -0.028,
+8082, 8166, -0.028,
+8083, 957, -0.028,
+8083, 965, -0.028,
+8083, 973, -0.028,
+8083, 8058, -0.028,
+8083, 8166, -0.028,
+8084, 957, -0.028,
+8084, 965, -0.028,
+8084, 973, -0.028,
+8084, 8058, -0.028,
+8084, 8166, -0.028,
+8085, 957, -0.028,
+8085, 965, -0.028,
+8085, 973, -0.028,
+8085, 8058, -0.028,
+8085, 8166, -0.028,
+8086, 957, -0.028,
+8086, 965, -0.028,
+8086, 973, -0.028,
+8086, 8058, -0.028,
+8086, 8166, -0.028,
+8087, 957, -0.028,
+8087, 965, -0.028,
+8087, 973, -0.028,
+8087, 8058, -0.028,
+8087, 8166, -0.028,
+8096, 941, 0.028,
+8096, 947, -0.111,
+8096, 949, 0.028,
+8096, 956, -0.028,
+8096, 957, -0.028,
+8096, 958, 0.028,
+8096, 964, -0.047,
+8096, 965, -0.028,
+8096, 967, -0.028,
+8096, 973, -0.028,
+8096, 8050, 0.028,
+8096, 8058, -0.028,
+8096, 8166, -0.028,
+8097, 941, 0.028,
+8097, 947, -0.111,
+8097, 949, 0.028,
+8097, 956, -0.028,
+8097, 957, -0.028,
+8097, 958, 0.028,
+8097, 964, -0.047,
+8097, 965, -0.028,
+8097, 967, -0.028,
+8097, 973, -0.028,
+8097, 8050, 0.028,
+8097, 8058, -0.028,
+8097, 8166, -0.028,
+8098, 941, 0.028,
+8098, 947, -0.111,
+8098, 949, 0.028,
+8098, 956, -0.028,
+8098, 957, -0.028,
+8098, 958, 0.028,
+8098, 964, -0.047,
+8098, 965, -0.028,
+8098, 967, -0.028,
+8098, 973, -0.028,
+8098, 8050, 0.028,
+8098, 8058, -0.028,
+8098, 8166, -0.028,
+8099, 941, 0.028,
+8099, 947, -0.111,
+8099, 949, 0.028,
+8099, 956, -0.028,
+8099, 957, -0.028,
+8099, 958, 0.028,
+8099, 964, -0.047,
+8099, 965, -0.028,
+8099, 967, -0.028,
+8099, 973, -0.028,
+8099, 8050, 0.028,
+8099, 8058, -0.028,
+8099, 8166, -0.028,
+8100, 941, 0.028,
+8100, 947, -0.111,
+8100, 949, 0.028,
+8100, 956, -0.028,
+8100, 957, -0.028,
+8100, 958, 0.028,
+8100, 964, -0.047,
+8100, 965, -0.028,
+8100, 967, -0.028,
+8100, 973, -0.028,
+8100, 8050, 0.028,
+8100, 8058, -0.028,
+8100, 8166, -0.028,
+8101, 941, 0.028,
+8101, 947, -0.111,
+8101, 949, 0.028,
+8101, 956, -0.028,
+8101, 957, -0.028,
+8101, 958, 0.028,
+8101, 964, -0.047,
+8101, 965, -0.028,
+8101, 967, -0.028,
+8101, 973, -0.028,
+8101, 8050, 0.028,
+8101, 8058, -0.028,
+8101, 8166, -0.028,
+8102, 941, 0.028,
+8102, 947, -0.111,
+8102, 949, 0.028,
+8102, 956, -0.028,
+8102, 957, -0.028,
+8102, 958, 0.028,
+8102, 964, -0.047,
+8102, 965, -0.028,
+8102, 967, -0.028,
+8102, 973, -0.028,
+8102, 8050, 0.028,
+8102, 8058, -0.028,
+8102, 8166, -0.028,
+8103, 941, 0.028,
+8103, 947, -0.111,
+8103, 949, 0.028,
+8103, 956, -0.028,
+8103, 957, -0.028,
+8103, 958, 0.028,
+8103, 964, -0.047,
+8103, 965, -0.028,
+8103, 967, -0.028,
+8103, 973, -0.028,
+8103, 8050, 0.028,
+8103, 8058, -0.028,
+8103, 8166, -0.028,
+8114, 947, -0.083,
+8114, 952, -0.083,
+8114, 957, -0.083,
+8114, 959, -0.028,
+8114, 960, -0.044,
+8114, 964, -0.083,
+8114, 965, -0.083,
+8114, 967, -0.083,
+8114, 968, -0.028,
+8114, 972, -0.028,
+8114, 973, -0.083,
+8114, 8056, -0.028,
+8114, 8058, -0.083,
+8115, 947, -0.083,
+8115, 952, -0.083,
+8115, 957, -0.094,
+8115, 959, -0.028,
+8115, 960, -0.044,
+8115, 964, -0.083,
+8115, 965, -0.083,
+8115, 967, -0.083,
+8115, 968, -0.028,
+8115, 972, -0.028,
+8115, 973, -0.083,
+8115, 993, -0.222,
+8115, 8016, -0.083,
+8115, 8018, -0.083,
+8115, 8020, -0.083,
+8115, 8021, -0.083,
+8115, 8022, -0.083,
+8115, 8023, -0.083,
+8115, 8056, -0.028,
+8115, 8058, -0.083,
+8115, 8166, -0.083,
+8116, 947, -0.083,
+8116, 952, -0.083,
+8116, 957, -0.083,
+8116, 959, -0.028,
+8116, 960, -0.044,
+8116, 964, -0.083,
+8116, 965, -0.083,
+8116, 967, -0.083,
+8116, 968, -0.028,
+8116, 972, -0.028,
+8116, 973, -0.083,
+8116, 8056, -0.028,
+8116, 8058, -0.083,
+8118, 947, -0.083,
+8118, 952, -0.083,
+8118, 957, -0.083,
+8118, 959, -0.028,
+8118, 960, -0.044,
+8118, 964, -0.083,
+8118, 965, -0.083,
+8118, 967, -0.083,
+8118, 968, -0.028,
+8118, 972, -0.028,
+8118, 973, -0.083,
+8118, 8056, -0.028,
+8118, 8058, -0.083,
+8119, 947, -0.083,
+8119, 952, -0.083,
+8119, 957, -0.083,
+8119, 959, -0.028,
+8119, 960, -0.044,
+8119, 964, -0.083,
+8119, 965, -0.083,
+8119, 967, -0.083,
+8119, 968, -0.028,
+8119, 972, -0.028,
+8119, 973, -0.083,
+8119, 8056, -0.028,
+8119, 8058, -0.083,
+8124, 920, -0.083,
+8124, 927, -0.083,
+8124, 932, -0.083,
+8124, 933, -0.139,
+8124, 934, -0.083,
+8124, 936, -0.122,
+8124, 939, -0.139,
+8124, 957, -0.097,
+8127, 913, -0.139,
+8127, 927, -0.056,
+8127, 937, -0.028,
+8127, 8124, -0.139,
+8127, 8188, -0.028,
+8128, 913, -0.111,
+8128, 8124, -0.111,
+8130, 957, -0.028,
+8130, 965, -0.028,
+8130, 973, -0.028,
+8130, 8058, -0.028,
+8130, 8166, -0.028,
+8131, 957, -0.028,
+8131, 965, -0.028,
+8131, 973, -0.028,
+8131, 993, -0.167,
+8131, 8058, -0.028,
+8131, 8166, -0.028,
+8132, 957, -0.028,
+8132, 965, -0.028,
+8132, 973, -0.028,
+8132, 8058, -0.028,
+8132, 8166, -0.028,
+8134, 957, -0.028,
+8134, 965, -0.028,
+8134, 973, -0.028,
+8134, 8058, -0.028,
+8134, 8166, -0.028,
+8135, 957, -0.028,
+8135, 965, -0.028,
+8135, 973, -0.028,
+8135, 8058, -0.028,
+8135, 8166, -0.028,
+8141, 913, -0.083,
+8141, 927, -0.028,
+8141, 8124, -0.083,
+8142, 913, -0.083,
+8142, 927, -0.028,
+8142, 8124, -0.083,
+8143, 913, -0.111,
+8143, 8124, -0.111,
+8146, 947, -0.069,
+8146, 951, -0.017,
+8146, 952, -0.033,
+8146, 954, -0.056,
+8146, 957, -0.056,
+8146, 959, -0.028,
+8146, 962, -0.028,
+8146, 963, -0.028,
+8146, 964, -0.083,
+8146, 967, -0.056,
+8146, 972, -0.028,
+8146, 993, -0.167,
+8146, 8000, -0.028,
+8146, 8001, -0.028,
+8146, 8004, -0.028,
+8146, 8005, -0.028,
+8146, 8056, -0.028,
+8150, 947, -0.069,
+8150, 951, -0.017,
+8150, 952, -0.033,
+8150, 954, -0.056,
+8150, 957, -0.056,
+8150, 959, -0.028,
+8150, 962, -0.028,
+8150, 963, -0.028,
+8150, 964, -0.083,
+8150, 967, -0.056,
+8150, 972, -0.028,
+8150, 993, -0.167,
+8150, 8000, -0.028,
+8150, 8001, -0.028,
+8150, 8004, -0.028,
+8150, 8005, -0.028,
+8150, 8056, -0.028,
+8151, 947, -0.069,
+8151, 951, -0.017,
+8151, 952, -0.033,
+8151, 954, -0.056,
+8151, 957, -0.056,
+8151, 959, -0.028,
+8151, 962, -0.028,
+8151, 963, -0.028,
+8151, 964, -0.083,
+8151, 967, -0.056,
+8151, 972, -0.028,
+8151, 993, -0.167,
+8151, 8000, -0.028,
+8151, 8001, -0.028,
+8151, 8004, -0.028,
+8151, 8005, -0.028,
+8151, 8056, -0.028,
+8157, 913, -0.083,
+8157, 927, -0.028,
+8157, 8124, -0.083,
+8158, 913, -0.083,
+8158, 927, -0.028,
+8158, 8124, -0.083,
+8159, 913, -0.111,
+8159, 8124, -0.111,
+8162, 952, -0.028,
+8162, 956, -0.011,
+8162, 957, -0.039,
+8162, 967, -0.028,
+8162, 968, 0.028,
+8162, 993, -0.167,
+8164, 943, 0.028,
+8164, 947, -0.056,
+8164, 950, 0.028,
+8164, 953, 0.028,
+8164, 957, -0.05,
+8164, 959, 0.028,
+8164, 963, 0.028,
+8164, 967, -0.011,
+8164, 968, 0.017,
+8164, 972, 0.028,
+8164, 993, -0.167,
+8164, 8054, 0.028,
+8164, 8056, 0.028,
+8164, 8150, 0.028,
+8165, 943, 0.028,
+8165, 947, -0.056,
+8165, 950, 0.028,
+8165, 953, 0.028,
+8165, 957, -0.05,
+8165, 959, 0.028,
+8165, 963, 0.028,
+8165, 967, -0.011,
+8165, 968, 0.017,
+8165, 972, 0.028,
+8165, 993, -0.167,
+8165, 8054, 0.028,
+8165, 8056, 0.028,
+8165, 8150, 0.028,
+8166, 952, -0.028,
+8166, 956, -0.011,
+8166, 957, -0.039,
+8166, 967, -0.028,
+8166, 968, 0.028,
+8166, 993, -0.167,
+8167, 952, -0.028,
+8167, 956, -0.011,
+8167, 957, -0.039,
+8167, 967, -0.028,
+8167, 968, 0.028,
+8167, 993, -0.167,
+8175, 913, -0.111,
+8175, 927, -0.056,
+8175, 937, -0.028,
+8175, 8124, -0.111,
+8175, 8188, -0.028,
+8178, 941, 0.028,
+8178, 947, -0.111,
+8178, 949, 0.028,
+8178, 956, -0.028,
+8178, 957, -0.028,
+8178, 958, 0.028,
+8178, 964, -0.047,
+8178, 965, -0.028,
+8178, 967, -0.028,
+8178, 973, -0.028,
+8178, 8050, 0.028,
+8178, 8058, -0.028,
+8178, 8166, -0.028,
+8179, 941, 0.028,
+8179, 947, -0.111,
+8179, 949, 0.028,
+8179, 956, -0.028,
+8179, 957, -0.028,
+8179, 958, 0.028,
+8179, 964, -0.047,
+8179, 965, -0.028,
+8179, 967, -0.028,
+8179, 973, -0.028,
+8179, 993, -0.167,
+8179, 8050, 0.028,
+8179, 8058, -0.028,
+8179, 8166, -0.028,
+8180, 941, 0.028,
+8180, 947, -0.111,
+8180, 949, 0.028,
+8180, 956, -0.028,
+8180, 957, -0.028,
+8180, 958, 0.028,
+8180, 964, -0.047,
+8180, 965, -0.028,
+8180, 967, -0.028,
+8180, 973, -0.028,
+8180, 8050, 0.028,
+8180, 8058, -0.028,
+8180, 8166, -0.028,
+8182, 941, 0.028,
+8182, 947, -0.111,
+8182, 949, 0.028,
+8182, 956, -0.028,
+8182, 957, -0.028,
+8182, 958, 0.028,
+8182, 964, -0.047,
+8182, 965, -0.028,
+8182, 967, -0.028,
+8182, 973, -0.028,
+8182, 8050, 0.028,
+8182, 8058, -0.028,
+8182, 8166, -0.028,
+8183, 941, 0.028,
+8183, 947, -0.111,
+8183, 949, 0.028,
+8183, 956, -0.028,
+8183, 957, -0.028,
+8183, 958, 0.028,
+8183, 964, -0.047,
+8183, 965, -0.028,
+8183, 967, -0.028,
+8183, 973, -0.028,
+8183, 8050, 0.028,
+8183, 8058, -0.028,
+8183, 8166, -0.028,
+8190, 913, -0.167,
+8190, 927, -0.056,
+8190, 937, -0.028,
+8190, 8124, -0.167,
+8190, 8188, -0.028
+KERNS_END
+
+END
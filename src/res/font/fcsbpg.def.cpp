@@ -0,0 +1,513 @@
+#include "res/font_def.res.h"
+
+DEF_FONT(fcsbpg, greek/fcsbpg.ttf, 204)
+
+xHeight(0.472) quad(1) space(0.255)
+
+roman(fcmbpg) tt(fctrpg) it(fcsropg)
+
+METRICS_START
+32, 0.255, 0.0, 0, 0,
+168, 0.244, 0.63, 0, 0.056,
+884, 0.214, 0.695, 0, 0,
+885, 0.214, 0.001, 0.188, 0,
+890, 0.122, -0.067, 0.247, 0,
+900, 0.183, 0.695, 0, 0,
+901, 0.305, 0.695, 0, 0,
+903, 0.305, 0.459, 0, 0,
+912, 0.275, 0.695, 0.01, 0,
+913, 0.733, 0.687, 0, 0,
+914, 0.733, 0.687, 0, 0,
+915, 0.58, 0.684, 0, 0,
+916, 0.916, 0.687, 0, 0,
+917, 0.642, 0.684, 0, 0,
+918, 0.672, 0.687, 0, 0,
+919, 0.794, 0.687, 0, 0,
+920, 0.855, 0.709, 0.022, 0,
+921, 0.308, 0.687, 0, 0,
+922, 0.764, 0.687, 0, 0,
+923, 0.672, 0.687, 0, 0,
+924, 0.978, 0.687, 0, 0,
+925, 0.794, 0.687, 0, 0,
+926, 0.733, 0.681, 0, 0,
+927, 0.794, 0.71, 0.022, 0,
+928, 0.794, 0.684, 0, 0,
+929, 0.703, 0.687, 0, 0,
+931, 0.794, 0.687, 0, 0,
+932, 0.733, 0.681, 0, 0,
+933, 0.855, 0.709, 0, 0,
+934, 0.794, 0.687, 0, 0,
+935, 0.733, 0.687, 0, 0,
+936, 0.855, 0.687, 0, 0,
+937, 0.794, 0.709, 0, 0,
+938, 0.308, 0.847, 0, 0.01,
+939, 0.855, 0.847, 0, 0,
+940, 0.55, 0.695, 0.011, 0.061,
+941, 0.473, 0.695, 0.022, 0,
+942, 0.55, 0.695, 0.272, 0,
+943, 0.275, 0.695, 0.01, 0,
+944, 0.55, 0.695, 0.011, 0,
+945, 0.55, 0.471, 0.011, 0.061,
+946, 0.55, 0.706, 0.271, 0,
+947, 0.611, 0.471, 0.228, 0,
+948, 0.519, 0.707, 0.011, 0,
+949, 0.473, 0.482, 0.022, 0,
+950, 0.519, 0.718, 0.186, 0,
+951, 0.55, 0.482, 0.272, 0,
+952, 0.626, 0.706, 0.011, 0,
+953, 0.275, 0.47, 0.01, 0,
+954, 0.58, 0.487, 0.027, 0,
+955, 0.55, 0.697, 0.01, 0,
+956, 0.586, 0.482, 0.266, 0.001,
+957, 0.519, 0.472, 0.01, 0,
+958, 0.519, 0.718, 0.186, 0,
+959, 0.58, 0.471, 0.011, 0,
+960, 0.565, 0.459, 0.011, 0.027,
+961, 0.519, 0.471, 0.266, 0,
+962, 0.489, 0.471, 0.125, 0,
+963, 0.626, 0.459, 0.012, 0,
+964, 0.504, 0.46, 0.011, 0,
+965, 0.55, 0.492, 0.01, 0,
+966, 0.642, 0.486, 0.272, 0,
+967, 0.611, 0.473, 0.263, 0,
+968, 0.642, 0.718, 0.272, 0,
+969, 0.733, 0.481, 0.011, 0,
+970, 0.275, 0.641, 0.01, 0.001,
+971, 0.55, 0.64, 0.01, 0,
+972, 0.58, 0.695, 0.011, 0,
+973, 0.55, 0.695, 0.01, 0,
+974, 0.733, 0.695, 0.011, 0,
+984, 0.55, 0.698, 0, 0,
+985, 0.55, 0.646, 0.077, 0,
+986, 0.855, 0.682, 0.001, 0,
+987, 0.55, 0.481, 0, 0,
+988, 0.611, 0.684, 0, 0,
+989, 0.55, 0.461, 0.249, 0,
+991, 0.428, 0.577, 0.075, 0,
+992, 0.703, 0.686, 0, 0,
+993, 0.794, 0.695, 0, 0,
+7936, 0.55, 0.696, 0.011, 0.061,
+7937, 0.55, 0.696, 0.011, 0.061,
+7938, 0.55, 0.696, 0.011, 0.061,
+7939, 0.55, 0.696, 0.011, 0.061,
+7940, 0.55, 0.696, 0.011, 0.061,
+7941, 0.55, 0.696, 0.011, 0.061,
+7942, 0.55, 0.695, 0.011, 0.061,
+7943, 0.55, 0.695, 0.011, 0.061,
+7952, 0.473, 0.696, 0.022, 0,
+7953, 0.473, 0.696, 0.022, 0,
+7954, 0.473, 0.696, 0.022, 0,
+7955, 0.473, 0.696, 0.022, 0,
+7956, 0.473, 0.696, 0.022, 0,
+7957, 0.473, 0.696, 0.022, 0,
+7968, 0.55, 0.696, 0.272, 0,
+7969, 0.55, 0.696, 0.272, 0,
+7970, 0.55, 0.696, 0.272, 0,
+7971, 0.55, 0.696, 0.272, 0,
+7972, 0.55, 0.696, 0.272, 0,
+7973, 0.55, 0.696, 0.272, 0,
+7974, 0.55, 0.695, 0.272, 0,
+7975, 0.55, 0.695, 0.272, 0,
+7984, 0.275, 0.696, 0.01, 0,
+7985, 0.275, 0.696, 0.01, 0,
+7986, 0.275, 0.696, 0.01, 0,
+7987, 0.275, 0.696, 0.01, 0,
+7988, 0.275, 0.696, 0.01, 0,
+7989, 0.275, 0.696, 0.01, 0,
+7990, 0.275, 0.696, 0.01, 0.016,
+7991, 0.275, 0.696, 0.01, 0.016,
+8000, 0.58, 0.696, 0.011, 0,
+8001, 0.58, 0.696, 0.011, 0,
+8002, 0.58, 0.696, 0.011, 0,
+8003, 0.58, 0.696, 0.011, 0,
+8004, 0.58, 0.696, 0.011, 0,
+8005, 0.58, 0.696, 0.011, 0,
+8016, 0.55, 0.696, 0.01, 0,
+8017, 0.55, 0.696, 0.01, 0,
+8018, 0.55, 0.696, 0.01, 0,
+8019, 0.55, 0.696, 0.01, 0,
+8020, 0.55, 0.696, 0.01, 0,
+8021, 0.55, 0.696, 0.01, 0,
+8022, 0.55, 0.695, 0.01, 0,
+8023, 0.55, 0.695, 0.01, 0,
+8032, 0.733, 0.696, 0.011, 0,
+8033, 0.733, 0.696, 0.011, 0,
+8034, 0.733, 0.696, 0.011, 0,
+8035, 0.733, 0.696, 0.011, 0,
+8036, 0.733, 0.696, 0.011, 0,
+8037, 0.733, 0.696, 0.011, 0,
+8038, 0.733, 0.695, 0.011, 0,
+8039, 0.733, 0.695, 0.011, 0,
+8048, 0.55, 0.695, 0.011, 0.061,
+8050, 0.473, 0.695, 0.022, 0,
+8052, 0.55, 0.695, 0.272, 0,
+8054, 0.275, 0.695, 0.01, 0,
+8056, 0.58, 0.695, 0.011, 0,
+8058, 0.55, 0.695, 0.01, 0,
+8060, 0.733, 0.695, 0.011, 0,
+8064, 0.55, 0.696, 0.247, 0.061,
+8065, 0.55, 0.696, 0.247, 0.061,
+8066, 0.55, 0.696, 0.247, 0.061,
+8067, 0.55, 0.696, 0.247, 0.061,
+8068, 0.55, 0.696, 0.247, 0.061,
+8069, 0.55, 0.696, 0.247, 0.061,
+8070, 0.55, 0.695, 0.247, 0.061,
+8071, 0.55, 0.695, 0.247, 0.061,
+8080, 0.55, 0.696, 0.272, 0,
+8081, 0.55, 0.696, 0.272, 0,
+8082, 0.55, 0.696, 0.272, 0,
+8083, 0.55, 0.696, 0.272, 0,
+8084, 0.55, 0.696, 0.272, 0,
+8085, 0.55, 0.696, 0.272, 0,
+8086, 0.55, 0.695, 0.272, 0,
+8087, 0.55, 0.695, 0.272, 0,
+8096, 0.733, 0.696, 0.247, 0,
+8097, 0.733, 0.696, 0.247, 0,
+8098, 0.733, 0.696, 0.247, 0,
+8099, 0.733, 0.696, 0.247, 0,
+8100, 0.733, 0.696, 0.247, 0,
+8101, 0.733, 0.696, 0.247, 0,
+8102, 0.733, 0.695, 0.247, 0,
+8103, 0.733, 0.695, 0.247, 0,
+8114, 0.55, 0.695, 0.247, 0.061,
+8115, 0.55, 0.471, 0.247, 0.061,
+8116, 0.55, 0.695, 0.247, 0.061,
+8118, 0.55, 0.64, 0.011, 0.061,
+8119, 0.55, 0.64, 0.247, 0.061,
+8124, 0.733, 0.687, 0.247, 0,
+8126, 0.244, 0.155, 0.153, 0,
+8127, 0.244, 0.696, 0, 0,
+8128, 0.367, 0.64, 0, 0,
+8129, 0.489, 0.696, 0, 0,
+8130, 0.55, 0.695, 0.272, 0,
+8131, 0.55, 0.482, 0.272, 0,
+8132, 0.55, 0.695, 0.272, 0,
+8134, 0.55, 0.64, 0.272, 0,
+8135, 0.55, 0.64, 0.272, 0,
+8140, 0.794, 0.687, 0.247, 0,
+8141, 0.305, 0.696, 0, 0,
+8142, 0.305, 0.696, 0, 0,
+8143, 0.367, 0.696, 0, 0,
+8146, 0.275, 0.695, 0.01, 0,
+8150, 0.275, 0.64, 0.01, 0.016,
+8151, 0.275, 0.696, 0.01, 0.016,
+8157, 0.305, 0.696, 0, 0,
+8158, 0.305, 0.696, 0, 0,
+8159, 0.367, 0.696, 0, 0,
+8162, 0.55, 0.695, 0.01, 0,
+8164, 0.519, 0.696, 0.266, 0,
+8165, 0.519, 0.696, 0.266, 0,
+8166, 0.55, 0.64, 0.01, 0,
+8167, 0.55, 0.695, 0.01, 0,
+8173, 0.305, 0.695, 0, 0,
+8175, 0.183, 0.695, 0, 0,
+8178, 0.733, 0.695, 0.247, 0,
+8179, 0.733, 0.481, 0.247, 0,
+8180, 0.733, 0.695, 0.247, 0,
+8182, 0.733, 0.641, 0.011, 0,
+8183, 0.733, 0.641, 0.247, 0,
+8188, 0.794, 0.709, 0.247, 0,
+8190, 0.244, 0.696, 0, 0,
+8217, 0.305, 0.696, 0, 0,
+9001, 0.428, 0.751, 0.25, 0,
+9002, 0.428, 0.751, 0.25, 0
+METRICS_END
+
+KERNS_START
+900, 913, -0.122,
+900, 927, -0.061,
+900, 937, -0.031,
+900, 8124, -0.122,
+900, 8188, -0.031,
+912, 947, -0.031,
+912, 951, -0.018,
+912, 952, -0.018,
+912, 957, -0.061,
+912, 959, -0.031,
+912, 962, -0.031,
+912, 963, -0.031,
+912, 964, -0.031,
+912, 967, -0.031,
+913, 920, -0.092,
+913, 927, -0.092,
+913, 932, -0.092,
+913, 933, -0.153,
+913, 934, -0.092,
+913, 936, -0.134,
+913, 939, -0.153,
+915, 913, -0.147,
+915, 916, -0.122,
+915, 923, -0.134,
+915, 8124, -0.147,
+916, 927, -0.037,
+916, 933, -0.153,
+916, 939, -0.153,
+920, 913, -0.092,
+920, 8124, -0.092,
+922, 927, -0.092,
+923, 927, -0.037,
+923, 933, -0.11,
+923, 939, -0.11,
+925, 913, -0.092,
+925, 8124, -0.092,
+927, 913, -0.092,
+927, 931, -0.061,
+927, 8124, -0.092,
+929, 913, -0.183,
+929, 8124, -0.183,
+931, 913, -0.031,
+931, 8124, -0.031,
+932, 913, -0.092,
+932, 8124, -0.092,
+933, 913, -0.153,
+933, 916, -0.153,
+933, 923, -0.153,
+933, 8124, -0.153,
+934, 913, -0.092,
+934, 8124, -0.092,
+936, 913, -0.134,
+936, 8124, -0.134,
+939, 913, -0.153,
+939, 916, -0.153,
+939, 923, -0.153,
+939, 8124, -0.153,
+943, 947, -0.031,
+943, 951, -0.018,
+943, 952, -0.018,
+943, 957, -0.061,
+943, 959, -0.031,
+943, 962, -0.031,
+943, 963, -0.031,
+943, 964, -0.031,
+943, 967, -0.031,
+953, 947, -0.031,
+953, 951, -0.018,
+953, 952, -0.018,
+953, 957, -0.061,
+953, 959, -0.031,
+953, 962, -0.031,
+953, 963, -0.031,
+953, 964, -0.031,
+953, 967, -0.031,
+959, 947, -0.031,
+959, 955, -0.031,
+959, 957, -0.024,
+959, 964, -0.024,
+959, 967, -0.031,
+964, 940, -0.031,
+964, 945, -0.031,
+964, 959, -0.031,
+964, 969, -0.031,
+964, 972, -0.031,
+964, 974, -0.031,
+964, 7936, -0.031,
+964, 7937, -0.031,
+964, 7940, -0.031,
+964, 7941, -0.031,
+964, 7942, -0.031,
+964, 7943, -0.031,
+964, 8000, -0.031,
+964, 8001, -0.031,
+964, 8004, -0.031,
+964, 8005, -0.031,
+964, 8032, -0.031,
+964, 8033, -0.031,
+964, 8036, -0.031,
+964, 8037, -0.031,
+964, 8038, -0.031,
+964, 8039, -0.031,
+964, 8048, -0.031,
+964, 8056, -0.031,
+964, 8060, -0.031,
+964, 8064, -0.031,
+964, 8065, -0.031,
+964, 8068, -0.031,
+964, 8069, -0.031,
+964, 8070, -0.031,
+964, 8071, -0.031,
+964, 8096, -0.031,
+964, 8097, -0.031,
+964, 8100, -0.031,
+964, 8101, -0.031,
+964, 8102, -0.031,
+964, 8103, -0.031,
+964, 8114, -0.031,
+964, 8116, -0.031,
+964, 8118, -0.031,
+964, 8119, -0.031,
+964, 8178, -0.031,
+964, 8180, -0.031,
+964, 8182, -0.031,
+964, 8183, -0.031,
+970, 947, -0.031,
+970, 951, -0.018,
+970, 952, -0.018,
+970, 957, -0.061,
+970, 959, -0.031,
+970, 962, -0.031,
+970, 963, -0.031,
+970, 964, -0.031,
+970, 967, -0.031,
+972, 947, -0.031,
+972, 955, -0.031,
+972, 957, -0.024,
+972, 964, -0.024,
+972, 967, -0.031,
+7984, 947, -0.031,
+7984, 951, -0.018,
+7984, 952, -0.018,
+7984, 957, -0.061,
+7984, 959, -0.031,
+7984, 962, -0.031,
+7984, 963, -0.031,
+7984, 964, -0.031,
+7984, 967, -0.031,
+7985, 947, -0.031,
+7985, 951, -0.018,
+7985, 952, -0.018,
+7985, 957, -0.061,
+7985, 959, -0.031,
+7985, 962, -0.031,
+7985, 963, -0.031,
+7985, 964, -0.031,
+7985, 967, -0.031,
+7988, 947, -0.031,
+7988, 951, -0.018,
+7988, 952, -0.018,
+7988, 957, -0.061,
+7988, 959, -0.031,
+7988, 962, -0.031,
+7988, 963, -0.031,
+7988, 964, -0.031,
+7988, 967, -0.031,
+7989, 947, -0.031,
+7989, 951, -0.018,
+7989, 952, -0.018,
+7989, 957, -0.061,
+7989, 959, -0.031,
+7989, 962, -0.031,
+7989, 963, -0.031,
+7989, 964, -0.031,
+7989, 967, -0.031,
+7990, 947, -0.031,
+7990, 951, -0.018,
+7990, 952, -0.018,
+7990, 957, -0.061,
+7990, 959, -0.031,
+7990, 962, -0.031,
+7990, 963, -0.031,
+7990, 964, -0.031,
+7990, 967, -0.031,
+7991, 947, -0.031,
+7991, 951, -0.018,
+7991, 952, -0.018,
+7991, 957, -0.061,
+7991, 959, -0.031,
+7991, 962, -0.031,
+7991, 963, -0.031,
+7991, 964, -0.031,
+7991, 967, -0.031,
+8000, 947, -0.031,
+8000, 955, -0.031,
+8000, 957, -0.024,
+8000, 964, -0.024,
+8000, 967, -0.031,
+8001, 947, -0.031,
+8001, 955, -0.031,
+8001, 957, -0.024,
+8001, 964, -0.024,
+8001, 967, -0.031,
+8004, 947, -0.031,
+8004, 955, -0.031,
+8004, 957, -0.024,
+8004, 964, -0.024,
+8004, 967, -0.031,
+8005, 947, -0.031,
+8005, 955, -0.031,
+8005, 957, -0.024,
+8005, 964, -0.024,
+8005, 967, -0.031,
+8054, 947, -0.031,
+8054, 951, -0.018,
+8054, 952, -0.018,
+8054, 957, -0.061,
+8054, 959, -0.031,
+8054, 962, -0.031,
+8054, 963, -0.031,
+8054, 964, -0.031,
+8054, 967, -0.031,
+8056, 947, -0.031,
+8056, 955, -0.031,
+8056, 957, -0.024,
+8056, 964, -0.024,
+8056, 967, -0.031,
+8124, 920, -0.092,
+8124, 927, -0.092,
+8124, 932, -0.092,
+8124, 933, -0.153,
+8124, 934, -0.092,
+8124, 936, -0.134,
+8124, 939, -0.153,
+8127, 913, -0.153,
+8127, 927, -0.061,
+8127, 937, -0.031,
+8127, 8124, -0.153,
+8127, 8188, -0.031,
+8128, 913, -0.122,
+8128, 8124, -0.122,
+8141, 913, -0.092,
+8141, 927, -0.031,
+8141, 8124, -0.092,
+8142, 913, -0.092,
+8142, 927, -0.031,
+8142, 8124, -0.092,
+8143, 913, -0.122,
+8143, 8124, -0.122,
+8146, 947, -0.031,
+8146, 951, -0.018,
+8146, 952, -0.018,
+8146, 957, -0.061,
+8146, 959, -0.031,
+8146, 962, -0.031,
+8146, 963, -0.031,
+8146, 964, -0.031,
+8146, 967, -0.031,
+8150, 947, -0.031,
+8150, 951, -0.018,
+8150, 952, -0.018,
+8150, 957, -0.061,
+8150, 959, -0.031,
+8150, 962, -0.031,
+8150, 963, -0.031,
+8150, 964, -0.031,
+8150, 967, -0.031,
+8151, 947, -0.031,
+8151, 951, -0.018,
+8151, 952, -0.018,
+8151, 957, -0.061,
+8151, 959, -0.031,
+8151, 962, -0.031,
+8151, 963, -0.031,
+8151, 964, -0.031,
+8151, 967, -0.031,
+8157, 913, -0.092,
+8157, 927, -0.031,
+8157, 8124, -0.092,
+8158, 913, -0.092,
+8158, 927, -0.031,
+8158, 8124, -0.092,
+8159, 913, -0.122,
+8159, 8124, -0.122,
+8175, 913, -0.122,
+8175, 927, -0.061,
+8175, 937, -0.031,
+8175, 8124, -0.122,
+8175, 8188, -0.031,
+8190, 913, -0.183,
+8190, 927, -0.061,
+8190, 937, -0.031,
+8190, 8124, -0.183,
+8190, 8188, -0.031
+KERNS_END
+
+END
@@ -0,0 +1,513 @@
+#include "res/font_def.res.h"
+
+DEF_FONT(fcsropg, greek/fcsropg.ttf, 204)
+
+xHeight(0.444) quad(1) space(0.239)
+
+roman(fcmripg) bold(fcsbpg) tt(fctrpg)
+
+METRICS_START
+32, 0.239, 0.0, 0, 0,
+168, 0.222, 0.603, 0, 0.17,
+884, 0.194, 0.695, 0, 0.14,
+885, 0.194, 0.001, 0.21, 0.003,
+890, 0.111, -0.064, 0.238, 0,
+900, 0.167, 0.695, 0, 0.145,
+901, 0.278, 0.695, 0, 0.117,
+903, 0.278, 0.431, 0, 0,
+912, 0.25, 0.695, 0.011, 0.099,
+913, 0.667, 0.685, 0, 0,
+914, 0.667, 0.685, 0, 0.028,
+915, 0.542, 0.681, 0, 0.101,
+916, 0.833, 0.684, 0, 0,
+917, 0.597, 0.681, 0, 0.088,
+918, 0.611, 0.684, 0, 0.089,
+919, 0.708, 0.684, 0, 0.049,
+920, 0.778, 0.707, 0.022, 0.026,
+921, 0.278, 0.684, 0, 0.049,
+922, 0.694, 0.684, 0, 0.089,
+923, 0.611, 0.684, 0, 0,
+924, 0.875, 0.684, 0, 0.044,
+925, 0.708, 0.684, 0, 0.047,
+926, 0.667, 0.679, 0, 0.096,
+927, 0.736, 0.706, 0.021, 0.026,
+928, 0.708, 0.681, 0, 0.048,
+929, 0.639, 0.685, 0, 0.051,
+931, 0.722, 0.684, 0, 0.089,
+932, 0.68, 0.679, 0, 0.107,
+933, 0.778, 0.707, 0, 0.064,
+934, 0.722, 0.684, 0, 0.021,
+935, 0.667, 0.684, 0, 0.088,
+936, 0.778, 0.684, 0, 0.072,
+937, 0.722, 0.706, 0, 0.046,
+938, 0.278, 0.833, 0, 0.168,
+939, 0.778, 0.833, 0, 0.064,
+940, 0.5, 0.695, 0.011, 0.065,
+941, 0.43, 0.695, 0.022, 0.042,
+942, 0.5, 0.695, 0.272, 0.022,
+943, 0.25, 0.695, 0.011, 0.099,
+944, 0.5, 0.695, 0.011, 0.013,
+945, 0.5, 0.443, 0.011, 0.065,
+946, 0.5, 0.706, 0.272, 0.03,
+947, 0.555, 0.443, 0.216, 0.044,
+948, 0.472, 0.652, 0.01, 0.05,
+949, 0.43, 0.453, 0.022, 0.042,
+950, 0.472, 0.718, 0.153, 0.089,
+951, 0.5, 0.453, 0.272, 0.011,
+952, 0.569, 0.707, 0.012, 0.031,
+953, 0.25, 0.443, 0.011, 0,
+954, 0.528, 0.458, 0.026, 0.05,
+955, 0.5, 0.698, 0.011, 0,
+956, 0.522, 0.453, 0.267, 0.018,
+957, 0.472, 0.443, 0.01, 0.022,
+958, 0.472, 0.718, 0.152, 0.088,
+959, 0.528, 0.442, 0.011, 0.009,
+960, 0.514, 0.432, 0.011, 0.048,
+961, 0.472, 0.443, 0.266, 0.009,
+962, 0.444, 0.443, 0.124, 0.044,
+963, 0.569, 0.431, 0.01, 0.061,
+964, 0.458, 0.432, 0.011, 0.048,
+965, 0.5, 0.456, 0.011, 0.013,
+966, 0.583, 0.454, 0.272, 0.012,
+967, 0.555, 0.445, 0.263, 0.051,
+968, 0.583, 0.718, 0.272, 0.021,
+969, 0.667, 0.453, 0.011, 0.01,
+970, 0.25, 0.626, 0.011, 0.12,
+971, 0.5, 0.626, 0.011, 0.013,
+972, 0.528, 0.695, 0.011, 0.009,
+973, 0.5, 0.695, 0.011, 0.013,
+974, 0.667, 0.695, 0.011, 0.01,
+984, 0.5, 0.695, 0, 0.072,
+985, 0.5, 0.601, 0.064, 0.042,
+986, 0.778, 0.679, 0, 0,
+987, 0.5, 0.454, 0, 0.04,
+988, 0.569, 0.681, 0, 0.101,
+989, 0.5, 0.432, 0.25, 0.028,
+991, 0.389, 0.563, 0.106, 0.005,
+992, 0.639, 0.683, 0, 0,
+993, 0.722, 0.696, 0, 0,
+7936, 0.5, 0.696, 0.011, 0.065,
+7937, 0.5, 0.696, 0.011, 0.065,
+7938, 0.5, 0.696, 0.011, 0.065,
+7939, 0.5, 0.696, 0.011, 0.065,
+7940, 0.5, 0.696, 0.011, 0.065,
+7941, 0.5, 0.696, 0.011, 0.065,
+7942, 0.5, 0.695, 0.011, 0.067,
+7943, 0.5, 0.695, 0.011, 0.067,
+7952, 0.43, 0.696, 0.022, 0.042,
+7953, 0.43, 0.696, 0.022, 0.042,
+7954, 0.43, 0.696, 0.022, 0.048,
+7955, 0.43, 0.696, 0.022, 0.048,
+7956, 0.43, 0.696, 0.022, 0.083,
+7957, 0.43, 0.696, 0.022, 0.083,
+7968, 0.5, 0.696, 0.272, 0.011,
+7969, 0.5, 0.696, 0.272, 0.011,
+7970, 0.5, 0.696, 0.272, 0.029,
+7971, 0.5, 0.696, 0.272, 0.029,
+7972, 0.5, 0.696, 0.272, 0.064,
+7973, 0.5, 0.696, 0.272, 0.064,
+7974, 0.5, 0.696, 0.272, 0.079,
+7975, 0.5, 0.696, 0.272, 0.079,
+7984, 0.25, 0.696, 0.011, 0.071,
+7985, 0.25, 0.696, 0.011, 0.022,
+7986, 0.25, 0.696, 0.011, 0.106,
+7987, 0.25, 0.696, 0.011, 0.106,
+7988, 0.25, 0.696, 0.011, 0.141,
+7989, 0.25, 0.696, 0.011, 0.141,
+7990, 0.25, 0.696, 0.011, 0.155,
+7991, 0.25, 0.696, 0.011, 0.155,
+8000, 0.528, 0.696, 0.011, 0.009,
+8001, 0.528, 0.696, 0.011, 0.009,
+8002, 0.528, 0.696, 0.011, 0.009,
+8003, 0.528, 0.696, 0.011, 0.009,
+8004, 0.528, 0.696, 0.011, 0.034,
+8005, 0.528, 0.696, 0.011, 0.034,
+8016, 0.5, 0.696, 0.011, 0.013,
+8017, 0.5, 0.696, 0.011, 0.013,
+8018, 0.5, 0.696, 0.011, 0.013,
+8019, 0.5, 0.696, 0.011, 0.013,
+8020, 0.5, 0.696, 0.011, 0.013,
+8021, 0.5, 0.696, 0.011, 0.013,
+8022, 0.5, 0.696, 0.011, 0.026,
+8023, 0.5, 0.696, 0.011, 0.026,
+8032, 0.667, 0.696, 0.011, 0.01,
+8033, 0.667, 0.696, 0.011, 0.01,
+8034, 0.667, 0.696, 0.011, 0.01,
+8035, 0.667, 0.696, 0.011, 0.01,
+8036, 0.667, 0.696, 0.011, 0.01,
+8037, 0.667, 0.696, 0.011, 0.01,
+8038, 0.667, 0.695, 0.011, 0.035,
+8039, 0.667, 0.695, 0.011, 0.035,
+8048, 0.5, 0.695, 0.011, 0.065,
+8050, 0.43, 0.695, 0.022, 0.042,
+8052, 0.5, 0.695, 0.272, 0.011,
+8054, 0.25, 0.695, 0.011, 0.011,
+8056, 0.528, 0.695, 0.011, 0.009,
+8058, 0.5, 0.695, 0.011, 0.013,
+8060, 0.667, 0.695, 0.011, 0.01,
+8064, 0.5, 0.696, 0.238, 0.065,
+8065, 0.5, 0.696, 0.238, 0.065,
+8066, 0.5, 0.696, 0.238, 0.065,
+8067, 0.5, 0.696, 0.238, 0.065,
+8068, 0.5, 0.696, 0.238, 0.065,
+8069, 0.5, 0.696, 0.238, 0.065,
+8070, 0.5, 0.695, 0.238, 0.067,
+8071, 0.5, 0.695, 0.238, 0.067,
+8080, 0.5, 0.696, 0.272, 0.011,
+8081, 0.5, 0.696, 0.272, 0.011,
+8082, 0.5, 0.696, 0.272, 0.029,
+8083, 0.5, 0.696, 0.272, 0.029,
+8084, 0.5, 0.696, 0.272, 0.064,
+8085, 0.5, 0.696, 0.272, 0.064,
+8086, 0.5, 0.696, 0.272, 0.079,
+8087, 0.5, 0.696, 0.272, 0.079,
+8096, 0.667, 0.696, 0.238, 0.01,
+8097, 0.667, 0.696, 0.238, 0.01,
+8098, 0.667, 0.696, 0.238, 0.01,
+8099, 0.667, 0.696, 0.238, 0.01,
+8100, 0.667, 0.696, 0.238, 0.01,
+8101, 0.667, 0.696, 0.238, 0.01,
+8102, 0.667, 0.695, 0.238, 0.035,
+8103, 0.667, 0.695, 0.238, 0.035,
+8114, 0.5, 0.695, 0.238, 0.065,
+8115, 0.5, 0.443, 0.238, 0.065,
+8116, 0.5, 0.695, 0.238, 0.065,
+8118, 0.5, 0.627, 0.011, 0.065,
+8119, 0.5, 0.627, 0.238, 0.065,
+8124, 0.667, 0.685, 0.238, 0,
+8126, 0.222, 0.158, 0.156, 0,
+8127, 0.222, 0.696, 0, 0.117,
+8128, 0.333, 0.627, 0, 0.132,
+8129, 0.444, 0.695, 0, 0.091,
+8130, 0.5, 0.695, 0.272, 0.011,
+8131, 0.5, 0.453, 0.272, 0.011,
+8132, 0.5, 0.695, 0.272, 0.022,
+8134, 0.5, 0.626, 0.272, 0.064,
+8135, 0.5, 0.626, 0.272, 0.064,
+8140, 0.708, 0.684, 0.238, 0.049,
+8141, 0.278, 0.696, 0, 0.124,
+8142, 0.278, 0.696, 0, 0.159,
+8143, 0.333, 0.695, 0, 0.146,
+8146, 0.25, 0.695, 0.011, 0.08,
+8150, 0.25, 0.627, 0.011, 0.141,
+8151, 0.25, 0.696, 0.011, 0.155,
+8157, 0.278, 0.696, 0, 0.124,
+8158, 0.278, 0.696, 0, 0.159,
+8159, 0.333, 0.695, 0, 0.146,
+8162, 0.5, 0.695, 0.011, 0.013,
+8164, 0.472, 0.696, 0.266, 0.009,
+8165, 0.472, 0.696, 0.266, 0.009,
+8166, 0.5, 0.627, 0.011, 0.013,
+8167, 0.5, 0.696, 0.011, 0.026,
+8173, 0.278, 0.695, 0, 0.098,
+8175, 0.167, 0.695, 0, 0.112,
+8178, 0.667, 0.695, 0.238, 0.01,
+8179, 0.667, 0.453, 0.238, 0.01,
+8180, 0.667, 0.695, 0.238, 0.01,
+8182, 0.667, 0.627, 0.011, 0.021,
+8183, 0.667, 0.627, 0.238, 0.021,
+8188, 0.722, 0.706, 0.238, 0.046,
+8190, 0.222, 0.696, 0, 0.068,
+8217, 0.278, 0.695, 0, 0.057,
+9001, 0.389, 0.752, 0.249, 0.099,
+9002, 0.389, 0.751, 0.249, 0
+METRICS_END
+
+KERNS_START
+900, 913, -0.111,
+900, 927, -0.056,
+900, 937, -0.028,
+900, 8124, -0.111,
+900, 8188, -0.028,
+912, 947, -0.028,
+912, 951, -0.017,
+912, 952, -0.017,
+912, 957, -0.056,
+912, 959, -0.028,
+912, 962, -0.028,
+912, 963, -0.028,
+912, 964, -0.028,
+912, 967, -0.028,
+913, 920, -0.083,
+913, 927, -0.083,
+913, 932, -0.083,
+913, 933, -0.139,
+913, 934, -0.083,
+913, 936, -0.122,
+913, 939, -0.139,
+915, 913, -0.133,
+915, 916, -0.111,
+915, 923, -0.122,
+915, 8124, -0.133,
+916, 927, -0.033,
+916, 933, -0.139,
+916, 939, -0.139,
+920, 913, -0.083,
+920, 8124, -0.083,
+922, 927, -0.083,
+923, 927, -0.033,
+923, 933, -0.1,
+923, 939, -0.1,
+925, 913, -0.083,
+925, 8124, -0.083,
+927, 913, -0.083,
+927, 931, -0.056,
+927, 8124, -0.083,
+929, 913, -0.167,
+929, 8124, -0.167,
+931, 913, -0.028,
+931, 8124, -0.028,
+932, 913, -0.083,
+932, 8124, -0.083,
+933, 913, -0.139,
+933, 916, -0.139,
+933, 923, -0.139,
+933, 8124, -0.139,
+934, 913, -0.083,
+934, 8124, -0.083,
+936, 913, -0.122,
+936, 8124, -0.122,
+939, 913, -0.139,
+939, 916, -0.139,
+939, 923, -0.139,
+939, 8124, -0.139,
+943, 947, -0.028,
+943, 951, -0.017,
+943, 952, -0.017,
+943, 957, -0.056,
+943, 959, -0.028,
+943, 962, -0.028,
+943, 963, -0.028,
+943, 964, -0.028,
+943, 967, -0.028,
+953, 947, -0.028,
+953, 951, -0.017,
+953, 952, -0.017,
+953, 957, -0.056,
+953, 959, -0.028,
+953, 962, -0.028,
+953, 963, -0.028,
+953, 964, -0.028,
+953, 967, -0.028,
+959, 947, -0.028,
+959, 955, -0.028,
+959, 957, -0.022,
+959, 964, -0.022,
+959, 967, -0.028,
+964, 940, -0.028,
+964, 945, -0.028,
+964, 959, -0.028,
+964, 969, -0.028,
+964, 972, -0.028,
+964, 974, -0.028,
+964, 7936, -0.028,
+964, 7937, -0.028,
+964, 7940, -0.028,
+964, 7941, -0.028,
+964, 7942, -0.028,
+964, 7943, -0.028,
+964, 8000, -0.028,
+964, 8001, -0.028,
+964, 8004, -0.028,
+964, 8005, -0.028,
+964, 8032, -0.028,
+964, 8033, -0.028,
+964, 8036, -0.028,
+964, 8037, -0.028,
+964, 8038, -0.028,
+964, 8039, -0.028,
+964, 8048, -0.028,
+964, 8056, -0.028,
+964, 8060, -0.028,
+964, 8064, -0.028,
+964, 8065, -0.028,
+964, 8068, -0.028,
+964, 8069, -0.028,
+964, 8070, -0.028,
+964, 8071, -0.028,
+964, 8096, -0.028,
+964, 8097, -0.028,
+964, 8100, -0.028,
+964, 8101, -0.028,
+964, 8102, -0.028,
+964, 8103, -0.028,
+964, 8114, -0.028,
+964, 8116, -0.028,
+964, 8118, -0.028,
+964, 8119, -0.028,
+964, 8178, -0.028,
+964, 8180, -0.028,
+964, 8182, -0.028,
+964, 8183, -0.028,
+970, 947, -0.028,
+970, 951, -0.017,
+970, 952, -0.017,
+970, 957, -0.056,
+970, 959, -0.028,
+970, 962, -0.028,
+970, 963, -0.028,
+970, 964, -0.028,
+970, 967, -0.028,
+972, 947, -0.028,
+972, 955, -0.028,
+972, 957, -0.022,
+972, 964, -0.022,
+972, 967, -0.028,
+7984, 947, -0.028,
+7984, 951, -0.017,
+7984, 952, -0.017,
+7984, 957, -0.056,
+7984, 959, -0.028,
+7984, 962, -0.028,
+7984, 963, -0.028,
+7984, 964, -0.028,
+7984, 967, -0.028,
+7985, 947, -0.028,
+7985, 951, -0.017,
+7985, 952, -0.017,
+7985, 957, -0.056,
+7985, 959, -0.028,
+7985, 962, -0.028,
+7985, 963, -0.028,
+7985, 964, -0.028,
+7985, 967, -0.028,
+7988, 947, -0.028,
+7988, 951, -0.017,
+7988, 952, -0.017,
+7988, 957, -0.056,
+7988, 959, -0.028,
+7988, 962, -0.028,
+7988, 963, -0.028,
+7988, 964, -0.028,
+7988, 967, -0.028,
+7989, 947, -0.028,
+7989, 951, -0.017,
+7989, 952, -0.017,
+7989, 957, -0.056,
+7989, 959, -0.028,
+7989, 962, -0.028,
+7989, 963, -0.028,
+7989, 964, -0.028,
+7989, 967, -0.028,
+7990, 947, -0.028,
+7990, 951, -0.017,
+7990, 952, -0.017,
+7990, 957, -0.056,
+7990, 959, -0.028,
+7990, 962, -0.028,
+7990, 963, -0.028,
+7990, 964, -0.028,
+7990, 967, -0.028,
+7991, 947, -0.028,
+7991, 951, -0.017,
+7991, 952, -0.017,
+7991, 957, -0.056,
+7991, 959, -0.028,
+7991, 962, -0.028,
+7991, 963, -0.028,
+7991, 964, -0.028,
+7991, 967, -0.028,
+8000, 947, -0.028,
+8000, 955, -0.028,
+8000, 957, -0.022,
+8000, 964, -0.022,
+8000, 967, -0.028,
+8001, 947, -0.028,
+8001, 955, -0.028,
+8001, 957, -0.022,
+8001, 964, -0.022,
+8001, 967, -0.028,
+8004, 947, -0.028,
+8004, 955, -0.028,
+8004, 957, -0.022,
+8004, 964, -0.022,
+8004, 967, -0.028,
+8005, 947, -0.028,
+8005, 955, -0.028,
+8005, 957, -0.022,
+8005, 964, -0.022,
+8005, 967, -0.028,
+8054, 947, -0.028,
+8054, 951, -0.017,
+8054, 952, -0.017,
+8054, 957, -0.056,
+8054, 959, -0.028,
+8054, 962, -0.028,
+8054, 963, -0.028,
+8054, 964, -0.028,
+8054, 967, -0.028,
+8056, 947, -0.028,
+8056, 955, -0.028,
+8056, 957, -0.022,
+8056, 964, -0.022,
+8056, 967, -0.028,
+8124, 920, -0.083,
+8124, 927, -0.083,
+8124, 932, -0.083,
+8124, 933, -0.139,
+8124, 934, -0.083,
+8124, 936, -0.122,
+8124, 939, -0.139,
+8127, 913, -0.139,
+8127, 927, -0.056,
+8127, 937, -0.028,
+8127, 8124, -0.139,
+8127, 8188, -0.028,
+8128, 913, -0.111,
+8128, 8124, -0.111,
+8141, 913, -0.083,
+8141, 927, -0.028,
+8141, 8124, -0.083,
+8142, 913, -0.083,
+8142, 927, -0.028,
+8142, 8124, -0.083,
+8143, 913, -0.111,
+8143, 8124, -0.111,
+8146, 947, -0.028,
+8146, 951, -0.017,
+8146, 952, -0.017,
+8146, 957, -0.056,
+8146, 959, -0.028,
+8146, 962, -0.028,
+8146, 963, -0.028,
+8146, 964, -0.028,
+8146, 967, -0.028,
+8150, 947, -0.028,
+8150, 951, -0.017,
+8150, 952, -0.017,
+8150, 957, -0.056,
+8150, 959, -0.028,
+8150, 962, -0.028,
+8150, 963, -0.028,
+8150, 964, -0.028,
+8150, 967, -0.028,
+8151, 947, -0.028,
+8151, 951, -0.017,
+8151, 952, -0.017,
+8151, 957, -0.056,
+8151, 959, -0.028,
+8151, 962, -0.028,
+8151, 963, -0.028,
+8151, 964, -0.028,
+8151, 967, -0.028,
+8157, 913, -0.083,
+8157, 927, -0.028,
+8157, 8124, -0.083,
+8158, 913, -0.083,
+8158, 927, -0.028,
+8158, 8124, -0.083,
+8159, 913, -0.111,
+8159, 8124, -0.111,
+8175, 913, -0.111,
+8175, 927, -0.056,
+8175, 937, -0.028,
+8175, 8124, -0.111,
+8175, 8188, -0.028,
+8190, 913, -0.167,
+8190, 927, -0.056,
+8190, 937, -0.028,
+8190, 8124, -0.167,
+8190, 8188, -0.028
+KERNS_END
+
+END
@@ -0,0 +1,223 @@
+#include "res/font_def.res.h"
+
+DEF_FONT(fctrpg, greek/fctrpg.ttf, 204)
+
+xHeight(0.438) quad(1) space(0.525)
+
+METRICS_START
+32, 0.525, 0.0, 0, 0,
+168, 0.525, 0.607, 0, 0,
+884, 0.525, 0.613, 0, 0,
+885, 0.525, 0.001, 0.14, 0,
+890, 0.525, -0.053, 0.184, 0,
+900, 0.525, 0.613, 0, 0,
+901, 0.525, 0.613, 0, 0,
+903, 0.525, 0.431, 0, 0,
+912, 0.525, 0.613, 0.006, 0,
+913, 0.525, 0.653, 0, 0,
+914, 0.525, 0.641, 0, 0,
+915, 0.525, 0.641, 0, 0,
+916, 0.525, 0.653, 0, 0,
+917, 0.525, 0.641, 0, 0,
+918, 0.525, 0.64, 0, 0,
+919, 0.525, 0.641, 0, 0,
+920, 0.525, 0.652, 0.011, 0,
+921, 0.525, 0.641, 0, 0,
+922, 0.525, 0.641, 0, 0,
+923, 0.525, 0.653, 0, 0,
+924, 0.525, 0.641, 0, 0,
+925, 0.525, 0.641, 0, 0,
+926, 0.525, 0.641, 0, 0,
+927, 0.525, 0.652, 0.011, 0,
+928, 0.525, 0.641, 0, 0,
+929, 0.525, 0.641, 0, 0,
+931, 0.525, 0.641, 0, 0,
+932, 0.525, 0.641, 0, 0,
+933, 0.525, 0.651, 0, 0,
+934, 0.525, 0.64, 0, 0,
+935, 0.525, 0.641, 0, 0,
+936, 0.525, 0.64, 0, 0,
+937, 0.525, 0.651, 0, 0,
+938, 0.525, 0.783, 0, 0,
+939, 0.525, 0.783, 0, 0,
+940, 0.525, 0.613, 0.006, 0.002,
+941, 0.525, 0.613, 0.011, 0,
+942, 0.525, 0.613, 0.232, 0,
+943, 0.525, 0.613, 0.006, 0,
+944, 0.525, 0.669, 0.006, 0,
+945, 0.525, 0.438, 0.006, 0.002,
+946, 0.525, 0.647, 0.232, 0,
+947, 0.525, 0.438, 0.177, 0,
+948, 0.525, 0.637, 0.005, 0,
+949, 0.525, 0.443, 0.011, 0,
+950, 0.525, 0.651, 0.133, 0,
+951, 0.525, 0.442, 0.232, 0,
+952, 0.525, 0.652, 0.011, 0,
+953, 0.525, 0.437, 0.006, 0,
+954, 0.525, 0.445, 0.013, 0,
+955, 0.525, 0.642, 0.005, 0,
+956, 0.525, 0.442, 0.227, 0,
+957, 0.525, 0.438, 0.005, 0,
+958, 0.525, 0.651, 0.133, 0,
+959, 0.525, 0.438, 0.006, 0,
+960, 0.525, 0.432, 0.006, 0,
+961, 0.525, 0.437, 0.221, 0,
+962, 0.525, 0.437, 0.111, 0,
+963, 0.525, 0.437, 0.005, 0,
+964, 0.525, 0.431, 0.006, 0,
+965, 0.525, 0.443, 0.006, 0,
+966, 0.525, 0.443, 0.232, 0,
+967, 0.525, 0.439, 0.229, 0,
+968, 0.525, 0.651, 0.232, 0,
+969, 0.525, 0.442, 0.006, 0,
+970, 0.525, 0.641, 0.006, 0,
+971, 0.525, 0.64, 0.006, 0,
+972, 0.525, 0.613, 0.006, 0,
+973, 0.525, 0.613, 0.006, 0,
+974, 0.525, 0.613, 0.006, 0,
+984, 0.525, 0.647, 0, 0,
+985, 0.525, 0.609, 0.055, 0,
+986, 0.525, 0.641, 0.028, 0,
+987, 0.525, 0.443, 0.018, 0,
+988, 0.525, 0.641, 0, 0,
+989, 0.525, 0.432, 0.221, 0,
+991, 0.525, 0.542, 0.101, 0,
+992, 0.525, 0.667, 0, 0,
+993, 0.525, 0.64, 0.011, 0,
+7936, 0.525, 0.64, 0.006, 0.002,
+7937, 0.525, 0.64, 0.006, 0.002,
+7938, 0.525, 0.64, 0.006, 0.002,
+7939, 0.525, 0.64, 0.006, 0.002,
+7940, 0.525, 0.64, 0.006, 0.002,
+7941, 0.525, 0.64, 0.006, 0.002,
+7942, 0.525, 0.696, 0.006, 0.002,
+7943, 0.525, 0.696, 0.006, 0.002,
+7952, 0.525, 0.64, 0.011, 0,
+7953, 0.525, 0.64, 0.011, 0,
+7954, 0.525, 0.64, 0.011, 0,
+7955, 0.525, 0.64, 0.011, 0,
+7956, 0.525, 0.64, 0.011, 0,
+7957, 0.525, 0.64, 0.011, 0,
+7968, 0.525, 0.64, 0.232, 0,
+7969, 0.525, 0.64, 0.232, 0,
+7970, 0.525, 0.64, 0.232, 0,
+7971, 0.525, 0.64, 0.232, 0,
+7972, 0.525, 0.64, 0.232, 0,
+7973, 0.525, 0.64, 0.232, 0,
+7974, 0.525, 0.696, 0.232, 0,
+7975, 0.525, 0.696, 0.232, 0,
+7984, 0.525, 0.64, 0.006, 0,
+7985, 0.525, 0.64, 0.006, 0,
+7986, 0.525, 0.64, 0.006, 0,
+7987, 0.525, 0.64, 0.006, 0,
+7988, 0.525, 0.64, 0.006, 0,
+7989, 0.525, 0.64, 0.006, 0,
+7990, 0.525, 0.696, 0.006, 0,
+7991, 0.525, 0.696, 0.006, 0,
+8000, 0.525, 0.64, 0.006, 0,
+8001, 0.525, 0.64, 0.006, 0,
+8002, 0.525, 0.64, 0.006, 0,
+8003, 0.525, 0.64, 0.006, 0,
+8004, 0.525, 0.64, 0.006, 0,
+8005, 0.525, 0.64, 0.006, 0,
+8016, 0.525, 0.64, 0.006, 0,
+8017, 0.525, 0.64, 0.006, 0,
+8018, 0.525, 0.64, 0.006, 0,
+8019, 0.525, 0.64, 0.006, 0,
+8020, 0.525, 0.64, 0.006, 0,
+8021, 0.525, 0.64, 0.006, 0,
+8022, 0.525, 0.696, 0.006, 0,
+8023, 0.525, 0.696, 0.006, 0,
+8032, 0.525, 0.64, 0.006, 0,
+8033, 0.525, 0.64, 0.006, 0,
+8034, 0.525, 0.64, 0.006, 0,
+8035, 0.525, 0.64, 0.006, 0,
+8036, 0.525, 0.64, 0.006, 0,
+8037, 0.525, 0.64, 0.006, 0,
+8038, 0.525, 0.696, 0.006, 0,
+8039, 0.525, 0.696, 0.006, 0,
+8048, 0.525, 0.613, 0.006, 0.002,
+8050, 0.525, 0.614, 0.011, 0,
+8052, 0.525, 0.614, 0.232, 0,
+8054, 0.525, 0.613, 0.006, 0,
+8056, 0.525, 0.614, 0.006, 0,
+8058, 0.525, 0.613, 0.006, 0,
+8060, 0.525, 0.614, 0.006, 0,
+8064, 0.525, 0.64, 0.184, 0.002,
+8065, 0.525, 0.64, 0.184, 0.002,
+8066, 0.525, 0.64, 0.184, 0.002,
+8067, 0.525, 0.64, 0.184, 0.002,
+8068, 0.525, 0.64, 0.184, 0.002,
+8069, 0.525, 0.64, 0.184, 0.002,
+8070, 0.525, 0.696, 0.184, 0.002,
+8071, 0.525, 0.696, 0.184, 0.002,
+8080, 0.525, 0.64, 0.232, 0,
+8081, 0.525, 0.64, 0.232, 0,
+8082, 0.525, 0.64, 0.232, 0,
+8083, 0.525, 0.64, 0.232, 0,
+8084, 0.525, 0.64, 0.232, 0,
+8085, 0.525, 0.64, 0.232, 0,
+8086, 0.525, 0.696, 0.232, 0,
+8087, 0.525, 0.696, 0.232, 0,
+8096, 0.525, 0.64, 0.184, 0,
+8097, 0.525, 0.64, 0.184, 0,
+8098, 0.525, 0.64, 0.184, 0,
+8099, 0.525, 0.64, 0.184, 0,
+8100, 0.525, 0.64, 0.184, 0,
+8101, 0.525, 0.64, 0.184, 0,
+8102, 0.525, 0.696, 0.184, 0,
+8103, 0.525, 0.696, 0.184, 0,
+8114, 0.525, 0.613, 0.184, 0.002,
+8115, 0.525, 0.438, 0.184, 0.002,
+8116, 0.525, 0.613, 0.184, 0.002,
+8118, 0.525, 0.641, 0.006, 0.002,
+8119, 0.525, 0.641, 0.184, 0.002,
+8124, 0.525, 0.653, 0.184, 0,
+8126, 0.525, 0.137, 0.135, 0,
+8127, 0.525, 0.64, 0, 0,
+8128, 0.525, 0.641, 0, 0,
+8129, 0.525, 0.696, 0, 0,
+8130, 0.525, 0.614, 0.232, 0,
+8131, 0.525, 0.442, 0.232, 0,
+8132, 0.525, 0.613, 0.232, 0,
+8134, 0.525, 0.641, 0.232, 0,
+8135, 0.525, 0.641, 0.232, 0,
+8140, 0.525, 0.641, 0.184, 0,
+8141, 0.525, 0.64, 0, 0,
+8142, 0.525, 0.64, 0, 0,
+8143, 0.525, 0.696, 0, 0,
+8146, 0.525, 0.613, 0.006, 0,
+8150, 0.525, 0.641, 0.006, 0,
+8151, 0.525, 0.696, 0.006, 0,
+8157, 0.525, 0.64, 0, 0,
+8158, 0.525, 0.64, 0, 0,
+8159, 0.525, 0.696, 0, 0,
+8162, 0.525, 0.668, 0.006, 0,
+8164, 0.525, 0.64, 0.221, 0,
+8165, 0.525, 0.64, 0.221, 0,
+8166, 0.525, 0.641, 0.006, 0,
+8167, 0.525, 0.696, 0.006, 0,
+8173, 0.525, 0.613, 0, 0,
+8175, 0.525, 0.614, 0, 0,
+8178, 0.525, 0.614, 0.184, 0,
+8179, 0.525, 0.442, 0.184, 0,
+8180, 0.525, 0.613, 0.184, 0,
+8182, 0.525, 0.641, 0.006, 0,
+8183, 0.525, 0.641, 0.184, 0,
+8188, 0.525, 0.651, 0.184, 0,
+8190, 0.525, 0.64, 0, 0,
+8217, 0.525, 0.641, 0, 0,
+9001, 0.525, 0.695, 0.083, 0,
+9002, 0.525, 0.695, 0.083, 0
+METRICS_END
+
+KERNS_START
+8141, 913, -0.087,
+8141, 927, -0.029,
+8141, 8124, -0.087,
+8157, 913, -0.087,
+8157, 927, -0.029,
+8157, 8124, -0.087
+KERNS_END
+
+END
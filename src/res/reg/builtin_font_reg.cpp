@@ -41,3 +41,29 @@ REG_FONT(sb10)
 REG_FONT(tt10)
 
 END_DEF_FONT_SET
+
+DEF_FONT_SET(Greek)
+
+REG_FONT(fcmbipg)
+REG_FONT(fcmbpg)
+REG_FONT(fcmripg)
+REG_FONT(fcmrpg)
+REG_FONT(fcsbpg)
+REG_FONT(fcsropg)
+REG_FONT(fcsrpg)
+REG_FONT(fctrpg)
+
+END_DEF_FONT_SET
+
+DEF_FONT_SET(Cyrillic)
+
+REG_FONT(wnr10)
+REG_FONT(wnti10)
+REG_FONT(wntt10)
+REG_FONT(wnss10)
+REG_FONT(wnssi10)
+REG_FONT(wnssbx10)
+REG_FONT(wnbx10)
+REG_FONT(wnbxti10)
+
+END_DEF_FONT_SET
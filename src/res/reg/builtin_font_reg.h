@@ -44,10 +44,35 @@ DECL_FONT_REG(sbi10);
 DECL_FONT_REG(sb10);
 DECL_FONT_REG(tt10);
 
+/**
+ * ALPHABET FONT TABLES
+ * Compiled from res/greek and res/cyrillic, see prebuilt/alphabet_def.py
+ */
+DECL_FONT_REG(fcmbipg);
+DECL_FONT_REG(fcmbpg);
+DECL_FONT_REG(fcmripg);
+DECL_FONT_REG(fcmrpg);
+DECL_FONT_REG(fcsbpg);
+DECL_FONT_REG(fcsropg);
+DECL_FONT_REG(fcsrpg);
+DECL_FONT_REG(fctrpg);
+DECL_FONT_REG(wnr10);
+DECL_FONT_REG(wnti10);
+DECL_FONT_REG(wntt10);
+DECL_FONT_REG(wnss10);
+DECL_FONT_REG(wnssi10);
+DECL_FONT_REG(wnssbx10);
+DECL_FONT_REG(wnbx10);
+DECL_FONT_REG(wnbxti10);
+
 namespace tex {
 
 DECL_FONT_SET(Builtin);
 
+DECL_FONT_SET(Greek);
+
+DECL_FONT_SET(Cyrillic);
+
 }  // namespace tex
 
 #endif
@@ -9,6 +9,10 @@ DECL_SYMBOLS_REG(amsfonts);
 DECL_SYMBOLS_REG(stmaryrd);
 DECL_SYMBOLS_REG(special);
 
+// the symbols of the alphabets, registered once the alphabet is loaded
+DECL_SYMBOLS_REG(greek);
+DECL_SYMBOLS_REG(cyrillic);
+
 namespace tex {
 
 DECL_SYMBOLS_SET(Builtin);
@@ -0,0 +1,303 @@
+#include "res/alphabet_def.res.h"
+
+DEF_ALPHABET(cyrillic)
+
+SYMBOLS_START
+E(wnr10, 305, "dotlessi")
+E(wnr10, 1040, "CYRA")
+E(wnr10, 1041, "CYRB")
+E(wnr10, 1042, "CYRV")
+E(wnr10, 1043, "CYRG")
+E(wnr10, 1044, "CYRD")
+E(wnr10, 1045, "CYRE")
+E(wnr10, 1025, "CYRYO")
+E(wnr10, 1046, "CYRZH")
+E(wnr10, 1047, "CYRZ")
+E(wnr10, 1048, "CYRI")
+E(wnr10, 1049, "CYRIO")
+E(wnr10, 1050, "CYRK")
+E(wnr10, 1051, "CYRL")
+E(wnr10, 1052, "CYRM")
+E(wnr10, 1053, "CYRN")
+E(wnr10, 1054, "CYRO")
+E(wnr10, 1055, "CYRP")
+E(wnr10, 1056, "CYRR")
+E(wnr10, 1057, "CYRS")
+E(wnr10, 1058, "CYRT")
+E(wnr10, 1059, "CYRU")
+E(wnr10, 1060, "CYRF")
+E(wnr10, 1061, "CYRH")
+E(wnr10, 1062, "CYRC")
+E(wnr10, 1063, "CYRCH")
+E(wnr10, 1064, "CYRSH")
+E(wnr10, 1065, "CYRSHCH")
+E(wnr10, 1066, "CYRHRDSN")
+E(wnr10, 1067, "CYRY")
+E(wnr10, 1068, "CYRSFTSN")
+E(wnr10, 1069, "CYREREV")
+E(wnr10, 1070, "CYRYU")
+E(wnr10, 1071, "CYRYA")
+E(wnr10, 1072, "cyra")
+E(wnr10, 1073, "cyrb")
+E(wnr10, 1074, "cyrv")
+E(wnr10, 1075, "cyrg")
+E(wnr10, 1076, "cyrd")
+E(wnr10, 1077, "cyre")
+E(wnr10, 1105, "cyryo")
+E(wnr10, 1078, "cyrzh")
+E(wnr10, 1079, "cyrz")
+E(wnr10, 1080, "cyri")
+E(wnr10, 1081, "cyrio")
+E(wnr10, 1082, "cyrk")
+E(wnr10, 1083, "cyrl")
+E(wnr10, 1084, "cyrm")
+E(wnr10, 1085, "cyrn")
+E(wnr10, 1086, "cyro")
+E(wnr10, 1087, "cyrp")
+E(wnr10, 1088, "cyrr")
+E(wnr10, 1089, "cyrs")
+E(wnr10, 1090, "cyrt")
+E(wnr10, 1091, "cyru")
+E(wnr10, 1092, "cyrf")
+E(wnr10, 1093, "cyrh")
+E(wnr10, 1094, "cyrc")
+E(wnr10, 1095, "cyrch")
+E(wnr10, 1096, "cyrsh")
+E(wnr10, 1097, "cyrshch")
+E(wnr10, 1098, "cyrhrdsn")
+E(wnr10, 1099, "cyry")
+E(wnr10, 1100, "cyrsftsn")
+E(wnr10, 1101, "cyrerev")
+E(wnr10, 1102, "cyryu")
+E(wnr10, 1103, "cyrya")
+E(wnr10, 1028, "CYRIE")
+E(wnr10, 1030, "CYRII")
+E(wnr10, 1108, "cyrie")
+E(wnr10, 1110, "cyrii")
+E(wnr10, 1026, "CYRDJE")
+E(wnr10, 1029, "CYRDZE")
+E(wnr10, 1032, "CYRJE")
+E(wnr10, 1033, "CYRLJE")
+E(wnr10, 1034, "CYRNJE")
+E(wnr10, 1035, "CYRTSHE")
+E(wnr10, 1039, "CYRDZHE")
+E(wnr10, 1140, "CYRIZH")
+E(wnr10, 1122, "CYRYAT")
+E(wnr10, 1138, "CYRFITA")
+E(wnr10, 1106, "cyrdje")
+E(wnr10, 1109, "cyrdze")
+E(wnr10, 1112, "cyrje")
+E(wnr10, 1113, "cyrlje")
+E(wnr10, 1114, "cyrnje")
+E(wnr10, 1115, "cyrtshe")
+E(wnr10, 1119, "cyrdzhe")
+E(wnr10, 1141, "cyrizh")
+E(wnr10, 1123, "cyryat")
+E(wnr10, 1139, "cyrfita")
+E(wnr10, 774, "cyrbreve")
+E(wnr10, 776, "cyrddot")
+SYMBOLS_END
+
+sym(ord, "dotlessi")
+sym(acc, "cyrbreve")
+sym(acc, "cyrddot")
+sym(ord, "CYRA")
+sym(ord, "CYRB")
+sym(ord, "CYRV")
+sym(ord, "CYRG")
+sym(ord, "CYRD")
+sym(ord, "CYRE")
+sym(ord, "CYRYO")
+sym(ord, "CYRZH")
+sym(ord, "CYRZ")
+sym(ord, "CYRE")
+sym(ord, "CYRI")
+sym(ord, "CYRIO")
+sym(ord, "CYRK")
+sym(ord, "CYRL")
+sym(ord, "CYRM")
+sym(ord, "CYRN")
+sym(ord, "CYRO")
+sym(ord, "CYRP")
+sym(ord, "CYRR")
+sym(ord, "CYRS")
+sym(ord, "CYRT")
+sym(ord, "CYRU")
+sym(ord, "CYRF")
+sym(ord, "CYRH")
+sym(ord, "CYRC")
+sym(ord, "CYRCH")
+sym(ord, "CYRSH")
+sym(ord, "CYRSHCH")
+sym(ord, "CYRHRDSN")
+sym(ord, "CYRY")
+sym(ord, "CYRSFTSN")
+sym(ord, "CYREREV")
+sym(ord, "CYRYU")
+sym(ord, "CYRYA")
+sym(ord, "cyra")
+sym(ord, "cyrb")
+sym(ord, "cyrv")
+sym(ord, "cyrg")
+sym(ord, "cyrd")
+sym(ord, "cyre")
+sym(ord, "cyryo")
+sym(ord, "cyrzh")
+sym(ord, "cyrz")
+sym(ord, "cyre")
+sym(ord, "cyri")
+sym(ord, "cyrio")
+sym(ord, "cyrk")
+sym(ord, "cyrl")
+sym(ord, "cyrm")
+sym(ord, "cyrn")
+sym(ord, "cyro")
+sym(ord, "cyrp")
+sym(ord, "cyrr")
+sym(ord, "cyrs")
+sym(ord, "cyrt")
+sym(ord, "cyru")
+sym(ord, "cyrf")
+sym(ord, "cyrh")
+sym(ord, "cyrc")
+sym(ord, "cyrch")
+sym(ord, "cyrsh")
+sym(ord, "cyrshch")
+sym(ord, "cyrhrdsn")
+sym(ord, "cyry")
+sym(ord, "cyrsftsn")
+sym(ord, "cyrerev")
+sym(ord, "cyryu")
+sym(ord, "cyrya")
+sym(ord, "CYRIE")
+sym(ord, "CYRII")
+sym(ord, "cyrie")
+sym(ord, "cyrii")
+sym(ord, "CYRDJE")
+sym(ord, "CYRDZE")
+sym(ord, "CYRJE")
+sym(ord, "CYRLJE")
+sym(ord, "CYRNJE")
+sym(ord, "CYRTSHE")
+sym(ord, "CYRDZHE")
+sym(ord, "CYRIZH")
+sym(ord, "CYRYAT")
+sym(ord, "CYRFITA")
+sym(ord, "cyrdje")
+sym(ord, "cyrdze")
+sym(ord, "cyrje")
+sym(ord, "cyrlje")
+sym(ord, "cyrnje")
+sym(ord, "cyrtshe")
+sym(ord, "cyrdzhe")
+sym(ord, "cyrizh")
+sym(ord, "cyryat")
+sym(ord, "cyrfita")
+
+C(305, "dotlessi")
+C(1040, "CYRA")
+C(1041, "CYRB")
+C(1042, "CYRV")
+C(1043, "CYRG")
+C(1044, "CYRD")
+C(1045, "CYRE")
+C(1025, "CYRYO")
+C(1046, "CYRZH")
+C(1047, "CYRZ")
+C(1048, "CYRI")
+C(1049, "CYRIO")
+C(1050, "CYRK")
+C(1051, "CYRL")
+C(1052, "CYRM")
+C(1053, "CYRN")
+C(1054, "CYRO")
+C(1055, "CYRP")
+C(1056, "CYRR")
+C(1057, "CYRS")
+C(1058, "CYRT")
+C(1059, "CYRU")
+C(1060, "CYRF")
+C(1061, "CYRH")
+C(1062, "CYRC")
+C(1063, "CYRCH")
+C(1064, "CYRSH")
+C(1065, "CYRSHCH")
+C(1066, "CYRHRDSN")
+C(1067, "CYRY")
+C(1068, "CYRSFTSN")
+C(1069, "CYREREV")
+C(1070, "CYRYU")
+C(1071, "CYRYA")
+C(1072, "cyra")
+C(1073, "cyrb")
+C(1074, "cyrv")
+C(1075, "cyrg")
+C(1076, "cyrd")
+C(1077, "cyre")
+C(1105, "cyryo")
+C(1078, "cyrzh")
+C(1079, "cyrz")
+C(1080, "cyri")
+C(1081, "cyrio")
+C(1082, "cyrk")
+C(1083, "cyrl")
+C(1084, "cyrm")
+C(1085, "cyrn")
+C(1086, "cyro")
+C(1087, "cyrp")
+C(1088, "cyrr")
+C(1089, "cyrs")
+C(1090, "cyrt")
+C(1091, "cyru")
+C(1092, "cyrf")
+C(1093, "cyrh")
+C(1094, "cyrc")
+C(1095, "cyrch")
+C(1096, "cyrsh")
+C(1097, "cyrshch")
+C(1098, "cyrhrdsn")
+C(1099, "cyry")
+C(1100, "cyrsftsn")
+C(1101, "cyrerev")
+C(1102, "cyryu")
+C(1103, "cyrya")
+C(1028, "CYRIE")
+C(1030, "CYRII")
+C(1108, "cyrie")
+C(1110, "cyrii")
+C(1026, "CYRDJE")
+C(1029, "CYRDZE")
+C(1032, "CYRJE")
+C(1033, "CYRLJE")
+C(1034, "CYRNJE")
+C(1035, "CYRTSHE")
+C(1039, "CYRDZHE")
+C(1140, "CYRIZH")
+C(1122, "CYRYAT")
+C(1138, "CYRFITA")
+C(1106, "cyrdje")
+C(1109, "cyrdze")
+C(1112, "cyrje")
+C(1113, "cyrlje")
+C(1114, "cyrnje")
+C(1115, "cyrtshe")
+C(1119, "cyrdzhe")
+C(1141, "cyrizh")
+C(1123, "cyryat")
+C(1139, "cyrfita")
+
+F(1024, "\\`\\CYRE")
+F(1027, "\\'\\CYRG")
+F(1031, "\\cyrddot\\CYRII")
+F(1111, "\\cyrddot\\dotlessi")
+F(1027, "\\'\\CYRG")
+F(1027, "\\'\\CYRK")
+F(1037, "\\`\\CYRI")
+F(1038, "\\cyrbreve\\CYRU")
+F(1104, "\\`\\cyre")
+F(1107, "\\'\\cyrg")
+F(1116, "\\'\\cyrk")
+F(1117, "\\`\\cyri")
+F(1118, "\\cyrbreve\\cyru")
+
+END_DEF_ALPHABET
@@ -0,0 +1,682 @@
+#include "res/alphabet_def.res.h"
+
+DEF_ALPHABET(greek)
+
+SYMBOLS_START
+E(fcmrpg, 884, "ʹ")
+E(fcmrpg, 885, "͵")
+E(fcmrpg, 890, "ͺ")
+E(fcmrpg, 900, "΄")
+E(fcmrpg, 901, "΅")
+E(fcmrpg, 903, "·")
+E(fcmrpg, 912, "ΐ")
+E(fcmrpg, 913, "Α")
+E(fcmrpg, 914, "Β")
+E(fcmrpg, 915, "Γ")
+E(fcmrpg, 916, "Δ")
+E(fcmrpg, 917, "Ε")
+E(fcmrpg, 918, "Ζ")
+E(fcmrpg, 919, "Η")
+E(fcmrpg, 920, "Θ")
+E(fcmrpg, 921, "Ι")
+E(fcmrpg, 922, "Κ")
+E(fcmrpg, 923, "Λ")
+E(fcmrpg, 924, "Μ")
+E(fcmrpg, 925, "Ν")
+E(fcmrpg, 926, "Ξ")
+E(fcmrpg, 927, "Ο")
+E(fcmrpg, 928, "Π")
+E(fcmrpg, 929, "Ρ")
+E(fcmrpg, 931, "Σ")
+E(fcmrpg, 932, "Τ")
+E(fcmrpg, 933, "Υ")
+E(fcmrpg, 934, "Φ")
+E(fcmrpg, 935, "Χ")
+E(fcmrpg, 936, "Ψ")
+E(fcmrpg, 937, "Ω")
+E(fcmrpg, 938, "Ϊ")
+E(fcmrpg, 939, "Ϋ")
+E(fcmrpg, 940, "ά")
+E(fcmrpg, 941, "έ")
+E(fcmrpg, 942, "ή")
+E(fcmrpg, 943, "ί")
+E(fcmrpg, 944, "ΰ")
+E(fcmrpg, 945, "α")
+E(fcmrpg, 946, "β")
+E(fcmrpg, 947, "γ")
+E(fcmrpg, 948, "δ")
+E(fcmrpg, 949, "ε")
+E(fcmrpg, 950, "ζ")
+E(fcmrpg, 951, "η")
+E(fcmrpg, 952, "θ")
+E(fcmrpg, 953, "ι")
+E(fcmrpg, 954, "κ")
+E(fcmrpg, 955, "λ")
+E(fcmrpg, 956, "μ")
+E(fcmrpg, 957, "ν")
+E(fcmrpg, 958, "ξ")
+E(fcmrpg, 959, "ο")
+E(fcmrpg, 960, "π")
+E(fcmrpg, 961, "ρ")
+E(fcmrpg, 962, "ς")
+E(fcmrpg, 963, "σ")
+E(fcmrpg, 964, "τ")
+E(fcmrpg, 965, "υ")
+E(fcmrpg, 966, "φ")
+E(fcmrpg, 967, "χ")
+E(fcmrpg, 968, "ψ")
+E(fcmrpg, 969, "ω")
+E(fcmrpg, 970, "ϊ")
+E(fcmrpg, 971, "ϋ")
+E(fcmrpg, 972, "ό")
+E(fcmrpg, 973, "ύ")
+E(fcmrpg, 974, "ώ")
+E(fcmrpg, 977, "ϑ")
+E(fcmrpg, 984, "Ϙ")
+E(fcmrpg, 985, "ϙ")
+E(fcmrpg, 986, "Ϛ")
+E(fcmrpg, 987, "ϛ")
+E(fcmrpg, 988, "Ϝ")
+E(fcmrpg, 989, "ϝ")
+E(fcmrpg, 991, "ϟ")
+E(fcmrpg, 992, "Ϡ")
+E(fcmrpg, 993, "ϡ")
+E(fcmrpg, 7936, "ἀ")
+E(fcmrpg, 7937, "ἁ")
+E(fcmrpg, 7938, "ἂ")
+E(fcmrpg, 7939, "ἃ")
+E(fcmrpg, 7940, "ἄ")
+E(fcmrpg, 7941, "ἅ")
+E(fcmrpg, 7942, "ἆ")
+E(fcmrpg, 7943, "ἇ")
+E(fcmrpg, 7952, "ἐ")
+E(fcmrpg, 7953, "ἑ")
+E(fcmrpg, 7954, "ἒ")
+E(fcmrpg, 7955, "ἓ")
+E(fcmrpg, 7956, "ἔ")
+E(fcmrpg, 7957, "ἕ")
+E(fcmrpg, 7968, "ἠ")
+E(fcmrpg, 7969, "ἡ")
+E(fcmrpg, 7970, "ἢ")
+E(fcmrpg, 7971, "ἣ")
+E(fcmrpg, 7972, "ἤ")
+E(fcmrpg, 7973, "ἥ")
+E(fcmrpg, 7974, "ἦ")
+E(fcmrpg, 7975, "ἧ")
+E(fcmrpg, 7984, "ἰ")
+E(fcmrpg, 7985, "ἱ")
+E(fcmrpg, 7986, "ἲ")
+E(fcmrpg, 7987, "ἳ")
+E(fcmrpg, 7988, "ἴ")
+E(fcmrpg, 7989, "ἵ")
+E(fcmrpg, 7990, "ἶ")
+E(fcmrpg, 7991, "ἷ")
+E(fcmrpg, 8000, "ὀ")
+E(fcmrpg, 8001, "ὁ")
+E(fcmrpg, 8002, "ὂ")
+E(fcmrpg, 8003, "ὃ")
+E(fcmrpg, 8004, "ὄ")
+E(fcmrpg, 8005, "ὅ")
+E(fcmrpg, 8016, "ὐ")
+E(fcmrpg, 8017, "ὑ")
+E(fcmrpg, 8018, "ὒ")
+E(fcmrpg, 8019, "ὓ")
+E(fcmrpg, 8020, "ὔ")
+E(fcmrpg, 8021, "ὕ")
+E(fcmrpg, 8022, "ὖ")
+E(fcmrpg, 8023, "ὗ")
+E(fcmrpg, 8032, "ὠ")
+E(fcmrpg, 8033, "ὡ")
+E(fcmrpg, 8034, "ὢ")
+E(fcmrpg, 8035, "ὣ")
+E(fcmrpg, 8036, "ὤ")
+E(fcmrpg, 8037, "ὥ")
+E(fcmrpg, 8038, "ὦ")
+E(fcmrpg, 8039, "ὧ")
+E(fcmrpg, 8048, "ὰ")
+E(fcmrpg, 8050, "ὲ")
+E(fcmrpg, 8052, "ὴ")
+E(fcmrpg, 8054, "ὶ")
+E(fcmrpg, 8056, "ὸ")
+E(fcmrpg, 8058, "ὺ")
+E(fcmrpg, 8060, "ὼ")
+E(fcmrpg, 8064, "ᾀ")
+E(fcmrpg, 8065, "ᾁ")
+E(fcmrpg, 8066, "ᾂ")
+E(fcmrpg, 8067, "ᾃ")
+E(fcmrpg, 8068, "ᾄ")
+E(fcmrpg, 8069, "ᾅ")
+E(fcmrpg, 8070, "ᾆ")
+E(fcmrpg, 8071, "ᾇ")
+E(fcmrpg, 8080, "ᾐ")
+E(fcmrpg, 8081, "ᾑ")
+E(fcmrpg, 8082, "ᾒ")
+E(fcmrpg, 8083, "ᾓ")
+E(fcmrpg, 8084, "ᾔ")
+E(fcmrpg, 8085, "ᾕ")
+E(fcmrpg, 8086, "ᾖ")
+E(fcmrpg, 8087, "ᾗ")
+E(fcmrpg, 8096, "ᾠ")
+E(fcmrpg, 8097, "ᾡ")
+E(fcmrpg, 8098, "ᾢ")
+E(fcmrpg, 8099, "ᾣ")
+E(fcmrpg, 8100, "ᾤ")
+E(fcmrpg, 8101, "ᾥ")
+E(fcmrpg, 8102, "ᾦ")
+E(fcmrpg, 8103, "ᾧ")
+E(fcmrpg, 8114, "ᾲ")
+E(fcmrpg, 8115, "ᾳ")
+E(fcmrpg, 8116, "ᾴ")
+E(fcmrpg, 8118, "ᾶ")
+E(fcmrpg, 8119, "ᾷ")
+E(fcmrpg, 8124, "ᾼ")
+E(fcmrpg, 8126, "ι")
+E(fcmrpg, 8127, "᾿")
+E(fcmrpg, 8128, "῀")
+E(fcmrpg, 8129, "῁")
+E(fcmrpg, 8130, "ῂ")
+E(fcmrpg, 8131, "ῃ")
+E(fcmrpg, 8132, "ῄ")
+E(fcmrpg, 8134, "ῆ")
+E(fcmrpg, 8135, "ῇ")
+E(fcmrpg, 8140, "ῌ")
+E(fcmrpg, 8141, "῍")
+E(fcmrpg, 8142, "῎")
+E(fcmrpg, 8143, "῏")
+E(fcmrpg, 8146, "ῒ")
+E(fcmrpg, 8150, "ῖ")
+E(fcmrpg, 8151, "ῗ")
+E(fcmrpg, 8157, "῝")
+E(fcmrpg, 8158, "῞")
+E(fcmrpg, 8159, "῟")
+E(fcmrpg, 8162, "ῢ")
+E(fcmrpg, 8164, "ῤ")
+E(fcmrpg, 8165, "ῥ")
+E(fcmrpg, 8166, "ῦ")
+E(fcmrpg, 8167, "ῧ")
+E(fcmrpg, 8173, "῭")
+E(fcmrpg, 8175, "`")
+E(fcmrpg, 8178, "ῲ")
+E(fcmrpg, 8179, "ῳ")
+E(fcmrpg, 8180, "ῴ")
+E(fcmrpg, 8182, "ῶ")
+E(fcmrpg, 8183, "ῷ")
+E(fcmrpg, 8188, "ῼ")
+E(fcmrpg, 8190, "῾")
+E(fcmrpg, 8217, "’")
+SYMBOLS_END
+
+sym(acc, "ʹ")
+sym(acc, "͵")
+sym(acc, "ͺ")
+sym(acc, "΄")
+sym(acc, "΅")
+sym(acc, "·")
+sym(ord, "ΐ")
+sym(ord, "Α")
+sym(ord, "Β")
+sym(ord, "Γ")
+sym(ord, "Δ")
+sym(ord, "Ε")
+sym(ord, "Ζ")
+sym(ord, "Η")
+sym(ord, "Θ")
+sym(ord, "Ι")
+sym(ord, "Κ")
+sym(ord, "Λ")
+sym(ord, "Μ")
+sym(ord, "Ν")
+sym(ord, "Ξ")
+sym(ord, "Ο")
+sym(ord, "Π")
+sym(ord, "Ρ")
+sym(ord, "Σ")
+sym(ord, "Τ")
+sym(ord, "Υ")
+sym(ord, "Φ")
+sym(ord, "Χ")
+sym(ord, "Ψ")
+sym(ord, "Ω")
+sym(ord, "Ϊ")
+sym(ord, "Ϋ")
+sym(ord, "ά")
+sym(ord, "έ")
+sym(ord, "ή")
+sym(ord, "ί")
+sym(ord, "ΰ")
+sym(ord, "α")
+sym(ord, "β")
+sym(ord, "γ")
+sym(ord, "δ")
+sym(ord, "ε")
+sym(ord, "ζ")
+sym(ord, "η")
+sym(ord, "θ")
+sym(ord, "ι")
+sym(ord, "κ")
+sym(ord, "λ")
+sym(ord, "μ")
+sym(ord, "ν")
+sym(ord, "ξ")
+sym(ord, "ο")
+sym(ord, "π")
+sym(ord, "ρ")
+sym(ord, "ς")
+sym(ord, "σ")
+sym(ord, "τ")
+sym(ord, "υ")
+sym(ord, "φ")
+sym(ord, "χ")
+sym(ord, "ψ")
+sym(ord, "ω")
+sym(ord, "ϊ")
+sym(ord, "ϋ")
+sym(ord, "ό")
+sym(ord, "ύ")
+sym(ord, "ώ")
+sym(ord, "ϑ")
+sym(ord, "Ϙ")
+sym(ord, "ϙ")
+sym(ord, "Ϛ")
+sym(ord, "ϛ")
+sym(ord, "Ϝ")
+sym(ord, "ϝ")
+sym(ord, "ϟ")
+sym(ord, "Ϡ")
+sym(ord, "ϡ")
+sym(ord, "ἀ")
+sym(ord, "ἁ")
+sym(ord, "ἂ")
+sym(ord, "ἃ")
+sym(ord, "ἄ")
+sym(ord, "ἅ")
+sym(ord, "ἆ")
+sym(ord, "ἇ")
+sym(ord, "ἐ")
+sym(ord, "ἑ")
+sym(ord, "ἒ")
+sym(ord, "ἓ")
+sym(ord, "ἔ")
+sym(ord, "ἕ")
+sym(ord, "ἠ")
+sym(ord, "ἡ")
+sym(ord, "ἢ")
+sym(ord, "ἣ")
+sym(ord, "ἤ")
+sym(ord, "ἥ")
+sym(ord, "ἦ")
+sym(ord, "ἧ")
+sym(ord, "ἰ")
+sym(ord, "ἱ")
+sym(ord, "ἲ")
+sym(ord, "ἳ")
+sym(ord, "ἴ")
+sym(ord, "ἵ")
+sym(ord, "ἶ")
+sym(ord, "ἷ")
+sym(ord, "ὀ")
+sym(ord, "ὁ")
+sym(ord, "ὂ")
+sym(ord, "ὃ")
+sym(ord, "ὄ")
+sym(ord, "ὅ")
+sym(ord, "ὐ")
+sym(ord, "ὑ")
+sym(ord, "ὒ")
+sym(ord, "ὓ")
+sym(ord, "ὔ")
+sym(ord, "ὕ")
+sym(ord, "ὖ")
+sym(ord, "ὗ")
+sym(ord, "ὠ")
+sym(ord, "ὡ")
+sym(ord, "ὢ")
+sym(ord, "ὣ")
+sym(ord, "ὤ")
+sym(ord, "ὥ")
+sym(ord, "ὦ")
+sym(ord, "ὧ")
+sym(ord, "ὰ")
+sym(ord, "ὲ")
+sym(ord, "ὴ")
+sym(ord, "ὶ")
+sym(ord, "ὸ")
+sym(ord, "ὺ")
+sym(ord, "ὼ")
+sym(ord, "ᾀ")
+sym(ord, "ᾁ")
+sym(ord, "ᾂ")
+sym(ord, "ᾃ")
+sym(ord, "ᾄ")
+sym(ord, "ᾅ")
+sym(ord, "ᾆ")
+sym(ord, "ᾇ")
+sym(ord, "ᾐ")
+sym(ord, "ᾑ")
+sym(ord, "ᾒ")
+sym(ord, "ᾓ")
+sym(ord, "ᾔ")
+sym(ord, "ᾕ")
+sym(ord, "ᾖ")
+sym(ord, "ᾗ")
+sym(ord, "ᾠ")
+sym(ord, "ᾡ")
+sym(ord, "ᾢ")
+sym(ord, "ᾣ")
+sym(ord, "ᾤ")
+sym(ord, "ᾥ")
+sym(ord, "ᾦ")
+sym(ord, "ᾧ")
+sym(ord, "ᾲ")
+sym(ord, "ᾳ")
+sym(ord, "ᾴ")
+sym(ord, "ᾶ")
+sym(ord, "ᾷ")
+sym(ord, "ᾼ")
+sym(acc, "ι")
+sym(acc, "᾿")
+sym(acc, "῀")
+sym(acc, "῁")
+sym(ord, "ῂ")
+sym(ord, "ῃ")
+sym(ord, "ῄ")
+sym(ord, "ῆ")
+sym(ord, "ῇ")
+sym(ord, "ῌ")
+sym(acc, "῍")
+sym(acc, "῎")
+sym(acc, "῏")
+sym(ord, "ῒ")
+sym(ord, "ῖ")
+sym(ord, "ῗ")
+sym(acc, "῝")
+sym(acc, "῞")
+sym(acc, "῟")
+sym(ord, "ῢ")
+sym(ord, "ῤ")
+sym(ord, "ῥ")
+sym(ord, "ῦ")
+sym(ord, "ῧ")
+sym(acc, "῭")
+sym(acc, "`")
+sym(ord, "ῲ")
+sym(ord, "ῳ")
+sym(ord, "ῴ")
+sym(ord, "ῶ")
+sym(ord, "ῷ")
+sym(ord, "ῼ")
+sym(acc, "῾")
+sym(acc, "’")
+
+C(884, "ʹ")
+C(885, "͵")
+C(890, "ͺ")
+C(900, "΄")
+C(901, "΅")
+C(903, "·")
+C(912, "ΐ")
+C(938, "Ϊ")
+C(939, "Ϋ")
+C(940, "ά")
+C(941, "έ")
+C(942, "ή")
+C(943, "ί")
+C(944, "ΰ")
+C(970, "ϊ")
+C(971, "ϋ")
+C(972, "ό")
+C(973, "ύ")
+C(974, "ώ")
+C(984, "Ϙ")
+C(985, "ϙ")
+C(986, "Ϛ")
+C(987, "ϛ")
+C(988, "Ϝ")
+C(989, "ϝ")
+C(991, "ϟ")
+C(992, "Ϡ")
+C(993, "ϡ")
+C(7936, "ἀ")
+C(7937, "ἁ")
+C(7938, "ἂ")
+C(7939, "ἃ")
+C(7940, "ἄ")
+C(7941, "ἅ")
+C(7942, "ἆ")
+C(7943, "ἇ")
+C(7952, "ἐ")
+C(7953, "ἑ")
+C(7954, "ἒ")
+C(7955, "ἓ")
+C(7956, "ἔ")
+C(7957, "ἕ")
+C(7968, "ἠ")
+C(7969, "ἡ")
+C(7970, "ἢ")
+C(7971, "ἣ")
+C(7972, "ἤ")
+C(7973, "ἥ")
+C(7974, "ἦ")
+C(7975, "ἧ")
+C(7984, "ἰ")
+C(7985, "ἱ")
+C(7986, "ἲ")
+C(7987, "ἳ")
+C(7988, "ἴ")
+C(7989, "ἵ")
+C(7990, "ἶ")
+C(7991, "ἷ")
+C(8000, "ὀ")
+C(8001, "ὁ")
+C(8002, "ὂ")
+C(8003, "ὃ")
+C(8004, "ὄ")
+C(8005, "ὅ")
+C(8016, "ὐ")
+C(8017, "ὑ")
+C(8018, "ὒ")
+C(8019, "ὓ")
+C(8020, "ὔ")
+C(8021, "ὕ")
+C(8022, "ὖ")
+C(8023, "ὗ")
+C(8032, "ὠ")
+C(8033, "ὡ")
+C(8034, "ὢ")
+C(8035, "ὣ")
+C(8036, "ὤ")
+C(8037, "ὥ")
+C(8038, "ὦ")
+C(8039, "ὧ")
+C(8048, "ὰ")
+C(8050, "ὲ")
+C(8052, "ὴ")
+C(8054, "ὶ")
+C(8056, "ὸ")
+C(8058, "ὺ")
+C(8060, "ὼ")
+C(8064, "ᾀ")
+C(8065, "ᾁ")
+C(8066, "ᾂ")
+C(8067, "ᾃ")
+C(8068, "ᾄ")
+C(8069, "ᾅ")
+C(8070, "ᾆ")
+C(8071, "ᾇ")
+C(8080, "ᾐ")
+C(8081, "ᾑ")
+C(8082, "ᾒ")
+C(8083, "ᾓ")
+C(8084, "ᾔ")
+C(8085, "ᾕ")
+C(8086, "ᾖ")
+C(8087, "ᾗ")
+C(8096, "ᾠ")
+C(8097, "ᾡ")
+C(8098, "ᾢ")
+C(8099, "ᾣ")
+C(8100, "ᾤ")
+C(8101, "ᾥ")
+C(8102, "ᾦ")
+C(8103, "ᾧ")
+C(8114, "ᾲ")
+C(8115, "ᾳ")
+C(8116, "ᾴ")
+C(8118, "ᾶ")
+C(8119, "ᾷ")
+C(8124, "ᾼ")
+C(8125, "᾿")
+C(8126, "ι")
+C(8127, "᾿")
+C(8128, "῀")
+C(8129, "῁")
+C(8130, "ῂ")
+C(8131, "ῃ")
+C(8132, "ῄ")
+C(8134, "ῆ")
+C(8135, "ῇ")
+C(8140, "ῌ")
+C(8141, "῍")
+C(8142, "῎")
+C(8143, "῏")
+C(8146, "ῒ")
+C(8150, "ῖ")
+C(8151, "ῗ")
+C(8157, "῝")
+C(8158, "῞")
+C(8159, "῟")
+C(8162, "ῢ")
+C(8164, "ῤ")
+C(8165, "ῥ")
+C(8166, "ῦ")
+C(8167, "ῧ")
+C(8173, "῭")
+C(8174, "΅")
+C(8175, "`")
+C(8178, "ῲ")
+C(8179, "ῳ")
+C(8180, "ῴ")
+C(8182, "ῶ")
+C(8183, "ῷ")
+C(8188, "ῼ")
+C(8189, "ʹ")
+C(8190, "῾")
+C(8217, "’")
+
+F(902, "\\grkaccent{ʹ}{\\phantom{ι}}\\!\\!A")
+F(904, "\\grkaccent{ʹ}{\\phantom{ι}}Ε")
+F(905, "\\grkaccent{ʹ}{\\phantom{ι}}H")
+F(906, "\\grkaccent{ʹ}{\\phantom{ι}}Ι")
+F(908, "\\grkaccent{ʹ}{\\phantom{ι}}\\!Ο")
+F(910, "\\grkaccent{ʹ}{\\phantom{ι}}Υ")
+F(911, "\\grkaccent{ʹ}{\\phantom{ι}}\\!Ω")
+F(7944, "’Α")
+F(7945, "῾Α")
+F(7946, "῍Α")
+F(7947, "῝Α")
+F(7948, "῎Α")
+F(7949, "῞Α")
+F(7950, "῏Α")
+F(7951, "῟Α")
+F(7960, "’Ε")
+F(7961, "῾Ε")
+F(7962, "῍Ε")
+F(7963, "῝Ε")
+F(7964, "῎Ε")
+F(7965, "῞Ε")
+F(7976, "’Η")
+F(7977, "῾Η")
+F(7978, "῍Η")
+F(7979, "῝Η")
+F(7980, "῎Η")
+F(7981, "῞Η")
+F(7982, "῏Η")
+F(7983, "῟Η")
+F(7992, "’Ι")
+F(7993, "῾Ι")
+F(7994, "῍Ι")
+F(7995, "῝Ι")
+F(7996, "῎Ι")
+F(7997, "῞Ι")
+F(7998, "῏Ι")
+F(7999, "῟Ι")
+F(8008, "’Ο")
+F(8009, "῾Ο")
+F(8010, "῍Ο")
+F(8011, "῝Ο")
+F(8012, "῎Ο")
+F(8013, "῞Ο")
+F(8025, "῾Υ")
+F(8026, "῝Υ")
+F(8027, "῞Υ")
+F(8028, "῟Υ")
+F(8040, "’Ω")
+F(8041, "῾Ω")
+F(8042, "῍Ω")
+F(8043, "῝Ω")
+F(8044, "῎Ω")
+F(8045, "῞Ω")
+F(8046, "῏Ω")
+F(8047, "῟Ω")
+F(8049, "\\grkaccent{΄}α")
+F(8051, "\\grkaccent{΄}ε")
+F(8053, "\\grkaccent{΄}η")
+F(8055, "\\grkaccent{΄}ι")
+F(8057, "\\grkaccent{΄}ο")
+F(8059, "\\grkaccent{΄}υ")
+F(8061, "\\grkaccent{΄}ω")
+F(8072, "’ᾼ")
+F(8073, "῾ᾼ")
+F(8074, "῍ᾼ")
+F(8075, "῝ᾼ")
+F(8076, "῎ᾼ")
+F(8077, "῞ᾼ")
+F(8078, "῏ᾼ")
+F(8079, "῟ᾼ")
+F(8088, "’ῌ")
+F(8089, "῾ῌ")
+F(8090, "῍ῌ")
+F(8091, "῝ῌ")
+F(8092, "῎ῌ")
+F(8093, "῞ῌ")
+F(8094, "῏ῌ")
+F(8095, "῟ῌ")
+F(8100, "\\grkaccent{῎}ῳ")
+F(8104, "’ῼ")
+F(8105, "῾ῼ")
+F(8106, "῍ῼ")
+F(8107, "῝ῼ")
+F(8108, "῎ῼ")
+F(8109, "῞ῼ")
+F(8110, "῏ῼ")
+F(8111, "῟ῼ")
+F(8112, "\\u α")
+F(8113, "\\= α")
+F(8120, "\\u Α")
+F(8121, "\\= Α")
+F(8122, "\\grkaccent{`}{\\vphantom{ι}}Α")
+F(8123, "\\grkaccent{ʹ}{\\vphantom{ι}}\\!\\!Α")
+F(8136, "\\grkaccent{`}{\\vphantom{ι}}Ε")
+F(8137, "\\grkaccent{ʹ}{\\vphantom{ι}}Ε")
+F(8138, "\\grkaccent{`}{\\vphantom{ι}}Η")
+F(8139, "\\grkaccent{ʹ}{\\vphantom{ι}}Η")
+F(8144, "\\u ι")
+F(8145, "\\= ι")
+F(8147, "\\grkaccent{΅}ι")
+F(8152, "\\u Ι")
+F(8153, "\\= Ι")
+F(8154, "\\grkaccent{`}{\\phantom{ι}}Ι")
+F(8155, "\\grkaccent{ʹ}{\\phantom{ι}}Ι")
+F(8160, "\\u υ")
+F(8161, "\\= υ")
+F(8163, "\\grkaccent{΅}υ")
+F(8168, "\\u Υ")
+F(8169, "\\= Υ")
+F(8170, "\\grkaccent{`}{\\phantom{ι}}Υ")
+F(8171, "\\grkaccent{ʹ}{\\phantom{ι}}Υ")
+F(8184, "\\grkaccent{`}{\\vphantom{ι}}Ο")
+F(8185, "\\grkaccent{ʹ}{\\vphantom{ι}}\\!Ο")
+F(8186, "\\grkaccent{`}{\\vphantom{ι}}Ω")
+F(8187, "\\grkaccent{ʹ}{\\vphantom{ι}}\\!Ω")
+
+END_DEF_ALPHABET
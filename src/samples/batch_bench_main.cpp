@@ -0,0 +1,71 @@
+#include "config.h"
+
+#if defined(CLATEX_USE_SAMPLES) && !defined(MEM_CHECK)
+
+#include "latex.h"
+#include "samples/graphic_null.h"
+#include "samples/samples.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+using namespace std;
+using namespace tex;
+
+/**
+ * Measure the throughput of LaTeX::parseBatch with 1, 2, 4 and N (as many as
+ * the hardware supports) threads.
+ *
+ * Usage: LaTeXBatchBench [repeat] [samples file]
+ *
+ * The samples (res/SAMPLES.tex by default) are repeated 'repeat' (default 20)
+ * times to make up the batch.
+ */
+int main(int argc, char* argv[]) {
+  const int repeat = argc > 1 ? max(1, atoi(argv[1])) : 20;
+  LaTeX::init();
+
+  Samples samples(argc > 2 ? argv[2] : "");
+  vector<wstring> inputs;
+  for (int r = 0; r < repeat; r++) {
+    for (int i = 0; i < samples.count(); i++) inputs.push_back(samples.next());
+  }
+
+  BatchOptions options;
+  options.draw = [](size_t, TeXRender& render) {
+    Graphics2D_null g2;
+    render.draw(g2, 0, 0);
+  };
+
+  const size_t n = max(1u, thread::hardware_concurrency());
+  vector<size_t> threads = {1, 2, 4, n};
+  sort(threads.begin(), threads.end());
+  threads.erase(unique(threads.begin(), threads.end()), threads.end());
+
+  // warm up, load the fonts and the predefined formulas
+  LaTeX::parseBatch(inputs.data(), min(inputs.size(), (size_t) samples.count()), options);
+
+  printf("%zu formulas, %zu hardware threads\n", inputs.size(), n);
+  printf("%8s %12s %14s %8s %8s\n", "threads", "seconds", "formulas/s", "speedup", "errors");
+  double base = 0;
+  for (size_t t : threads) {
+    options.threads = t;
+    const auto start = chrono::steady_clock::now();
+    const auto results = LaTeX::parseBatch(inputs, options);
+    const chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+    const double secs = elapsed.count();
+    if (base == 0) base = secs;
+    const auto errors = count_if(results.begin(), results.end(), [](const BatchResult& r) {
+      return r.render == nullptr;
+    });
+    printf("%8zu %12.3f %14.1f %8.2f %8zu\n", t, secs, inputs.size() / secs, base / secs, (size_t) errors);
+  }
+
+  LaTeX::release();
+  return 0;
+}
+
+#endif  // CLATEX_USE_SAMPLES && !MEM_CHECK
@@ -0,0 +1,66 @@
+#ifndef GRAPHIC_NULL_H_INCLUDED
+#define GRAPHIC_NULL_H_INCLUDED
+
+#include "graphic/graphic.h"
+#include "graphic/graphic_basic.h"
+
+#include <string>
+
+namespace tex {
+
+/** A graphics context draws nothing, so the benchmark measures the library only. */
+class Graphics2D_null : public Graphics2D {
+private:
+  color _color;
+  Stroke _stroke;
+  const Font* _font;
+
+public:
+  Graphics2D_null() : _color(BLACK), _font(nullptr) {}
+
+  void setColor(color c) override { _color = c; }
+
+  color getColor() const override { return _color; }
+
+  void setStroke(const Stroke& s) override { _stroke = s; }
+
+  const Stroke& getStroke() const override { return _stroke; }
+
+  void setStrokeWidth(float w) override { _stroke.lineWidth = w; }
+
+  const Font* getFont() const override { return _font; }
+
+  void setFont(const Font* font) override { _font = font; }
+
+  void translate(float, float) override {}
+
+  void scale(float, float) override {}
+
+  void rotate(float) override {}
+
+  void rotate(float, float, float) override {}
+
+  void reset() override {}
+
+  float sx() const override { return 1.f; }
+
+  float sy() const override { return 1.f; }
+
+  void drawChar(wchar_t, float, float) override {}
+
+  void drawText(const std::wstring&, float, float) override {}
+
+  void drawLine(float, float, float, float) override {}
+
+  void drawRect(float, float, float, float) override {}
+
+  void fillRect(float, float, float, float) override {}
+
+  void drawRoundRect(float, float, float, float, float, float) override {}
+
+  void fillRoundRect(float, float, float, float, float, float) override {}
+};
+
+}  // namespace tex
+
+#endif  // GRAPHIC_NULL_H_INCLUDED
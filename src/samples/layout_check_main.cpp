@@ -0,0 +1,450 @@
+#include "config.h"
+
+#if defined(CLATEX_USE_SAMPLES) && !defined(MEM_CHECK)
+
+#include "latex.h"
+#include "samples/samples.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace tex;
+
+namespace tex {
+
+/**
+ * A graphics context writes down every drawing operation in device space, so
+ * two renders that write the same operations have laid out the same boxes.
+ */
+class Graphics2D_log : public Graphics2D {
+private:
+  // the transformation to device space: (a * x + c * y + e, b * x + d * y + f)
+  float _a, _b, _c, _d, _e, _f;
+  float _sx, _sy;
+  color _color;
+  Stroke _stroke;
+  const Font* _font;
+  std::string _log;
+
+  void begin(const char* op) {
+    char buf[96];
+    snprintf(
+      buf, sizeof(buf), "%s c=%08x w=%.3f s=%.3f",
+      op, (unsigned) _color, _stroke.lineWidth * _sx, _font == nullptr ? 0.f : _font->getSize() * _sx
+    );
+    _log += buf;
+  }
+
+  void point(float x, float y) {
+    char buf[64];
+    snprintf(buf, sizeof(buf), " %.3f %.3f", _a * x + _c * y + _e, _b * x + _d * y + _f);
+    _log += buf;
+  }
+
+  void shape(const char* op, float x, float y, float w, float h) {
+    begin(op);
+    point(x, y);
+    point(x + w, y + h);
+    _log += '\n';
+  }
+
+public:
+  Graphics2D_log() : _color(BLACK), _font(nullptr) { reset(); }
+
+  const std::string& log() const { return _log; }
+
+  void setColor(color c) override { _color = c; }
+
+  color getColor() const override { return _color; }
+
+  void setStroke(const Stroke& s) override { _stroke = s; }
+
+  const Stroke& getStroke() const override { return _stroke; }
+
+  void setStrokeWidth(float w) override { _stroke.lineWidth = w; }
+
+  const Font* getFont() const override { return _font; }
+
+  void setFont(const Font* font) override { _font = font; }
+
+  void translate(float dx, float dy) override {
+    _e += _a * dx + _c * dy;
+    _f += _b * dx + _d * dy;
+  }
+
+  void scale(float sx, float sy) override {
+    _a *= sx, _b *= sx, _c *= sy, _d *= sy;
+    _sx *= sx, _sy *= sy;
+  }
+
+  void rotate(float angle) override {
+    const float c = std::cos(angle), s = std::sin(angle);
+    const float a = _a * c + _c * s, b = _b * c + _d * s;
+    _c = _c * c - _a * s, _d = _d * c - _b * s;
+    _a = a, _b = b;
+  }
+
+  void rotate(float angle, float px, float py) override {
+    translate(px, py);
+    rotate(angle);
+    translate(-px, -py);
+  }
+
+  void reset() override {
+    _a = _d = _sx = _sy = 1.f;
+    _b = _c = _e = _f = 0.f;
+  }
+
+  float sx() const override { return _sx; }
+
+  float sy() const override { return _sy; }
+
+  void drawChar(wchar_t c, float x, float y) override {
+    begin("char");
+    _log += ' ' + std::to_string((int) c);
+    point(x, y);
+    _log += '\n';
+  }
+
+  void drawText(const std::wstring& c, float x, float y) override {
+    begin("text");
+    _log += ' ' + wide2utf8(c);
+    point(x, y);
+    _log += '\n';
+  }
+
+  void drawLine(float x1, float y1, float x2, float y2) override {
+    shape("line", x1, y1, x2 - x1, y2 - y1);
+  }
+
+  void drawRect(float x, float y, float w, float h) override { shape("rect", x, y, w, h); }
+
+  void fillRect(float x, float y, float w, float h) override { shape("fill-rect", x, y, w, h); }
+
+  void drawRoundRect(float x, float y, float w, float h, float, float) override {
+    shape("round-rect", x, y, w, h);
+  }
+
+  void fillRoundRect(float x, float y, float w, float h, float, float) override {
+    shape("fill-round-rect", x, y, w, h);
+  }
+};
+
+}  // namespace tex
+
+/** The formulas out of the samples that broke one of the layout paths once. */
+static const wchar_t* const FORMULAS[] = {
+  // a scripted middle delimiter, laid out before and after it is sized
+  L"\\left(\\frac{a}{b}\\middle|^2 c\\right)",
+  L"\\left(\\frac{a}{b}\\middle|^2 \\frac{a}{b}\\middle\\|_{\\frac{a}{b}}\\right)\\frac{a}{b}",
+  // identical groups in different environments
+  L"\\frac{x+1}{x+1} + {x+1}^{x+1} + \\sqrt{x+1} + \\text{x+1 $x+1$}",
+  // a cell as wide as \ldots, which uses the redefined \ldotp
+  L"\\newcommand{\\ldotp}{W}\\begin{matrix}a&\\ddots\\\\b&c\\end{matrix}",
+  L"\\newcommand{\\ldotp}{W}\\text{abc}\\ddots",
+};
+
+/**
+ * A matrix of \ddots and \iddots of the given size, laid out in parallel
+ * since it is large enough. Their cells are as wide as \ldots, which uses the
+ * macro \ldotp the formula redefines.
+ */
+static wstring dotsMatrix(int size) {
+  wstring latex = L"\\newcommand{\\ldotp}{W}\\begin{pmatrix}";
+  for (int i = 0; i < size; i++) {
+    for (int j = 0; j < size; j++) {
+      latex += (i + j) % 2 == 0 ? L"\\ddots" : L"\\iddots";
+      latex += j + 1 < size ? L"&" : L"\\\\";
+    }
+  }
+  return latex + L"\\end{pmatrix}";
+}
+
+/** An edit of the source of the incremental parse, see LaTeXContext::reparse. */
+struct Edit {
+  size_t offset, removed;
+  const wchar_t* inserted;
+};
+
+/**
+ * The edits of a live editor that go through the formulas failing to parse,
+ * the last edit of each makes the formula valid again.
+ */
+static const vector<vector<Edit>> EDITS = {
+  {{0, 0, L"{\\hdotsfor"}, {0, 0, L"x"}, {0, wstring::npos, L"x+{y}"}},
+  {
+    {0, 0, L"x_{\\newcommand{\\q}{Q}\\q} \\q"},
+    {14, 1, L"{z}"},
+    {14, 3, L"q"},
+    {14, 1, L"{"},
+  },
+  {{0, 0, L"\\frac{a}{\\sqrt{b"}, {wstring::npos, 0, L"}}"}},
+};
+
+/**
+ * The formulas that define macros used by the predefined formulas, and the
+ * formulas that use the predefined ones, parsed by another context.
+ */
+static const pair<const wchar_t*, const wchar_t*> REDEFINITIONS[] = {
+  {L"\\newcommand{\\quad}{Q}x\\qquad y", L"x\\qquad y"},
+};
+
+/**
+ * The formulas broken into lines at the narrow widths, the total fit must not
+ * overflow where filling the lines one by one does not. The last ones have
+ * a piece of text wider than some of the widths, the modes break them
+ * differently there.
+ */
+static const wchar_t* const BREAKING[] = {
+  L"1+2+3+4+5+6+7+8+9+10+11+12+13+14+15+16+17+18+19+20",
+  L"x=10+20+30+40+50+60+70+80+90+100",
+  L"\\text{the text with its spaces} 1+2+3+4+5+6+7+8",
+  L"1+2+3+\\text{Unbreakable}+4+5+6+7+8+9+10+11",
+  L"1+2+3+4+5+6+7+8+9+\\text{ThisTextIsWiderThanTheLine}+1+2+3+4",
+  L"\\text{unbreakable text wider than the line}+a+b+c+d+e+f+g+h+i+j",
+};
+
+/** The widths to break the formulas at, in pixels. */
+static const int NARROW_WIDTHS[] = {100, 150, 200, 300};
+
+/** The formulas that fail to parse, they are mixed with the others in a batch. */
+static const wchar_t* const MALFORMED[] = {
+  L"{\\hdotsfor",
+  L"x_{\\newcommand{z}{Q}}",
+  L"{x^{\\hdotsfor}}",
+  L"{a}}",
+};
+
+/** Write down the metrics and the drawing of the given render. */
+static string logOf(TeXRender& r) {
+  Graphics2D_log g2;
+  r.draw(g2, 0, 0);
+  return "width=" + to_string(r.getWidth())
+         + " height=" + to_string(r.getHeight())
+         + " depth=" + to_string(r.getDepth()) + '\n'
+         + g2.log();
+}
+
+/** Render the given formula and write down its metrics and its drawing, or the error. */
+static string render(const function<TeXRender*()>& parse) {
+  try {
+    TeXRender* r = parse();
+    const string log = logOf(*r);
+    delete r;
+    return log;
+  } catch (const std::exception& e) {
+    return string("error: ") + e.what() + '\n';
+  }
+}
+
+/** Get the given line of the given log, empty if out of it. */
+static string lineOf(const string& log, size_t line) {
+  size_t start = 0;
+  for (size_t i = 0; i < line && start != string::npos; i++) {
+    start = log.find('\n', start);
+    if (start != string::npos) start++;
+  }
+  if (start == string::npos || start >= log.size()) return "";
+  return log.substr(start, log.find('\n', start) - start);
+}
+
+/** Print the first line that differs between the expected and the actual logs. */
+static void printDiff(const string& expected, const string& actual) {
+  size_t line = 0, i = 0;
+  while (i < expected.size() && i < actual.size() && expected[i] == actual[i]) {
+    if (expected[i++] == '\n') line++;
+  }
+  printf("    line %zu\n", line + 1);
+  printf("    expected: %s\n", lineOf(expected, line).c_str());
+  printf("    actual:   %s\n", lineOf(actual, line).c_str());
+}
+
+/**
+ * Check that the optional layout paths lay the formulas out as the default
+ * one does: the memoized layout, the arena, the incremental reparse, the
+ * relayout of the retained atoms, the parallel layout of the matrix cells and
+ * the optimal line breaking. The formulas are the samples and a few formulas
+ * that broke one of them once. At the narrow widths, the optimal line breaking
+ * must fit wherever the greedy one does. The incremental parse and the batches
+ * must recover from the formulas that fail to parse, and the macros a context
+ * defines must not leak into the predefined formulas of the others.
+ *
+ * Usage: LaTeXLayoutCheck [samples file]
+ *
+ * Every formula is rendered by each path, its metrics and everything it
+ * draws must be the same as the default path. The exit status is the count
+ * of the formulas that differ, so it can run as a test.
+ */
+int main(int argc, char* argv[]) {
+  LaTeX::init();
+
+  Samples samples(argc > 1 ? argv[1] : "");
+  vector<wstring> formulas;
+  for (int i = 0; i < samples.count(); i++) formulas.push_back(samples.next());
+  for (const auto* f : FORMULAS) formulas.emplace_back(f);
+  formulas.push_back(dotsMatrix(8));
+
+  const int width = 720;
+  const float textSize = 20, lineSpace = 20 / 3.f;
+  LaTeXContext standard, memoized, arena, incremental, parallel, parallelShared, retained, optimal;
+  memoized.setMemoize(true);
+  arena.setUseArena(true);
+  incremental.setIncremental(true);
+  // every matrix is laid out in parallel, the workers memoize and allocate
+  // from an arena when the calling thread does
+  parallel.setParallelCells(1, 4);
+  parallelShared.setParallelCells(1, 4);
+  parallelShared.setMemoize(true);
+  parallelShared.setUseArena(true);
+  retained.setRetainAtoms(true);
+  optimal.setOptimalBreaking(true);
+
+  // the macros a formula defines are forgotten before the next one, as the
+  // incremental mode does
+  const auto parseWith = [&](LaTeXContext& context, const wstring& latex) {
+    return [&context, &latex, width, textSize, lineSpace]() {
+      context.clearMacros();
+      return context.parse(latex, width, textSize, lineSpace, BLACK);
+    };
+  };
+
+  int failures = 0;
+  vector<string> expectations;
+  for (size_t i = 0; i < formulas.size(); i++) {
+    const wstring& latex = formulas[i];
+    const string expected = render(parseWith(standard, latex));
+    expectations.push_back(expected);
+
+    vector<pair<const char*, string>> results;
+    results.emplace_back("memoize", render(parseWith(memoized, latex)));
+    results.emplace_back("arena", render(parseWith(arena, latex)));
+    // replace the source of the previous formula, then parse it again as is
+    results.emplace_back("incremental", render([&]() {
+      return incremental.reparse(0, wstring::npos, latex, width, textSize, lineSpace, BLACK);
+    }));
+    results.emplace_back("incremental (unchanged)", render([&]() {
+      return incremental.reparse(0, 0, L"", width, textSize, lineSpace, BLACK);
+    }));
+    // lay the retained atoms out with another width, then with the width again
+    results.emplace_back("relayout", render([&]() {
+      unique_ptr<TeXRender> r(parseWith(retained, latex)());
+      r->relayout(width / 4, lineSpace);
+      r->relayout(width, lineSpace);
+      return r.release();
+    }));
+    results.emplace_back("parallel cells", render(parseWith(parallel, latex)));
+    results.emplace_back("parallel cells (memoize, arena)", render(parseWith(parallelShared, latex)));
+    results.emplace_back("optimal breaking", render(parseWith(optimal, latex)));
+
+    bool same = true;
+    for (const auto& result : results) {
+      if (result.second == expected) continue;
+      if (same) printf("formula %zu: %s\n", i, wide2utf8(latex).c_str());
+      same = false;
+      printf("  %s differs from the default layout\n", result.first);
+      printDiff(expected, result.second);
+    }
+    if (!same) failures++;
+  }
+
+  // the edits must not break the incremental parse even if they fail
+  for (size_t i = 0; i < EDITS.size(); i++) {
+    LaTeXContext editor;
+    editor.setIncremental(true);
+    wstring source;
+    string actual;
+    for (const auto& edit : EDITS[i]) {
+      const size_t offset = min(edit.offset, source.length());
+      source.replace(offset, min(edit.removed, source.length() - offset), edit.inserted);
+      actual = render([&]() {
+        return editor.reparse(edit.offset, edit.removed, edit.inserted, width, textSize, lineSpace, BLACK);
+      });
+    }
+    const string expected = render(parseWith(standard, source));
+    if (actual == expected) continue;
+    printf("edits %zu: %s\n", i, wide2utf8(source).c_str());
+    printf("  incremental differs from the default layout after the edits\n");
+    printDiff(expected, actual);
+    failures++;
+  }
+
+  // the macros of a context must not leak into the predefined formulas of the
+  // other contexts, the predefined formulas are parsed on a new thread first
+  for (const auto& redefinition : REDEFINITIONS) {
+    const wstring definition = redefinition.first, latex = redefinition.second;
+    const string expected = render(parseWith(standard, latex));
+    string actual;
+    thread([&]() {
+      LaTeXContext defining, other;
+      render(parseWith(defining, definition));
+      actual = render(parseWith(other, latex));
+    }).join();
+    if (actual == expected) continue;
+    printf("redefinition: %s\n", wide2utf8(definition).c_str());
+    printf("  another context differs from the default layout: %s\n", wide2utf8(latex).c_str());
+    printDiff(expected, actual);
+    failures++;
+  }
+
+  // the lines broken by the total fit fit the narrow widths wherever the lines
+  // filled one by one do, the lines that overflow may be broken differently
+  size_t broken = 0;
+  for (const auto* latex : BREAKING) {
+    for (int narrow : NARROW_WIDTHS) {
+      unique_ptr<TeXRender> greedy(standard.parse(latex, narrow, textSize, lineSpace, BLACK));
+      unique_ptr<TeXRender> total(optimal.parse(latex, narrow, textSize, lineSpace, BLACK));
+      broken++;
+      if (greedy->getWidth() > narrow || total->getWidth() <= narrow) continue;
+      printf("breaking at %d: %s\n", narrow, wide2utf8(latex).c_str());
+      printf(
+        "  the optimal breaking overflows (%d px) where the greedy one fits (%d px)\n",
+        total->getWidth(), greedy->getWidth()
+      );
+      failures++;
+    }
+  }
+
+  // a formula that fails in a batch must not break the next ones of its worker
+  vector<wstring> batch;
+  for (size_t i = 0; i < formulas.size(); i++) {
+    batch.emplace_back(MALFORMED[i % (sizeof(MALFORMED) / sizeof(MALFORMED[0]))]);
+    batch.push_back(formulas[i]);
+  }
+  BatchOptions options;
+  options.width = width;
+  options.textSize = textSize;
+  options.lineSpace = lineSpace;
+  options.threads = 4;
+  const auto results = LaTeX::parseBatch(batch, options);
+  for (size_t i = 0; i < batch.size(); i++) {
+    const bool malformed = i % 2 == 0;
+    const string& expected = malformed ? string() : expectations[i / 2];
+    const string actual = results[i].render == nullptr ? string() : logOf(*results[i].render);
+    if (malformed ? actual.empty() && !results[i].error.empty() : actual == expected) continue;
+    printf("batch %zu: %s\n", i, wide2utf8(batch[i]).c_str());
+    if (malformed) {
+      printf("  the batch did not report the failure\n");
+    } else {
+      printf("  the batch differs from the default layout: %s\n", results[i].error.c_str());
+      printDiff(expected, actual);
+    }
+    failures++;
+  }
+
+  printf(
+    "%zu formulas, %zu edits, %zu redefinitions, %zu broken, %zu batched, %d differ\n",
+    formulas.size(), EDITS.size(), sizeof(REDEFINITIONS) / sizeof(REDEFINITIONS[0]), broken,
+    batch.size(), failures
+  );
+  LaTeX::release();
+  return failures;
+}
+
+#endif  // CLATEX_USE_SAMPLES && !MEM_CHECK
@@ -0,0 +1,68 @@
+#include "config.h"
+
+#if !defined(MEM_CHECK)
+
+#include "latex.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+using namespace std;
+using namespace tex;
+
+/** Make a formula that defines some macros and invokes them n times. */
+static wstring makeFormula(int n) {
+  wstring latex =
+    L"\\newcommand{\\pair}[2]{\\left(#1,#2\\right)}"
+    L"\\newcommand{\\sq}[1]{{#1}^2}"
+    L"\\newcommand{\\nest}[1]{\\pair{\\sq{#1}}{#1}}";
+  for (int i = 0; i < n; i++) {
+    switch (i % 3) {
+      case 0: latex += L"\\pair{a}{b}"; break;
+      case 1: latex += L"\\sq{x_" + to_wstring(i % 10) + L"}"; break;
+      default: latex += L"\\nest{y}"; break;
+    }
+    latex += L"+";
+  }
+  latex += L"0";
+  return latex;
+}
+
+/**
+ * Measure the cost of the expansion of the user-defined macros, the formulas
+ * are parsed and laid out but not drawn.
+ *
+ * Usage: LaTeXMacroBench [invocations]
+ *
+ * The formula with the given count (10000 by default) of macro invocations is
+ * parsed, and so are the formulas with 1/8, 1/4 and 1/2 of them, the time per
+ * invocation should be (nearly) constant if the expansion is linear.
+ */
+int main(int argc, char* argv[]) {
+  const int count = argc > 1 ? max(8, atoi(argv[1])) : 10000;
+  LaTeX::init();
+  LaTeXContext context;
+
+  // warm up, load the fonts and the predefined formulas
+  delete context.parse(makeFormula(8), 720, 20, 20 / 3.f, BLACK);
+  context.clearMacros();
+
+  printf("%12s %12s %16s\n", "invocations", "seconds", "us/invocation");
+  for (int n : {count / 8, count / 4, count / 2, count}) {
+    const wstring latex = makeFormula(n);
+    const auto start = chrono::steady_clock::now();
+    delete context.parse(latex, 720, 20, 20 / 3.f, BLACK);
+    const chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+    const double secs = elapsed.count();
+    printf("%12d %12.3f %16.3f\n", n, secs, secs * 1e6 / n);
+    context.clearMacros();
+  }
+
+  LaTeX::release();
+  return 0;
+}
+
+#endif  // !MEM_CHECK
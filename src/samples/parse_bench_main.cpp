@@ -0,0 +1,132 @@
+#include "config.h"
+
+#if defined(CLATEX_USE_SAMPLES) && !defined(MEM_CHECK)
+
+#include "latex.h"
+#include "atom/atom_char.h"
+#include "core/formula.h"
+#include "core/macro.h"
+#include "samples/graphic_null.h"
+#include "samples/samples.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cwctype>
+#include <vector>
+
+using namespace std;
+using namespace tex;
+
+/** Get the commands of the given formulas that are not macros, as the parser looks them up. */
+static vector<wstring> commandsOf(const vector<wstring>& formulas) {
+  vector<wstring> commands;
+  for (const auto& latex : formulas) {
+    for (size_t i = 0; i < latex.length(); i++) {
+      if (latex[i] != L'\\') continue;
+      size_t j = i + 1;
+      while (j < latex.length() && iswalpha(latex[j])) j++;
+      const wstring command = latex.substr(i + 1, j - i - 1);
+      if (!command.empty() && MacroInfo::get(command) == nullptr) commands.push_back(command);
+      i = j - 1;
+    }
+  }
+  return commands;
+}
+
+/** Resolve the command as the parser does, without throwing. */
+static bool findCommand(const wstring& command) {
+  if (Formula::find(command) != nullptr) return true;
+  return SymbolAtom::find(wide2utf8(command)) != nullptr;
+}
+
+/** Resolve the command as the parser did before, by throwing and catching. */
+static bool getCommand(const wstring& command) {
+  const string cmd = wide2utf8(command);
+  try {
+    return Formula::get(command) != nullptr;
+  } catch (ex_formula_not_found& e) {
+    try {
+      return SymbolAtom::get(cmd) != nullptr;
+    } catch (ex_symbol_not_found& ex) {}
+  }
+  return false;
+}
+
+/**
+ * Measure the time to parse, layout and draw the samples on a single thread
+ * with the default context, the cost of the symbol and formula lookups of the
+ * parser is part of it.
+ *
+ * Usage: LaTeXParseBench [repeat] [samples file]
+ *
+ * The samples (res/SAMPLES.tex by default) are rendered 'repeat' (default 100)
+ * times, the time of the parse (parse and layout) and the time of the draw are
+ * reported separately. Then the commands of the samples that are not macros
+ * are resolved 'repeat' times by the lookups of the parser, which do not
+ * throw, and by the lookups that throw (Formula::get and SymbolAtom::get) the
+ * parser used before, to show the cost of the exceptions.
+ */
+int main(int argc, char* argv[]) {
+  const int repeat = argc > 1 ? max(1, atoi(argv[1])) : 100;
+  LaTeX::init();
+
+  Samples samples(argc > 2 ? argv[2] : "");
+  const int count = samples.count();
+  Graphics2D_null g2;
+
+  // warm up, load the fonts and the predefined formulas
+  for (int i = 0; i < count; i++) {
+    TeXRender* r = LaTeX::parse(samples.next(), 720, 20, 20 / 3.f, BLACK);
+    r->draw(g2, 0, 0);
+    delete r;
+  }
+
+  chrono::duration<double> parse(0), draw(0);
+  for (int n = 0; n < repeat; n++) {
+    for (int i = 0; i < count; i++) {
+      const wstring& latex = samples.next();
+      const auto start = chrono::steady_clock::now();
+      TeXRender* r = LaTeX::parse(latex, 720, 20, 20 / 3.f, BLACK);
+      const auto parsed = chrono::steady_clock::now();
+      r->draw(g2, 0, 0);
+      parse += parsed - start;
+      draw += chrono::steady_clock::now() - parsed;
+      delete r;
+    }
+  }
+
+  const double formulas = (double) count * repeat;
+  printf("%d samples x %d\n", count, repeat);
+  printf("%8s %12s %16s\n", "", "seconds", "us/formula");
+  printf("%8s %12.3f %16.2f\n", "parse", parse.count(), parse.count() * 1e6 / formulas);
+  printf("%8s %12.3f %16.2f\n", "draw", draw.count(), draw.count() * 1e6 / formulas);
+  printf("%8s %12.3f %16.2f\n", "total", (parse + draw).count(), (parse + draw).count() * 1e6 / formulas);
+
+  vector<wstring> all;
+  for (int i = 0; i < count; i++) all.push_back(samples.next());
+  const vector<wstring> commands = commandsOf(all);
+  size_t found = 0;
+  chrono::duration<double> find(0), get(0);
+  for (int n = 0; n < repeat; n++) {
+    auto start = chrono::steady_clock::now();
+    for (const auto& command : commands) found += findCommand(command);
+    auto end = chrono::steady_clock::now();
+    find += end - start;
+    start = end;
+    for (const auto& command : commands) found -= getCommand(command);
+    get += chrono::steady_clock::now() - start;
+  }
+
+  const double lookups = (double) commands.size() * repeat;
+  printf("\n%zu commands x %d%s\n", commands.size(), repeat, found == 0 ? "" : ", the lookups differ");
+  printf("%8s %12s %16s\n", "lookup", "seconds", "us/command");
+  printf("%8s %12.3f %16.3f\n", "find", find.count(), find.count() * 1e6 / lookups);
+  printf("%8s %12.3f %16.3f\n", "throw", get.count(), get.count() * 1e6 / lookups);
+
+  LaTeX::release();
+  return 0;
+}
+
+#endif  // CLATEX_USE_SAMPLES && !MEM_CHECK
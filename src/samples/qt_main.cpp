@@ -15,6 +15,8 @@ int main(int argc, char **argv) {
 #endif
 
   tex::LaTeX::init();
+  // keep the atom trees, so the widget can relayout the formula on resize
+  tex::LaTeX::setRetainAtoms(true);
   MainWindow mainwin;
   mainwin.show();
   int retn = app.exec();
@@ -13,6 +13,7 @@ TexQmlItem::TexQmlItem(QQuickItem* parent, float text_size)
   , _text_size(text_size)
   , _padding(0)
 {
+    _context.setRetainAtoms(true);
     setImplicitHeight(30);
     setImplicitWidth(100);
 }
@@ -42,7 +43,7 @@ void TexQmlItem::setLatexString(const QString& latex)
     }
 
     try {
-        _render = LaTeX::parse(
+        _render = _context.parse(
             latex.toStdWString(),
             width() - _padding * 2,
             _text_size,
@@ -64,4 +65,28 @@ QString TexQmlItem::latexString() const
     return m_latexString;
 }
 
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+void TexQmlItem::geometryChange(const QRectF& newGeometry, const QRectF& oldGeometry)
+{
+    QQuickPaintedItem::geometryChange(newGeometry, oldGeometry);
+    if (newGeometry.width() != oldGeometry.width()) relayout(newGeometry.width());
+}
+#else
+void TexQmlItem::geometryChanged(const QRectF& newGeometry, const QRectF& oldGeometry)
+{
+    QQuickPaintedItem::geometryChanged(newGeometry, oldGeometry);
+    if (newGeometry.width() != oldGeometry.width()) relayout(newGeometry.width());
+}
+#endif
+
+void TexQmlItem::relayout(qreal width)
+{
+    if (_render == nullptr || !_render->isRelayoutable()) {
+        return;
+    }
+    _render->relayout(width - _padding * 2, _text_size / 3.f);
+    setImplicitHeight(_render->getHeight());
+    update();
+}
+
 #endif
@@ -20,7 +20,19 @@ public:
     void setLatexString(const QString& latex);
     QString latexString() const;
 
+protected:
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+    void geometryChange(const QRectF& newGeometry, const QRectF& oldGeometry) override;
+#else
+    void geometryChanged(const QRectF& newGeometry, const QRectF& oldGeometry) override;
+#endif
+
 private:
+    void relayout(qreal width);
+
+    // the renders retain their atoms, so a new width is laid out without
+    // parsing the formula again
+    tex::LaTeXContext _context;
     tex::TeXRender* _render;
     float _text_size;
     int _padding;
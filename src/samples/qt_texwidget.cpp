@@ -73,5 +73,14 @@ void TeXWidget::paintEvent(QPaintEvent* event)
   }
 }
 
+void TeXWidget::resizeEvent(QResizeEvent* event)
+{
+  QWidget::resizeEvent(event);
+  if (_render != nullptr && _render->isRelayoutable()) {
+    _render->relayout(width() - _padding * 2, _text_size / 3.f);
+    update();
+  }
+}
+
 
 #endif
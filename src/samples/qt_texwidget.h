@@ -23,6 +23,7 @@ class TeXWidget : public QWidget
   int getRenderWidth();
   int getRenderHeight();
   void paintEvent(QPaintEvent* event);
+  void resizeEvent(QResizeEvent* event);
 
  private:
   tex::TeXRender* _render;
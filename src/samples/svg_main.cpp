@@ -0,0 +1,109 @@
+#include "config.h"
+
+#if defined(BUILD_SVG) && !defined(MEM_CHECK)
+
+#include "atom/atom_basic.h"
+#include "latex.h"
+#include "platform/svg/graphic_svg.h"
+#include "utils/string_utils.h"
+#include "utils/utf.h"
+
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace tex;
+
+struct Options {
+  string input;
+  string output;
+  float textSize = 20.f;
+  float padding = 10.f;
+  float maxWidth = 720.f;
+  color foreground = BLACK;
+  color background = TRANSPARENT;
+};
+
+int printUsage() {
+  __print(
+    "Convert LaTeX code into SVG image without any graphics library.\n\n"
+    "  -h\n"
+    "      show usages and exit\n\n"
+    "  -input=[CODE]\n"
+    "      the source code that is written in LaTeX, read from the standard input if not given\n\n"
+    "  -output=[FILE]\n"
+    "      indicates where to save the produced SVG image, write to the standard output if not\n"
+    "      given\n\n"
+    "  -textsize=[VALUE]\n"
+    "      a float value to config the text size (in point) to display formulas, the default\n"
+    "      is 20\n\n"
+    "  -foreground=[COLOR]\n"
+    "      the foreground color, a color name or in the form of #AARRGGBB; default is black\n\n"
+    "  -background=[COLOR]\n"
+    "      the background color, a color name or in the form of #AARRGGBB; default is\n"
+    "      transparent\n\n"
+    "  -padding=[VALUE]\n"
+    "      a float value to config spaces (in pixel) to add to the SVG image, the default is 10\n\n"
+    "  -maxwidth=[VALUE]\n"
+    "      the max width of the formula, the default is 720 pixels\n\n"
+  );
+  return 0;
+}
+
+void generate(const Options& opts, const wstring& code, ostream& os) {
+  auto r = LaTeX::parse(code, (int) opts.maxWidth, opts.textSize, opts.textSize / 3.f, opts.foreground);
+  const float w = r->getWidth() + opts.padding * 2;
+  const float h = r->getHeight() + opts.padding * 2;
+  Graphics2D_svg g2(os, w, h);
+  if (!isTransparent(opts.background)) {
+    g2.setColor(opts.background);
+    g2.fillRect(0, 0, w, h);
+  }
+  r->draw(g2, (int) opts.padding, (int) opts.padding);
+  g2.finish();
+  delete r;
+}
+
+int main(int argc, char* argv[]) {
+  Options opts;
+  for (int i = 1; i < argc; i++) {
+    const string x = argv[i];
+    const string value = x.substr(x.find('=') + 1);
+    if (x == "-h") {
+      return printUsage();
+    } else if (startswith(x, "-input")) {
+      opts.input = value;
+    } else if (startswith(x, "-output")) {
+      opts.output = value;
+    } else if (startswith(x, "-textsize")) {
+      valueof(value, opts.textSize);
+    } else if (startswith(x, "-foreground")) {
+      opts.foreground = ColorAtom::getColor(value);
+    } else if (startswith(x, "-background")) {
+      opts.background = ColorAtom::getColor(value);
+    } else if (startswith(x, "-padding")) {
+      valueof(value, opts.padding);
+    } else if (startswith(x, "-maxwidth")) {
+      valueof(value, opts.maxWidth);
+    }
+  }
+  if (opts.input.empty()) {
+    opts.input.assign(istreambuf_iterator<char>(cin), istreambuf_iterator<char>());
+  }
+
+  LaTeX::init();
+  const wstring code = utf82wide(opts.input);
+  if (opts.output.empty()) {
+    generate(opts, code, cout);
+  } else {
+    ofstream out(opts.output);
+    generate(opts, code, out);
+  }
+  LaTeX::release();
+  return 0;
+}
+
+#endif  // BUILD_SVG && !MEM_CHECK
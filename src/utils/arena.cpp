@@ -0,0 +1,27 @@
+#include "utils/arena.h"
+
+#include <algorithm>
+
+using namespace tex;
+
+thread_local Arena* Arena::_current = nullptr;
+
+void* Arena::grow(std::size_t size, std::size_t align) {
+  // the oversize request gets a block on its own
+  const std::size_t blockSize = std::max(_blockSize, size + align);
+  char* block = new char[blockSize];
+  _blocks.push_back(block);
+  _ptr = (std::uintptr_t) block;
+  _end = _ptr + blockSize;
+  return allocate(size, align);
+}
+
+Arena* Arena::activate(Arena* arena) {
+  Arena* prev = _current;
+  _current = arena;
+  return prev;
+}
+
+Arena::~Arena() {
+  for (char* block : _blocks) delete[] block;
+}
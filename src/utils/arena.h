@@ -0,0 +1,125 @@
+#ifndef ARENA_H_INCLUDED
+#define ARENA_H_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace tex {
+
+/**
+ * A bump allocator that hands out memory from large blocks and releases all
+ * of it at once when it is destroyed. The objects allocated from an arena never
+ * free their memory individually.
+ *
+ * An arena can be activated on the current thread, then all the objects
+ * created by sptrOf on this thread are allocated from it. Every object keeps
+ * a reference to its arena, so the arena is released when the last of its
+ * objects is gone. An arena must not be active on more than one thread at the
+ * same time, but its objects may be released from any thread.
+ */
+class Arena : public std::enable_shared_from_this<Arena> {
+private:
+  static thread_local Arena* _current;
+
+  std::vector<char*> _blocks;
+  std::uintptr_t _ptr;
+  std::uintptr_t _end;
+  const std::size_t _blockSize;
+
+  void* grow(std::size_t size, std::size_t align);
+
+public:
+  explicit Arena(std::size_t blockSize = 16 * 1024)
+    : _ptr(0), _end(0), _blockSize(blockSize) {}
+
+  Arena(const Arena&) = delete;
+
+  void operator=(const Arena&) = delete;
+
+  /** Allocate size bytes aligned to align (must be power of 2) from this arena. */
+  inline void* allocate(std::size_t size, std::size_t align) {
+    const std::uintptr_t p = (_ptr + align - 1) & ~(std::uintptr_t) (align - 1);
+    if (p + size > _end || _ptr == 0) return grow(size, align);
+    _ptr = p + size;
+    return (void*) p;
+  }
+
+  /** Get the arena active on the current thread, nullptr if none. */
+  inline static Arena* current() { return _current; }
+
+  /**
+   * Make the given arena active on the current thread.
+   *
+   * @param arena the arena to activate, nullptr to deactivate
+   * @return the previous active arena
+   */
+  static Arena* activate(Arena* arena);
+
+  ~Arena();
+};
+
+/** Allocator to allocate objects (with std::allocate_shared) from an Arena */
+template<typename T>
+class ArenaAllocator {
+public:
+  using value_type = T;
+
+  std::shared_ptr<Arena> _arena;
+
+  explicit ArenaAllocator(std::shared_ptr<Arena> arena) : _arena(std::move(arena)) {}
+
+  template<typename U>
+  ArenaAllocator(const ArenaAllocator<U>& other) : _arena(other._arena) {}
+
+  inline T* allocate(std::size_t n) {
+    return static_cast<T*>(_arena->allocate(n * sizeof(T), alignof(T)));
+  }
+
+  inline void deallocate(T*, std::size_t) {}
+
+  template<typename U>
+  inline bool operator==(const ArenaAllocator<U>& other) const { return _arena == other._arena; }
+
+  template<typename U>
+  inline bool operator!=(const ArenaAllocator<U>& other) const { return _arena != other._arena; }
+};
+
+/** Activate an arena on the current thread during the lifetime of this object */
+class ArenaActivation {
+private:
+  Arena* const _prev;
+
+public:
+  explicit ArenaActivation(Arena* arena) : _prev(Arena::activate(arena)) {}
+
+  ArenaActivation(const ArenaActivation&) = delete;
+
+  void operator=(const ArenaActivation&) = delete;
+
+  ~ArenaActivation() { Arena::activate(_prev); }
+};
+
+/**
+ * Deactivate the arena of the current thread during the lifetime of this
+ * object, the objects put into the caches that outlive the render (e.g. the
+ * fonts loaded while laying out) must be allocated under it.
+ */
+class ArenaSuspension {
+private:
+  Arena* const _prev;
+
+public:
+  ArenaSuspension() : _prev(Arena::activate(nullptr)) {}
+
+  ArenaSuspension(const ArenaSuspension&) = delete;
+
+  void operator=(const ArenaSuspension&) = delete;
+
+  ~ArenaSuspension() { Arena::activate(_prev); }
+};
+
+}  // namespace tex
+
+#endif  // ARENA_H_INCLUDED
@@ -1,18 +1,37 @@
 #ifndef INDEXED_ARR_H_INCLUDED
 #define INDEXED_ARR_H_INCLUDED
 
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
 namespace tex {
 
 /**
  * Template to represents 2 dimensions array with N element(s) for each item and
  * sorted by the first M element(s).
+ *
+ * The keys are char codes, an index is built once the array is set so the
+ * items are found with a couple of loads: the items with a single key are
+ * indexed directly by the key (if the keys are not too sparse), the items with
+ * 2 keys (a pair of chars) are indexed by a hash table. The other items are
+ * found by binary search.
  */
 template <typename T, size_t N, size_t M>
 class IndexedArray {
 private:
+  // the widest range of single keys to index directly
+  static constexpr long MAX_DIRECT = 1 << 16;
+
   const T* _raw;
   size_t   _rows;
   bool     _auto_delete;
+  // the index of the items, each slot holds the row of an item plus 1, or 0 if
+  // empty: by the key minus _first for a single key, or the hash table (open
+  // addressing, the size is a power of 2) for 2 keys
+  std::vector<uint32_t> _index;
+  long _first;
 
   int compare(const T a[M], const T b[M]) const {
     for (size_t i = 0; i < M; i++) {
@@ -22,24 +41,79 @@ private:
     return 0;
   }
 
+  static inline long key(const T& k) { return (long) k; }
+
+  static inline size_t hash(long a, long b) {
+    const size_t h = ((size_t) a * 31 + (size_t) b) * 2654435761u;
+    return h ^ (h >> 16);
+  }
+
+  /** Find the row of the given keys by binary search, return -1 if not found */
+  int search(const T k[M]) const {
+    int l = 0, h = (int) _rows - 1;
+    while (l <= h) {
+      const int  m   = l + ((h - l) >> 1);
+      const int cmp = compare(k, _raw + (m * N));
+      if (cmp == 0) return m;
+      cmp < 0 ? h = m - 1 : l = m + 1;
+    }
+    return -1;
+  }
+
+  /**
+   * Build the index, the keys are mapped to the rows found by the binary search
+   * so the same item is found if several have the same keys.
+   */
+  void index() {
+    if (_raw == nullptr || _rows == 0) return;
+    if (M == 1) {
+      long first = key(_raw[0]), last = first;
+      for (size_t i = 1; i < _rows; i++) {
+        const long k = key(_raw[i * N]);
+        if (k < first) first = k;
+        if (k > last) last = k;
+      }
+      if (last - first >= MAX_DIRECT) return;
+      _first = first;
+      _index.assign(last - first + 1, 0);
+      for (size_t i = 0; i < _rows; i++) _index[key(_raw[i * N]) - first] = search(_raw + (i * N)) + 1;
+    } else if (M == 2) {
+      size_t size = 1;
+      while (size < 2 * _rows) size <<= 1;
+      _index.assign(size, 0);
+      const size_t mask = size - 1;
+      for (size_t i = 0; i < _rows; i++) {
+        const T* r = _raw + (i * N);
+        size_t s = hash(key(r[0]), key(r[1])) & mask;
+        while (_index[s] != 0 && compare(r, _raw + (_index[s] - 1) * N) != 0) s = (s + 1) & mask;
+        if (_index[s] == 0) _index[s] = search(r) + 1;
+      }
+    }
+  }
+
 public:
   IndexedArray(const IndexedArray& arr) = delete;
 
   IndexedArray(IndexedArray&& arr) = delete;
 
-  IndexedArray() : _raw(nullptr), _rows(0), _auto_delete(false) {}
+  IndexedArray() : _raw(nullptr), _rows(0), _auto_delete(false), _first(0) {}
 
   IndexedArray(const T* arr, int len, bool auto_delete = false)
-      : _raw(arr), _rows(len / N), _auto_delete(auto_delete) {}
+      : _raw(arr), _rows(len / N), _auto_delete(auto_delete), _first(0) {
+    index();
+  }
 
   void operator=(IndexedArray&& o) {
     _raw         = o._raw;
     _rows        = o._rows;
     _auto_delete = o._auto_delete;
+    _index       = std::move(o._index);
+    _first       = o._first;
     // reset o
     o._raw         = nullptr;
     o._rows        = 0;
     o._auto_delete = false;
+    o._index.clear();
   }
 
   /** Find the item by the given keys, return nullptr if not found */
@@ -47,15 +121,24 @@ public:
   const T* operator()(const Ks&... keys) const {
     if (_raw == nullptr) return nullptr;
     const T k[] = {keys...};
-    int     l = 0, h = _rows;
-    while (l <= h) {
-      const int  m   = l + ((h - l) >> 1);
-      const T*   r   = _raw + (m * N);
-      const int cmp = compare(k, r);
-      if (cmp == 0) return r;
-      cmp < 0 ? h = m - 1 : l = m + 1;
+    if (M == 1) {
+      if (!_index.empty()) {
+        // a key less than the first one wraps around to out of the index
+        const size_t i = (size_t) (key(k[0]) - _first);
+        if (i >= _index.size() || _index[i] == 0) return nullptr;
+        return _raw + ((_index[i] - 1) * N);
+      }
+    } else if (M == 2) {
+      if (_index.empty()) return nullptr;
+      const size_t mask = _index.size() - 1;
+      for (size_t s = hash(key(k[0]), key(k[1])) & mask; _index[s] != 0; s = (s + 1) & mask) {
+        const T* r = _raw + ((_index[s] - 1) * N);
+        if (compare(k, r) == 0) return r;
+      }
+      return nullptr;
     }
-    return nullptr;
+    const int r = search(k);
+    return r < 0 ? nullptr : _raw + (r * N);
   }
 
   /** Get the item by the given index, return nullptr if index out of range */
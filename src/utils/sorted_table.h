@@ -0,0 +1,103 @@
+#ifndef SORTED_TABLE_H_INCLUDED
+#define SORTED_TABLE_H_INCLUDED
+
+#include <cstddef>
+#include <string>
+
+// the tables are sorted at compile time if the constexpr functions may loop
+// (since C++14), and when they are initialized at startup otherwise
+#if __cpp_constexpr >= 201304L
+#define SORTED_TABLE_CONSTEXPR constexpr
+#else
+#define SORTED_TABLE_CONSTEXPR
+#endif
+
+namespace tex {
+
+/** A string literal used as the key of a SortedTable, found by a std::basic_string */
+template <typename C>
+struct TableKey {
+  const C* str;
+  std::size_t len;
+
+  constexpr TableKey() : str(nullptr), len(0) {}
+
+  template <std::size_t L>
+  constexpr TableKey(const C (&s)[L]) : str(s), len(L - 1) {}
+};
+
+template <typename C>
+SORTED_TABLE_CONSTEXPR bool operator<(const TableKey<C>& a, const TableKey<C>& b) {
+  for (std::size_t i = 0; i < a.len && i < b.len; i++) {
+    if (a.str[i] != b.str[i]) return a.str[i] < b.str[i];
+  }
+  return a.len < b.len;
+}
+
+template <typename C>
+inline bool operator<(const TableKey<C>& a, const std::basic_string<C>& b) {
+  return b.compare(0, b.length(), a.str, a.len) > 0;
+}
+
+template <typename C>
+inline bool operator==(const TableKey<C>& a, const std::basic_string<C>& b) {
+  return b.compare(0, b.length(), a.str, a.len) == 0;
+}
+
+/** An entry of the SortedTable */
+template <typename K, typename V>
+struct TableEntry {
+  K key;
+  V value;
+};
+
+/**
+ * Read-only table of N entries sorted by key when it is constructed, so a
+ * constexpr table is sorted at compile time and costs nothing at startup. The
+ * key and the value must be literal types, the entries are found by binary
+ * search. If several entries have the same key, the first one wins.
+ */
+template <typename K, typename V, std::size_t N>
+class SortedTable {
+private:
+  TableEntry<K, V> _entries[N];
+
+public:
+  SORTED_TABLE_CONSTEXPR explicit SortedTable(const TableEntry<K, V> (&entries)[N]) : _entries{} {
+    // insertion sort, it is stable thus keeps the first of the same keys first
+    for (std::size_t i = 0; i < N; i++) {
+      const TableEntry<K, V> e = entries[i];
+      std::size_t j = i;
+      for (; j > 0 && e.key < _entries[j - 1].key; j--) _entries[j] = _entries[j - 1];
+      _entries[j] = e;
+    }
+  }
+
+  /** Find the value of the given key, return nullptr if not found */
+  template <typename Q>
+  const V* find(const Q& key) const {
+    std::size_t l = 0, h = N;
+    while (l < h) {
+      const std::size_t m = l + ((h - l) >> 1);
+      if (_entries[m].key < key) l = m + 1;
+      else h = m;
+    }
+    return l < N && _entries[l].key == key ? &_entries[l].value : nullptr;
+  }
+
+  constexpr std::size_t size() const { return N; }
+
+  constexpr const TableEntry<K, V>* begin() const { return _entries; }
+
+  constexpr const TableEntry<K, V>* end() const { return _entries + N; }
+};
+
+/** Sort the given entries into a table, see SortedTable */
+template <typename K, typename V, std::size_t N>
+SORTED_TABLE_CONSTEXPR SortedTable<K, V, N> sortedTable(const TableEntry<K, V> (&entries)[N]) {
+  return SortedTable<K, V, N>(entries);
+}
+
+}  // namespace tex
+
+#endif  // SORTED_TABLE_H_INCLUDED
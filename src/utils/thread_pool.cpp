@@ -0,0 +1,103 @@
+#include "utils/thread_pool.h"
+
+#include <algorithm>
+
+using namespace tex;
+
+ThreadPool::ThreadPool(std::size_t threads)
+  : _job(nullptr), _generation(0), _active(0), _stop(false) {
+  if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+  for (std::size_t i = 0; i < threads; i++) _queues.push_back(std::unique_ptr<Queue>(new Queue()));
+  for (std::size_t i = 0; i < threads; i++) _threads.emplace_back(&ThreadPool::work, this, i);
+}
+
+bool ThreadPool::take(std::size_t worker, std::size_t& item) {
+  {
+    Queue& q = *_queues[worker];
+    std::lock_guard<std::mutex> lock(q.mutex);
+    if (!q.items.empty()) {
+      item = q.items.front();
+      q.items.pop_front();
+      return true;
+    }
+  }
+  const std::size_t n = _queues.size();
+  for (std::size_t i = 1; i < n; i++) {
+    Queue& q = *_queues[(worker + i) % n];
+    std::lock_guard<std::mutex> lock(q.mutex);
+    if (!q.items.empty()) {
+      item = q.items.back();
+      q.items.pop_back();
+      return true;
+    }
+  }
+  return false;
+}
+
+void ThreadPool::work(std::size_t worker) {
+  std::size_t seen = 0;
+  while (true) {
+    const std::function<void(std::size_t, std::size_t)>* job;
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      _wake.wait(lock, [&] { return _stop || (_job != nullptr && _generation != seen); });
+      if (_stop) return;
+      seen = _generation;
+      job = _job;
+      _active++;
+    }
+    std::size_t item;
+    std::exception_ptr error;
+    while (take(worker, item)) {
+      try {
+        (*job)(item, worker);
+      } catch (...) {
+        if (error == nullptr) error = std::current_exception();
+      }
+    }
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (error != nullptr && _error == nullptr) _error = error;
+    if (--_active == 0) _done.notify_all();
+  }
+}
+
+void ThreadPool::forEach(std::size_t count, const std::function<void(std::size_t, std::size_t)>& fn) {
+  if (count == 0) return;
+  // split the items into contiguous ranges, one per worker
+  const std::size_t n = _queues.size();
+  for (std::size_t w = 0; w < n; w++) {
+    Queue& q = *_queues[w];
+    std::lock_guard<std::mutex> lock(q.mutex);
+    for (std::size_t i = w * count / n, end = (w + 1) * count / n; i < end; i++) {
+      q.items.push_back(i);
+    }
+  }
+  std::unique_lock<std::mutex> lock(_mutex);
+  _job = &fn;
+  _generation++;
+  _error = nullptr;
+  _wake.notify_all();
+  // the job is done once the queues are drained and no worker still runs an item of it
+  _done.wait(lock, [&] {
+    if (_active != 0) return false;
+    for (const auto& q : _queues) {
+      std::lock_guard<std::mutex> ql(q->mutex);
+      if (!q->items.empty()) return false;
+    }
+    return true;
+  });
+  _job = nullptr;
+  std::exception_ptr error = _error;
+  _error = nullptr;
+  lock.unlock();
+  if (error != nullptr) std::rethrow_exception(error);
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stop = true;
+  }
+  _wake.notify_all();
+  for (auto& t : _threads) t.join();
+}
@@ -0,0 +1,77 @@
+#ifndef THREAD_POOL_H_INCLUDED
+#define THREAD_POOL_H_INCLUDED
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace tex {
+
+/**
+ * A fixed-size pool of worker threads that runs indexed jobs with work
+ * stealing. The items of a job are split into contiguous ranges, one per
+ * worker; a worker takes the items from the front of its own queue, and steals
+ * from the back of the others' once its queue is empty, so the workers keep
+ * busy even if the costs of the items vary a lot.
+ */
+class ThreadPool {
+private:
+  struct Queue {
+    std::mutex mutex;
+    std::deque<std::size_t> items;
+  };
+
+  std::vector<std::thread> _threads;
+  std::vector<std::unique_ptr<Queue>> _queues;
+
+  std::mutex _mutex;
+  std::condition_variable _wake, _done;
+  // the running job, nullptr if none
+  const std::function<void(std::size_t, std::size_t)>* _job;
+  std::size_t _generation;
+  // the count of the workers that are working on the running job
+  std::size_t _active;
+  std::exception_ptr _error;
+  bool _stop;
+
+  /** Take an item from the queue of the given worker, or steal one from the others. */
+  bool take(std::size_t worker, std::size_t& item);
+
+  void work(std::size_t worker);
+
+public:
+  /**
+   * Create a pool with the given count of threads.
+   *
+   * @param threads the count of worker threads, 0 means as many as the hardware supports
+   */
+  explicit ThreadPool(std::size_t threads = 0);
+
+  ThreadPool(const ThreadPool&) = delete;
+
+  void operator=(const ThreadPool&) = delete;
+
+  /** Get the count of the worker threads. */
+  inline std::size_t size() const { return _threads.size(); }
+
+  /**
+   * Call fn(item, worker) for every item in [0, count) on the worker threads
+   * and block until all of them are done. The worker index is in [0, size()),
+   * an item never runs on two workers at the same time, so the workers can
+   * keep their own state indexed by it. If fn throws, the remaining items are
+   * still run and the first exception is rethrown after.
+   */
+  void forEach(std::size_t count, const std::function<void(std::size_t, std::size_t)>& fn);
+
+  ~ThreadPool();
+};
+
+}  // namespace tex
+
+#endif  // THREAD_POOL_H_INCLUDED
@@ -6,6 +6,8 @@
 #include <memory>
 #include <vector>
 
+#include "utils/arena.h"
+
 #define no_copy_assign(T) \
   T(const T&) = delete;   \
   void operator=(const T&) = delete
@@ -24,8 +26,19 @@ using c32 = char32_t;
 template<typename T>
 using sptr = std::shared_ptr<T>;
 
+/**
+ * Create a shared object of type T, the object is allocated from the Arena
+ * active on the current thread if any.
+ */
 template<typename T, typename... Args>
 inline sptr<T> sptrOf(Args&& ... args) {
+  Arena* arena = Arena::current();
+  if (arena != nullptr) {
+    return std::allocate_shared<T>(
+      ArenaAllocator<T>(arena->shared_from_this()),
+      std::forward<Args>(args)...
+    );
+  }
   return std::make_shared<T>(std::forward<Args>(args)...);
 }
 